@@ -0,0 +1,515 @@
+//*****************************************************************************
+//
+// aesmac.c - Pipelined AES encrypt-then-MAC using the AES and SHA/MD5 modules.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup aesmac_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_aes.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_shamd5.h"
+#include "inc/hw_types.h"
+#include "driverlib/aes.h"
+#include "driverlib/aesmac.h"
+#include "driverlib/debug.h"
+#include "driverlib/delay.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/udma.h"
+
+//*****************************************************************************
+//
+// Configures both crypto engines for a new encrypt-then-MAC operation.
+//
+//*****************************************************************************
+static void
+_AESMACConfigure(const tAESMACConfig *psConfig)
+{
+    //
+    // Program the AES context.
+    //
+    AESConfigSet(AES_BASE, psConfig->ui32AESConfig);
+    AESKey1Set(AES_BASE, psConfig->pui32Key, psConfig->ui32KeySize);
+    if(psConfig->pui32IV)
+    {
+        AESIVSet(AES_BASE, psConfig->pui32IV);
+    }
+
+    //
+    // Wait for the SHA/MD5 context to be ready before writing the mode.
+    //
+    while((HWREG(SHAMD5_BASE + SHAMD5_O_IRQSTATUS) &
+           SHAMD5_INT_CONTEXT_READY) == 0)
+    {
+    }
+
+    //
+    // Program the hash algorithm and, for HMAC algorithms, the key.  The
+    // plain hash algorithms are the only ones with the algorithm constant
+    // bit set.
+    //
+    SHAMD5ConfigSet(SHAMD5_BASE, psConfig->ui32HashAlgo);
+    if((psConfig->ui32HashAlgo & SHAMD5_MODE_ALGO_CONSTANT) == 0)
+    {
+        SHAMD5HMACKeySet(SHAMD5_BASE, psConfig->pui32HMACKey);
+    }
+}
+
+//*****************************************************************************
+//
+// Starts the uDMA transfers that move one chunk through the AES module.
+//
+//*****************************************************************************
+static void
+_AESMACAESStart(uint32_t *pui32Src, uint32_t *pui32Dest, uint32_t ui32Count)
+{
+    //
+    // Set up the output channel first so that no output block can be
+    // produced before there is somewhere for it to go.
+    //
+    uDMAChannelTransferSet(UDMA_CH15_AES0DOUT | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC,
+                           (void *)(AES_BASE + AES_O_DATA_IN_0), pui32Dest,
+                           ui32Count / 4);
+    uDMAChannelTransferSet(UDMA_CH14_AES0DIN | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC, pui32Src,
+                           (void *)(AES_BASE + AES_O_DATA_IN_0),
+                           ui32Count / 4);
+
+    //
+    // Start both channels.
+    //
+    uDMAChannelEnable(UDMA_CH15_AES0DOUT);
+    uDMAChannelEnable(UDMA_CH14_AES0DIN);
+}
+
+//*****************************************************************************
+//
+// Starts the uDMA transfer that moves whole blocks into the SHA/MD5 module.
+//
+//*****************************************************************************
+static void
+_AESMACSHAMD5Start(uint32_t *pui32Src, uint32_t ui32Count)
+{
+    uDMAChannelTransferSet(UDMA_CH5_SHAMD50DIN | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC, pui32Src,
+                           (void *)(SHAMD5_BASE + SHAMD5_O_DATA_0_IN),
+                           ui32Count / 4);
+    uDMAChannelEnable(UDMA_CH5_SHAMD50DIN);
+}
+
+//*****************************************************************************
+//
+//! Configures the uDMA channels used by the encrypt-then-MAC pipeline.
+//!
+//! This function assigns uDMA channels 14 and 15 to the AES data input and
+//! output and channel 5 to the SHA/MD5 data input, and programs their
+//! channel control words.  It must be called once after the uDMA controller
+//! has been enabled and its control table set with uDMAControlBaseSet(), and
+//! before the first call to AESMACEncrypt().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AESMACDMAConfigure(void)
+{
+    //
+    // Route the crypto requests to the channels used by the pipeline.
+    //
+    uDMAChannelAssign(UDMA_CH14_AES0DIN);
+    uDMAChannelAssign(UDMA_CH15_AES0DOUT);
+    uDMAChannelAssign(UDMA_CH5_SHAMD50DIN);
+
+    //
+    // Start from a known set of channel attributes.
+    //
+    uDMAChannelAttributeDisable(UDMA_CH14_AES0DIN, UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(UDMA_CH15_AES0DOUT, UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(UDMA_CH5_SHAMD50DIN, UDMA_ATTR_ALL);
+
+    //
+    // The AES module requests one 4-word block at a time and the SHA/MD5
+    // module one 16-word block at a time.  The data registers behave as a
+    // FIFO so the peripheral side of each transfer does not increment.
+    //
+    uDMAChannelControlSet(UDMA_CH14_AES0DIN | UDMA_PRI_SELECT,
+                          UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_4 | UDMA_DST_PROT_PRIV);
+    uDMAChannelControlSet(UDMA_CH15_AES0DOUT | UDMA_PRI_SELECT,
+                          UDMA_SIZE_32 | UDMA_SRC_INC_NONE | UDMA_DST_INC_32 |
+                          UDMA_ARB_4 | UDMA_SRC_PROT_PRIV);
+    uDMAChannelControlSet(UDMA_CH5_SHAMD50DIN | UDMA_PRI_SELECT,
+                          UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_16 | UDMA_DST_PROT_PRIV);
+}
+
+//*****************************************************************************
+//
+//! Encrypts data and computes a hash or HMAC of the ciphertext in a pipeline.
+//!
+//! \param psConfig is a pointer to the AES and SHA/MD5 configuration.
+//! \param pui32Src is a pointer to the plaintext.
+//! \param pui32Dest is a pointer to the buffer that receives the ciphertext.
+//! \param ui32Length is the length of the data in bytes.  It must be a
+//! non-zero multiple of 16.
+//! \param ui32ChunkSize is the pipeline granularity in bytes.  It must be a
+//! multiple of 64 and no larger than \b AESMAC_CHUNK_MAX.
+//! \param pui32Tag is a pointer to the array that receives the hash result.
+//! It must be large enough for the selected algorithm (up to 8 words).
+//!
+//! This function splits the data into chunks of \e ui32ChunkSize bytes and
+//! overlaps the two engines: while the AES module encrypts chunk N under
+//! uDMA control, the SHA/MD5 module hashes the ciphertext of chunk N-1, also
+//! under uDMA control.  Both engines are given the total length up front so
+//! that the result is identical to running AESDataProcess() followed by
+//! SHAMD5DataProcess() or SHAMD5HMACProcess() over the whole buffer; see
+//! AESMACEncryptSerial().
+//!
+//! AESMACDMAConfigure() must have been called before using this function.
+//! Both buffers must be in SRAM and word aligned, and the AES and SHA/MD5
+//! modules must not be used by anything else until this function returns.
+//!
+//! \return Returns \b true if the data was processed successfully.
+//
+//*****************************************************************************
+bool
+AESMACEncrypt(const tAESMACConfig *psConfig, uint32_t *pui32Src,
+              uint32_t *pui32Dest, uint32_t ui32Length,
+              uint32_t ui32ChunkSize, uint32_t *pui32Tag)
+{
+    uint32_t ui32Offset, ui32Count, ui32Next, ui32NextCount, ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig != 0);
+    ASSERT((ui32Length != 0) && ((ui32Length % 16) == 0));
+    ASSERT((ui32ChunkSize != 0) && ((ui32ChunkSize % 64) == 0) &&
+           (ui32ChunkSize <= AESMAC_CHUNK_MAX));
+
+    //
+    // Load both contexts.
+    //
+    _AESMACConfigure(psConfig);
+
+    //
+    // Let the engines request their data from the uDMA controller.
+    //
+    AESDMAEnable(AES_BASE, AES_DMA_DATA_IN);
+    AESDMAEnable(AES_BASE, AES_DMA_DATA_OUT);
+    SHAMD5DMAEnable(SHAMD5_BASE);
+
+    //
+    // Write both lengths, which starts both engines using their contexts.
+    // Giving the SHA/MD5 module the total length lets it close the hash on
+    // its own once the last byte has been written.
+    //
+    AESLengthSet(AES_BASE, (uint64_t)ui32Length);
+    SHAMD5HashLengthSet(SHAMD5_BASE, ui32Length);
+
+    //
+    // Prime the pipeline with the first chunk.
+    //
+    ui32Offset = 0;
+    ui32Count = (ui32Length < ui32ChunkSize) ? ui32Length : ui32ChunkSize;
+    _AESMACAESStart(pui32Src, pui32Dest, ui32Count);
+
+    //
+    // Loop until every chunk has been encrypted.
+    //
+    while(ui32Offset < ui32Length)
+    {
+        //
+        // Wait for the AES module to finish the current chunk.
+        //
+        while(uDMAChannelIsEnabled(UDMA_CH15_AES0DOUT))
+        {
+        }
+
+        //
+        // Immediately start encrypting the next chunk, if there is one.
+        //
+        ui32Next = ui32Offset + ui32Count;
+        ui32NextCount = ui32Length - ui32Next;
+        if(ui32NextCount > ui32ChunkSize)
+        {
+            ui32NextCount = ui32ChunkSize;
+        }
+        if(ui32NextCount)
+        {
+            _AESMACAESStart(pui32Src + (ui32Next / 4),
+                            pui32Dest + (ui32Next / 4), ui32NextCount);
+        }
+
+        //
+        // Wait for the SHA/MD5 module to take the previous chunk and then
+        // hand it the whole blocks of the chunk that was just encrypted.
+        // Only the final chunk can end in a partial block.
+        //
+        while(uDMAChannelIsEnabled(UDMA_CH5_SHAMD50DIN))
+        {
+        }
+        if(ui32Count & ~63)
+        {
+            _AESMACSHAMD5Start(pui32Dest + (ui32Offset / 4), ui32Count & ~63);
+        }
+
+        //
+        // Advance to the next chunk.
+        //
+        ui32Offset = ui32Next;
+        ui32Count = ui32NextCount;
+    }
+
+    //
+    // Wait for the last hash transfer and return the engines to CPU control.
+    //
+    while(uDMAChannelIsEnabled(UDMA_CH5_SHAMD50DIN))
+    {
+    }
+    AESDMADisable(AES_BASE, AES_DMA_DATA_IN);
+    AESDMADisable(AES_BASE, AES_DMA_DATA_OUT);
+    SHAMD5DMADisable(SHAMD5_BASE);
+
+    //
+    // Write any trailing partial block by hand, as done by
+    // SHAMD5DataProcess().
+    //
+    if(ui32Length % 64)
+    {
+        while((HWREG(SHAMD5_BASE + SHAMD5_O_IRQSTATUS) &
+               SHAMD5_INT_INPUT_READY) == 0)
+        {
+        }
+        for(ui32Idx = ui32Length & ~63; ui32Idx < ui32Length; ui32Idx += 4)
+        {
+            HWREG(SHAMD5_BASE + SHAMD5_O_DATA_0_IN + (ui32Idx % 64)) =
+                pui32Dest[ui32Idx / 4];
+        }
+    }
+
+    //
+    // Wait for the output to be ready and read the result.
+    //
+    while((HWREG(SHAMD5_BASE + SHAMD5_O_IRQSTATUS) &
+           SHAMD5_INT_OUTPUT_READY) == 0)
+    {
+    }
+    SHAMD5ResultRead(SHAMD5_BASE, pui32Tag);
+
+    //
+    // Return true to indicate successful completion of the function.
+    //
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Encrypts data and then hashes the ciphertext, one engine after the other.
+//!
+//! \param psConfig is a pointer to the AES and SHA/MD5 configuration.
+//! \param pui32Src is a pointer to the plaintext.
+//! \param pui32Dest is a pointer to the buffer that receives the ciphertext.
+//! \param ui32Length is the length of the data in bytes.  It must be a
+//! non-zero multiple of 16, and a multiple of 64 when a plain (non-HMAC)
+//! hash algorithm is selected.
+//! \param pui32Tag is a pointer to the array that receives the hash result.
+//!
+//! This function is the reference implementation of AESMACEncrypt().  It
+//! runs AESDataProcess() over the whole buffer and then SHAMD5DataProcess()
+//! or SHAMD5HMACProcess() over the ciphertext, with the CPU polling both
+//! engines.
+//!
+//! \return Returns \b true if the data was processed successfully.
+//
+//*****************************************************************************
+bool
+AESMACEncryptSerial(const tAESMACConfig *psConfig, uint32_t *pui32Src,
+                    uint32_t *pui32Dest, uint32_t ui32Length,
+                    uint32_t *pui32Tag)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig != 0);
+    ASSERT((ui32Length != 0) && ((ui32Length % 16) == 0));
+
+    //
+    // Load both contexts.
+    //
+    _AESMACConfigure(psConfig);
+
+    //
+    // Encrypt the whole buffer.
+    //
+    if(!AESDataProcess(AES_BASE, pui32Src, pui32Dest, ui32Length))
+    {
+        return(false);
+    }
+
+    //
+    // Hash the ciphertext.
+    //
+    if(psConfig->ui32HashAlgo & SHAMD5_MODE_ALGO_CONSTANT)
+    {
+        SHAMD5DataProcess(SHAMD5_BASE, pui32Dest, ui32Length, pui32Tag);
+    }
+    else
+    {
+        SHAMD5HMACProcess(SHAMD5_BASE, pui32Dest, ui32Length, pui32Tag);
+    }
+
+    //
+    // Return true to indicate successful completion of the function.
+    //
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Measures the throughput gain of the pipelined encrypt-then-MAC path.
+//!
+//! \param psConfig is a pointer to the AES and SHA/MD5 configuration.
+//! \param pui32Src is a pointer to the plaintext.
+//! \param pui32Dest is a pointer to the buffer that receives the ciphertext
+//! from AESMACEncrypt().
+//! \param pui32Scratch is a pointer to a buffer of \e ui32Length bytes that
+//! receives the ciphertext from AESMACEncryptSerial().
+//! \param ui32Length is the length of the data in bytes.
+//! \param ui32ChunkSize is the chunk size passed to AESMACEncrypt().
+//! \param psResult is a pointer to the structure that receives the results.
+//!
+//! This function runs AESMACEncryptSerial() and AESMACEncrypt() on the same
+//! input, timing each with DelayCountGet(), and reports the cycle counts,
+//! the throughput gain of the pipelined path in percent and whether the two
+//! paths produced identical ciphertext and tags.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AESMACBenchmark(const tAESMACConfig *psConfig, uint32_t *pui32Src,
+                uint32_t *pui32Dest, uint32_t *pui32Scratch,
+                uint32_t ui32Length, uint32_t ui32ChunkSize,
+                tAESMACBenchmark *psResult)
+{
+    uint32_t pui32SerialTag[8], pui32Tag[8];
+    uint32_t ui32Start, ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psResult != 0);
+
+    //
+    // Clear the tags so that words not written by a short digest compare
+    // equal.
+    //
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        pui32SerialTag[ui32Idx] = 0;
+        pui32Tag[ui32Idx] = 0;
+    }
+
+    //
+    // Make sure the cycle counter is running.
+    //
+    DelayInit();
+
+    //
+    // Time the sequential path.
+    //
+    ui32Start = DelayCountGet();
+    AESMACEncryptSerial(psConfig, pui32Src, pui32Scratch, ui32Length,
+                        pui32SerialTag);
+    psResult->ui32SerialCycles = DelayCountGet() - ui32Start;
+
+    //
+    // Time the pipelined path.
+    //
+    ui32Start = DelayCountGet();
+    AESMACEncrypt(psConfig, pui32Src, pui32Dest, ui32Length, ui32ChunkSize,
+                  pui32Tag);
+    psResult->ui32PipelinedCycles = DelayCountGet() - ui32Start;
+
+    //
+    // Compute the gain as the ratio of the two throughputs.
+    //
+    if(psResult->ui32PipelinedCycles)
+    {
+        psResult->i32GainPercent =
+            (int32_t)(((uint64_t)psResult->ui32SerialCycles * 100) /
+                      psResult->ui32PipelinedCycles) - 100;
+    }
+    else
+    {
+        psResult->i32GainPercent = 0;
+    }
+
+    //
+    // Compare the outputs of both paths.
+    //
+    psResult->bMatch = true;
+    for(ui32Idx = 0; ui32Idx < (ui32Length / 4); ui32Idx++)
+    {
+        if(pui32Dest[ui32Idx] != pui32Scratch[ui32Idx])
+        {
+            psResult->bMatch = false;
+        }
+    }
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        if(pui32Tag[ui32Idx] != pui32SerialTag[ui32Idx])
+        {
+            psResult->bMatch = false;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
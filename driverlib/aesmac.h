@@ -0,0 +1,164 @@
+//*****************************************************************************
+//
+// aesmac.h - Prototypes for the pipelined AES encrypt-then-MAC driver.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_AESMAC_H__
+#define __DRIVERLIB_AESMAC_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The largest chunk, in bytes, that can be passed to AESMACEncrypt().  This
+// is bounded by the 1024-item limit of a single basic-mode uDMA transfer.
+//
+//*****************************************************************************
+#define AESMAC_CHUNK_MAX        4096
+
+//*****************************************************************************
+//
+//! This structure describes the AES and SHA/MD5 configuration used for an
+//! encrypt-then-MAC operation.  The same structure is used by both the
+//! pipelined and the sequential implementation so that their results can be
+//! compared directly.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The value passed to AESConfigSet().  It must select encryption and one
+    //! of the non-authenticating modes (ECB, CBC, CTR, ICM or CFB).
+    //
+    uint32_t ui32AESConfig;
+
+    //
+    //! The AES key, in the format expected by AESKey1Set().
+    //
+    uint32_t *pui32Key;
+
+    //
+    //! The key size passed to AESKey1Set(); one of the
+    //! \b AES_CFG_KEY_SIZE_* values.
+    //
+    uint32_t ui32KeySize;
+
+    //
+    //! The 4-word initial vector, or 0 for modes that do not use one.
+    //
+    uint32_t *pui32IV;
+
+    //
+    //! The value passed to SHAMD5ConfigSet(); one of the \b SHAMD5_ALGO_*
+    //! values.
+    //
+    uint32_t ui32HashAlgo;
+
+    //
+    //! The 16-word HMAC key passed to SHAMD5HMACKeySet() when
+    //! \e ui32HashAlgo selects an HMAC algorithm, otherwise ignored.
+    //
+    uint32_t *pui32HMACKey;
+}
+tAESMACConfig;
+
+//*****************************************************************************
+//
+//! This structure holds the results of AESMACBenchmark().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of processor cycles taken by AESMACEncryptSerial().
+    //
+    uint32_t ui32SerialCycles;
+
+    //
+    //! The number of processor cycles taken by AESMACEncrypt().
+    //
+    uint32_t ui32PipelinedCycles;
+
+    //
+    //! The throughput gain of the pipelined path over the sequential path, in
+    //! percent.
+    //
+    int32_t i32GainPercent;
+
+    //
+    //! Set to \b true if both paths produced identical ciphertext and tags.
+    //
+    bool bMatch;
+}
+tAESMACBenchmark;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void AESMACDMAConfigure(void);
+extern bool AESMACEncrypt(const tAESMACConfig *psConfig, uint32_t *pui32Src,
+                          uint32_t *pui32Dest, uint32_t ui32Length,
+                          uint32_t ui32ChunkSize, uint32_t *pui32Tag);
+extern bool AESMACEncryptSerial(const tAESMACConfig *psConfig,
+                                uint32_t *pui32Src, uint32_t *pui32Dest,
+                                uint32_t ui32Length, uint32_t *pui32Tag);
+extern void AESMACBenchmark(const tAESMACConfig *psConfig, uint32_t *pui32Src,
+                            uint32_t *pui32Dest, uint32_t *pui32Scratch,
+                            uint32_t ui32Length, uint32_t ui32ChunkSize,
+                            tAESMACBenchmark *psResult);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_AESMAC_H__
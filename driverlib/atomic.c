@@ -0,0 +1,554 @@
+//*****************************************************************************
+//
+// atomic.c - Critical section and atomic primitives.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup atomic_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_types.h"
+#include "driverlib/atomic.h"
+#include "driverlib/cpu.h"
+#include "driverlib/debug.h"
+#include "driverlib/interrupt.h"
+
+//*****************************************************************************
+//
+// The priority ceiling used by AtomicEnter().  Interrupts with this priority
+// or a lower one (a numerically equal or greater value) are held off inside
+// a critical section; the default leaves only priority 0 running.
+//
+//*****************************************************************************
+static uint32_t g_ui32AtomicCeiling = 1 << (8 - NUM_PRIORITY_BITS);
+
+//*****************************************************************************
+//
+//! Sets the priority ceiling of driver critical sections.
+//!
+//! \param ui32Priority is the highest interrupt priority that is held off by
+//! AtomicEnter(), in the format used by IntPrioritySet().
+//!
+//! This function chooses which interrupts may run during the critical
+//! sections of drivers that use AtomicEnter().  Interrupts with a higher
+//! priority than \e ui32Priority (a numerically smaller value) are never
+//! blocked, which keeps their latency independent of driver bookkeeping.
+//! Such interrupt handlers must not call driver functions that use
+//! AtomicEnter() or touch the data that those functions protect.
+//!
+//! The ceiling cannot be 0, since a BASEPRI value of 0 does not mask any
+//! interrupt.  The default ceiling is the second highest priority level so
+//! that only interrupts at priority 0 are exempt.
+//!
+//! \b Example: Keep the PWM fault interrupt running in critical sections.
+//!
+//! \verbatim
+//! IntPrioritySet(INT_PWM0_FAULT, 0x00);
+//! IntPrioritySet(INT_PWM0_0, 0x20);
+//! AtomicCeilingSet(0x40);
+//! \endverbatim
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AtomicCeilingSet(uint32_t ui32Priority)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Priority != 0);
+    ASSERT((ui32Priority & ~INT_PRIORITY_MASK) == 0);
+
+    g_ui32AtomicCeiling = ui32Priority;
+}
+
+//*****************************************************************************
+//
+//! Gets the priority ceiling of driver critical sections.
+//!
+//! \return Returns the priority ceiling set with AtomicCeilingSet().
+//
+//*****************************************************************************
+uint32_t
+AtomicCeilingGet(void)
+{
+    return(g_ui32AtomicCeiling);
+}
+
+//*****************************************************************************
+//
+//! Enters a driver critical section.
+//!
+//! This function raises the execution priority to the ceiling set with
+//! AtomicCeilingSet() by way of the BASEPRI register, so that interrupts at or
+//! below the ceiling are held off while interrupts above it continue to be
+//! taken.  Unlike IntMasterDisable(), this does not block the interrupts that
+//! motor control and fault handling depend on.
+//!
+//! Critical sections may be nested, and may be entered from interrupt
+//! handlers at or below the ceiling; the execution priority is never lowered
+//! by entering a section.  Each call must be paired with a call to
+//! AtomicExit() that is passed the returned key.
+//!
+//! \b Example: Update a shared structure.
+//!
+//! \verbatim
+//! uint32_t ui32Key;
+//!
+//! ui32Key = AtomicEnter();
+//! g_sState.ui32Count++;
+//! g_sState.ui32Last = ui32Value;
+//! AtomicExit(ui32Key);
+//! \endverbatim
+//!
+//! \return Returns the key to pass to AtomicExit().
+//
+//*****************************************************************************
+uint32_t
+AtomicEnter(void)
+{
+    return(CPUbasepriRaise(g_ui32AtomicCeiling));
+}
+
+//*****************************************************************************
+//
+//! Enters a critical section with an explicit priority ceiling.
+//!
+//! \param ui32Priority is the highest interrupt priority that is held off, in
+//! the format used by IntPrioritySet().
+//!
+//! This function behaves as AtomicEnter() but uses \e ui32Priority as the
+//! ceiling.  It is intended for data that is shared with an interrupt handler
+//! whose priority is known, so that only the interrupts that may touch the
+//! data are held off.
+//!
+//! \return Returns the key to pass to AtomicExit().
+//
+//*****************************************************************************
+uint32_t
+AtomicEnterPriority(uint32_t ui32Priority)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Priority != 0);
+    ASSERT((ui32Priority & ~INT_PRIORITY_MASK) == 0);
+
+    return(CPUbasepriRaise(ui32Priority));
+}
+
+//*****************************************************************************
+//
+//! Leaves a critical section.
+//!
+//! \param ui32Key is the value returned by the matching AtomicEnter() or
+//! AtomicEnterPriority().
+//!
+//! This function restores the execution priority that was in effect when the
+//! critical section was entered.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AtomicExit(uint32_t ui32Key)
+{
+    CPUbasepriSet(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Atomically adds to a counter.
+//!
+//! \param pui32Value is a pointer to the counter.
+//! \param i32Delta is the amount to add, which may be negative.
+//!
+//! This function performs a read-modify-write of \e pui32Value using the
+//! LDREX and STREX instructions, retrying if an interrupt handler modified the
+//! counter in between.  No interrupts are masked.
+//!
+//! \return Returns the new value of the counter.
+//
+//*****************************************************************************
+uint32_t
+AtomicAdd(volatile uint32_t *pui32Value, int32_t i32Delta)
+{
+    uint32_t ui32New;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui32Value != 0);
+
+    do
+    {
+        ui32New = CPUldrex(pui32Value) + (uint32_t)i32Delta;
+    }
+    while(CPUstrex(ui32New, pui32Value));
+
+    return(ui32New);
+}
+
+//*****************************************************************************
+//
+//! Atomically replaces a value if it has not changed.
+//!
+//! \param pui32Value is a pointer to the value.
+//! \param ui32Expected is the value that \e pui32Value must hold.
+//! \param ui32New is the value to store.
+//!
+//! This function stores \e ui32New in \e pui32Value if, and only if, it
+//! currently holds \e ui32Expected, as a single atomic operation.
+//!
+//! \return Returns \b true if the value was replaced or \b false if it did
+//! not hold \e ui32Expected.
+//
+//*****************************************************************************
+bool
+AtomicCompareExchange(volatile uint32_t *pui32Value, uint32_t ui32Expected,
+                      uint32_t ui32New)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui32Value != 0);
+
+    do
+    {
+        if(CPUldrex(pui32Value) != ui32Expected)
+        {
+            CPUclrex();
+            return(false);
+        }
+    }
+    while(CPUstrex(ui32New, pui32Value));
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Atomically sets flags.
+//!
+//! \param pui32Flags is a pointer to the flag word.
+//! \param ui32Flags is the bit mask of the flags to set.
+//!
+//! This function ORs \e ui32Flags into \e pui32Flags as a single atomic
+//! operation.
+//!
+//! \return Returns the flag word before it was modified, so that the caller
+//! can tell whether it was the one to set a flag.
+//
+//*****************************************************************************
+uint32_t
+AtomicFlagSet(volatile uint32_t *pui32Flags, uint32_t ui32Flags)
+{
+    uint32_t ui32Old;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui32Flags != 0);
+
+    do
+    {
+        ui32Old = CPUldrex(pui32Flags);
+    }
+    while(CPUstrex(ui32Old | ui32Flags, pui32Flags));
+
+    return(ui32Old);
+}
+
+//*****************************************************************************
+//
+//! Atomically clears flags.
+//!
+//! \param pui32Flags is a pointer to the flag word.
+//! \param ui32Flags is the bit mask of the flags to clear.
+//!
+//! This function clears \e ui32Flags in \e pui32Flags as a single atomic
+//! operation.  Since the previous flag word is returned, this can be used to
+//! test and consume an event flag that is set from an interrupt handler.
+//!
+//! \return Returns the flag word before it was modified.
+//
+//*****************************************************************************
+uint32_t
+AtomicFlagClear(volatile uint32_t *pui32Flags, uint32_t ui32Flags)
+{
+    uint32_t ui32Old;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui32Flags != 0);
+
+    do
+    {
+        ui32Old = CPUldrex(pui32Flags);
+    }
+    while(CPUstrex(ui32Old & ~ui32Flags, pui32Flags));
+
+    return(ui32Old);
+}
+
+//*****************************************************************************
+//
+//! Initializes a lock-free queue.
+//!
+//! \param psQueue is a pointer to the queue.
+//! \param psEntries is a pointer to the array of entries that holds the queued
+//! values.
+//! \param ui32NumEntries is the number of entries in \e psEntries, which must
+//! be a power of two and at least two.
+//!
+//! This function prepares a bounded queue of 32-bit values that can be used
+//! by any number of producers and consumers without disabling interrupts.
+//! Each entry carries a sequence number; a producer claims an entry by
+//! advancing the head with AtomicCompareExchange(), writes the value, and then
+//! publishes it by updating the sequence number, and consumers work the same
+//! way at the tail.  A producer or consumer that is preempted never blocks
+//! the interrupt that preempted it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AtomicQueueInit(tAtomicQueue *psQueue, tAtomicQueueEntry *psEntries,
+                uint32_t ui32NumEntries)
+{
+    uint32_t ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psQueue != 0);
+    ASSERT(psEntries != 0);
+    ASSERT(ui32NumEntries >= 2);
+    ASSERT((ui32NumEntries & (ui32NumEntries - 1)) == 0);
+
+    for(ui32Idx = 0; ui32Idx < ui32NumEntries; ui32Idx++)
+    {
+        psEntries[ui32Idx].ui32Seq = ui32Idx;
+    }
+
+    psQueue->psEntries = psEntries;
+    psQueue->ui32Mask = ui32NumEntries - 1;
+    psQueue->ui32Head = 0;
+    psQueue->ui32Tail = 0;
+}
+
+//*****************************************************************************
+//
+//! Puts a value into a lock-free queue.
+//!
+//! \param psQueue is a pointer to the queue.
+//! \param ui32Data is the value to put.
+//!
+//! This function may be called from any context, including interrupt handlers
+//! above the critical section ceiling.
+//!
+//! \note A queue that has a get in progress in a preempted context may be
+//! reported as full until that get completes.
+//!
+//! \return Returns \b true if the value was queued or \b false if the queue
+//! is full.
+//
+//*****************************************************************************
+bool
+AtomicQueuePut(tAtomicQueue *psQueue, uint32_t ui32Data)
+{
+    tAtomicQueueEntry *psEntry;
+    uint32_t ui32Pos;
+    int32_t i32Diff;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psQueue != 0);
+
+    //
+    // Claim the entry at the head of the queue.
+    //
+    while(1)
+    {
+        ui32Pos = psQueue->ui32Head;
+        psEntry = &psQueue->psEntries[ui32Pos & psQueue->ui32Mask];
+        i32Diff = (int32_t)(psEntry->ui32Seq - ui32Pos);
+
+        if(i32Diff == 0)
+        {
+            //
+            // The entry is free; stop if no other producer claimed it first.
+            //
+            if(AtomicCompareExchange(&psQueue->ui32Head, ui32Pos,
+                                     ui32Pos + 1))
+            {
+                break;
+            }
+        }
+        else if(i32Diff < 0)
+        {
+            //
+            // The entry has not been consumed yet, so the queue is full.
+            //
+            return(false);
+        }
+    }
+
+    //
+    // Store the value and then publish it to the consumers.
+    //
+    psEntry->ui32Data = ui32Data;
+    psEntry->ui32Seq = ui32Pos + 1;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Gets a value from a lock-free queue.
+//!
+//! \param psQueue is a pointer to the queue.
+//! \param pui32Data is a pointer to the location that receives the value.
+//!
+//! This function may be called from any context, including interrupt handlers
+//! above the critical section ceiling.
+//!
+//! \note A queue that has a put in progress in a preempted context may be
+//! reported as empty until that put completes.
+//!
+//! \return Returns \b true if a value was returned or \b false if the queue
+//! is empty.
+//
+//*****************************************************************************
+bool
+AtomicQueueGet(tAtomicQueue *psQueue, uint32_t *pui32Data)
+{
+    tAtomicQueueEntry *psEntry;
+    uint32_t ui32Pos;
+    int32_t i32Diff;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psQueue != 0);
+    ASSERT(pui32Data != 0);
+
+    //
+    // Claim the entry at the tail of the queue.
+    //
+    while(1)
+    {
+        ui32Pos = psQueue->ui32Tail;
+        psEntry = &psQueue->psEntries[ui32Pos & psQueue->ui32Mask];
+        i32Diff = (int32_t)(psEntry->ui32Seq - (ui32Pos + 1));
+
+        if(i32Diff == 0)
+        {
+            //
+            // The entry holds data; stop if no other consumer claimed it
+            // first.
+            //
+            if(AtomicCompareExchange(&psQueue->ui32Tail, ui32Pos,
+                                     ui32Pos + 1))
+            {
+                break;
+            }
+        }
+        else if(i32Diff < 0)
+        {
+            //
+            // The entry has not been filled yet, so the queue is empty.
+            //
+            return(false);
+        }
+    }
+
+    //
+    // Read the value and then hand the entry back to the producers for the
+    // next pass around the queue.
+    //
+    *pui32Data = psEntry->ui32Data;
+    psEntry->ui32Seq = ui32Pos + psQueue->ui32Mask + 1;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Gets the number of values in a lock-free queue.
+//!
+//! \param psQueue is a pointer to the queue.
+//!
+//! The count includes values whose put or get is still in progress, and may
+//! be out of date as soon as it is returned if other contexts use the queue.
+//!
+//! \return Returns the number of values in the queue.
+//
+//*****************************************************************************
+uint32_t
+AtomicQueueCount(tAtomicQueue *psQueue)
+{
+    uint32_t ui32Tail;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psQueue != 0);
+
+    //
+    // Read the tail first so that the count cannot appear negative.
+    //
+    ui32Tail = psQueue->ui32Tail;
+
+    return(psQueue->ui32Head - ui32Tail);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,138 @@
+//*****************************************************************************
+//
+// atomic.h - Prototypes for critical section and atomic primitives.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_ATOMIC_H__
+#define __DRIVERLIB_ATOMIC_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! An entry of a lock-free queue.  The application provides an array of
+//! these to AtomicQueueInit(); its contents are managed by the queue.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The sequence number that tells producers and consumers whether the
+    //! entry is free or holds data.
+    //
+    volatile uint32_t ui32Seq;
+
+    //
+    //! The data held in the entry.
+    //
+    volatile uint32_t ui32Data;
+}
+tAtomicQueueEntry;
+
+//*****************************************************************************
+//
+//! A bounded, lock-free queue of 32-bit values.  Any number of producers and
+//! consumers, at any interrupt priority, may use the queue at the same time.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The array of entries.
+    //
+    tAtomicQueueEntry *psEntries;
+
+    //
+    //! The number of entries minus one.
+    //
+    uint32_t ui32Mask;
+
+    //
+    //! The position at which the next value is put.
+    //
+    volatile uint32_t ui32Head;
+
+    //
+    //! The position from which the next value is taken.
+    //
+    volatile uint32_t ui32Tail;
+}
+tAtomicQueue;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void AtomicCeilingSet(uint32_t ui32Priority);
+extern uint32_t AtomicCeilingGet(void);
+extern uint32_t AtomicEnter(void);
+extern uint32_t AtomicEnterPriority(uint32_t ui32Priority);
+extern void AtomicExit(uint32_t ui32Key);
+extern uint32_t AtomicAdd(volatile uint32_t *pui32Value, int32_t i32Delta);
+extern bool AtomicCompareExchange(volatile uint32_t *pui32Value,
+                                  uint32_t ui32Expected, uint32_t ui32New);
+extern uint32_t AtomicFlagSet(volatile uint32_t *pui32Flags,
+                              uint32_t ui32Flags);
+extern uint32_t AtomicFlagClear(volatile uint32_t *pui32Flags,
+                                uint32_t ui32Flags);
+extern void AtomicQueueInit(tAtomicQueue *psQueue,
+                            tAtomicQueueEntry *psEntries,
+                            uint32_t ui32NumEntries);
+extern bool AtomicQueuePut(tAtomicQueue *psQueue, uint32_t ui32Data);
+extern bool AtomicQueueGet(tAtomicQueue *psQueue, uint32_t *pui32Data);
+extern uint32_t AtomicQueueCount(tAtomicQueue *psQueue);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_ATOMIC_H__
@@ -0,0 +1,629 @@
+//*****************************************************************************
+//
+// clkgov.c - System clock frequency governor.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup clkgov_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/clkgov.h"
+#include "driverlib/debug.h"
+#include "driverlib/i2c.h"
+#include "driverlib/ssi.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/uart.h"
+
+//*****************************************************************************
+//
+// The clock levels supplied to ClkGovInit(), in order of increasing
+// frequency, and the CPU load target in percent.
+//
+//*****************************************************************************
+static const tClkGovLevel *g_psClkGovLevels;
+static uint32_t g_ui32ClkGovNumLevels;
+static uint32_t g_ui32ClkGovLoadTarget;
+
+//*****************************************************************************
+//
+// The current clock level and the system clock frequency that it produced.
+//
+//*****************************************************************************
+static uint32_t g_ui32ClkGovLevel;
+static uint32_t g_ui32ClkGovClock;
+
+//*****************************************************************************
+//
+// The list of clients notified of clock changes.
+//
+//*****************************************************************************
+static tClkGovClient *g_psClkGovClients;
+
+//*****************************************************************************
+//
+// Calls the notification function of every registered client.
+//
+//*****************************************************************************
+static void
+_ClkGovNotify(uint32_t ui32Event, uint32_t ui32SysClock)
+{
+    tClkGovClient *psClient;
+
+    for(psClient = g_psClkGovClients; psClient; psClient = psClient->psNext)
+    {
+        psClient->pfnNotify(ui32Event, ui32SysClock, psClient->pvCBData);
+    }
+}
+
+//*****************************************************************************
+//
+// Re-clocks a UART.  UARTConfigSetExpClk() waits for the transmitter to
+// drain before it disables the UART, so nothing is needed before the change
+// other than letting the current character finish.
+//
+//*****************************************************************************
+static void
+_ClkGovUARTNotify(uint32_t ui32Event, uint32_t ui32SysClock, void *pvCBData)
+{
+    tClkGovPeriph *psPeriph = pvCBData;
+
+    if(ui32Event == CLKGOV_EVENT_PRECHANGE)
+    {
+        while(UARTBusy(psPeriph->ui32Base))
+        {
+        }
+    }
+    else
+    {
+        UARTConfigSetExpClk(psPeriph->ui32Base, ui32SysClock,
+                            psPeriph->ui32Rate, psPeriph->ui32Config);
+    }
+}
+
+//*****************************************************************************
+//
+// Re-clocks an SSI.  The SSI must be idle and disabled while its clock
+// prescaler is changed.
+//
+//*****************************************************************************
+static void
+_ClkGovSSINotify(uint32_t ui32Event, uint32_t ui32SysClock, void *pvCBData)
+{
+    tClkGovPeriph *psPeriph = pvCBData;
+
+    if(ui32Event == CLKGOV_EVENT_PRECHANGE)
+    {
+        while(SSIBusy(psPeriph->ui32Base))
+        {
+        }
+        SSIDisable(psPeriph->ui32Base);
+    }
+    else
+    {
+        SSIConfigSetExpClk(psPeriph->ui32Base, ui32SysClock,
+                           psPeriph->ui32Config, psPeriph->ui32Mode,
+                           psPeriph->ui32Rate, psPeriph->ui32Width);
+        SSIEnable(psPeriph->ui32Base);
+    }
+}
+
+//*****************************************************************************
+//
+// Re-clocks an I2C master.  The current transfer is allowed to finish before
+// the clock changes.
+//
+//*****************************************************************************
+static void
+_ClkGovI2CNotify(uint32_t ui32Event, uint32_t ui32SysClock, void *pvCBData)
+{
+    tClkGovPeriph *psPeriph = pvCBData;
+
+    if(ui32Event == CLKGOV_EVENT_PRECHANGE)
+    {
+        while(I2CMasterBusy(psPeriph->ui32Base))
+        {
+        }
+    }
+    else
+    {
+        I2CMasterInitExpClk(psPeriph->ui32Base, ui32SysClock,
+                            psPeriph->ui32Config ? true : false);
+    }
+}
+
+//*****************************************************************************
+//
+// Reloads a timer so that it keeps its frequency at the new system clock.
+//
+//*****************************************************************************
+static void
+_ClkGovTimerNotify(uint32_t ui32Event, uint32_t ui32SysClock, void *pvCBData)
+{
+    tClkGovPeriph *psPeriph = pvCBData;
+
+    if(ui32Event == CLKGOV_EVENT_POSTCHANGE)
+    {
+        TimerLoadSet(psPeriph->ui32Base, psPeriph->ui32Config,
+                     (ui32SysClock / psPeriph->ui32Rate) - 1);
+    }
+}
+
+//*****************************************************************************
+//
+// Fills in the notification client of a peripheral and registers it.
+//
+//*****************************************************************************
+static void
+_ClkGovPeriphRegister(tClkGovPeriph *psPeriph,
+                      void (*pfnNotify)(uint32_t ui32Event,
+                                        uint32_t ui32SysClock,
+                                        void *pvCBData))
+{
+    psPeriph->sClient.pfnNotify = pfnNotify;
+    psPeriph->sClient.pvCBData = psPeriph;
+    ClkGovRegister(&psPeriph->sClient);
+
+    //
+    // Configure the peripheral for the current clock.
+    //
+    pfnNotify(CLKGOV_EVENT_PRECHANGE, g_ui32ClkGovClock, psPeriph);
+    pfnNotify(CLKGOV_EVENT_POSTCHANGE, g_ui32ClkGovClock, psPeriph);
+}
+
+//*****************************************************************************
+//
+//! Initializes the clock governor.
+//!
+//! \param psLevels is a pointer to the clock levels the governor may select.
+//! \param ui32NumLevels is the number of entries in \e psLevels.
+//! \param ui32Level is the index of the level to start at.
+//! \param ui32LoadTarget is the highest CPU load, in percent, that
+//! ClkGovUpdate() allows before moving to a faster level.
+//!
+//! This function records the clock levels and switches the system clock to
+//! \e ui32Level.  The levels must be listed in order of increasing
+//! \e ui32SysClock and the array must remain valid while the governor is in
+//! use.  A battery-powered design might, for example, provide a 16-MHz
+//! level that runs directly from the PIOSC with the PLL powered down and a
+//! 120-MHz level that runs from the PLL.
+//!
+//! Each level is entered with SysCtlClockFreqSet(), which also programs the
+//! flash and EEPROM memory timing for the new frequency.
+//!
+//! \note This function cannot be used with TM4C123 devices.
+//!
+//! \return Returns the system clock frequency in Hz, or zero if the level
+//! could not be entered.
+//
+//*****************************************************************************
+uint32_t
+ClkGovInit(const tClkGovLevel *psLevels, uint32_t ui32NumLevels,
+           uint32_t ui32Level, uint32_t ui32LoadTarget)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psLevels != 0);
+    ASSERT(ui32NumLevels != 0);
+    ASSERT(ui32Level < ui32NumLevels);
+    ASSERT((ui32LoadTarget != 0) && (ui32LoadTarget <= 100));
+
+    g_psClkGovLevels = psLevels;
+    g_ui32ClkGovNumLevels = ui32NumLevels;
+    g_ui32ClkGovLoadTarget = ui32LoadTarget;
+    g_ui32ClkGovLevel = ui32Level;
+    g_ui32ClkGovClock = 0;
+    g_psClkGovClients = 0;
+
+    //
+    // Enter the starting level.  There are no clients yet, so this is a
+    // plain clock change.
+    //
+    g_ui32ClkGovClock = SysCtlClockFreqSet(psLevels[ui32Level].ui32Config,
+                                           psLevels[ui32Level].ui32SysClock);
+
+    return(g_ui32ClkGovClock);
+}
+
+//*****************************************************************************
+//
+//! Registers a driver for clock change notification.
+//!
+//! \param psClient is a pointer to the client to register.
+//!
+//! This function adds \e psClient to the list of clients that are notified
+//! before and after each change of the system clock.  The notification
+//! function must set up its peripheral for the new frequency in the
+//! \b CLKGOV_EVENT_POSTCHANGE event.  It may use the
+//! \b CLKGOV_EVENT_PRECHANGE event to finish or pause any transfer in
+//! progress.  Clients are notified in reverse order of registration.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovRegister(tClkGovClient *psClient)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psClient != 0);
+    ASSERT(psClient->pfnNotify != 0);
+
+    psClient->psNext = g_psClkGovClients;
+    g_psClkGovClients = psClient;
+}
+
+//*****************************************************************************
+//
+//! Unregisters a driver from clock change notification.
+//!
+//! \param psClient is a pointer to the client to remove.
+//!
+//! This function removes \e psClient from the list of notified clients.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovUnregister(tClkGovClient *psClient)
+{
+    tClkGovClient **ppsLink;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psClient != 0);
+
+    for(ppsLink = &g_psClkGovClients; *ppsLink;
+        ppsLink = &(*ppsLink)->psNext)
+    {
+        if(*ppsLink == psClient)
+        {
+            *ppsLink = psClient->psNext;
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Configures a UART and keeps its baud rate across clock changes.
+//!
+//! \param psPeriph is a pointer to the structure that holds the settings.
+//! \param ui32Base is the base address of the UART.
+//! \param ui32Baud is the baud rate.
+//! \param ui32Config is the data format, as for UARTConfigSetExpClk().
+//!
+//! This function configures the UART for the current system clock and
+//! registers it so that it is configured again with UARTConfigSetExpClk()
+//! after every clock change.  Before the change the governor waits for the
+//! UART to finish transmitting.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovUARTRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                   uint32_t ui32Baud, uint32_t ui32Config)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psPeriph != 0);
+    ASSERT(ui32Baud != 0);
+
+    psPeriph->ui32Base = ui32Base;
+    psPeriph->ui32Rate = ui32Baud;
+    psPeriph->ui32Config = ui32Config;
+    _ClkGovPeriphRegister(psPeriph, _ClkGovUARTNotify);
+}
+
+//*****************************************************************************
+//
+//! Configures an SSI and keeps its bit rate across clock changes.
+//!
+//! \param psPeriph is a pointer to the structure that holds the settings.
+//! \param ui32Base is the base address of the SSI.
+//! \param ui32Protocol is the data transfer protocol.
+//! \param ui32Mode is the mode of operation.
+//! \param ui32BitRate is the bit rate.
+//! \param ui32DataWidth is the number of bits per frame.
+//!
+//! This function configures and enables the SSI for the current system clock
+//! and registers it so that it is configured again with SSIConfigSetExpClk()
+//! after every clock change.  The parameters are the same as for
+//! SSIConfigSetExpClk().  Before the change the governor waits for the SSI to
+//! become idle and disables it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovSSIRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                  uint32_t ui32Protocol, uint32_t ui32Mode,
+                  uint32_t ui32BitRate, uint32_t ui32DataWidth)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psPeriph != 0);
+    ASSERT(ui32BitRate != 0);
+
+    psPeriph->ui32Base = ui32Base;
+    psPeriph->ui32Rate = ui32BitRate;
+    psPeriph->ui32Config = ui32Protocol;
+    psPeriph->ui32Mode = ui32Mode;
+    psPeriph->ui32Width = ui32DataWidth;
+    _ClkGovPeriphRegister(psPeriph, _ClkGovSSINotify);
+}
+
+//*****************************************************************************
+//
+//! Configures an I2C master and keeps its bus speed across clock changes.
+//!
+//! \param psPeriph is a pointer to the structure that holds the settings.
+//! \param ui32Base is the base address of the I2C module.
+//! \param bFast selects 400 kbps if \b true or 100 kbps if \b false.
+//!
+//! This function initializes the I2C master for the current system clock and
+//! registers it so that it is initialized again with I2CMasterInitExpClk()
+//! after every clock change.  Before the change the governor waits for the
+//! master to finish the current transfer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovI2CRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base, bool bFast)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psPeriph != 0);
+
+    psPeriph->ui32Base = ui32Base;
+    psPeriph->ui32Config = bFast;
+    _ClkGovPeriphRegister(psPeriph, _ClkGovI2CNotify);
+}
+
+//*****************************************************************************
+//
+//! Loads a periodic timer and keeps its frequency across clock changes.
+//!
+//! \param psPeriph is a pointer to the structure that holds the settings.
+//! \param ui32Base is the base address of the timer module.
+//! \param ui32Timer is the timer to load; \b TIMER_A, \b TIMER_B or
+//! \b TIMER_BOTH.
+//! \param ui32Frequency is the rate in Hz at which the timer should expire.
+//!
+//! This function sets the load value of a timer that has already been
+//! configured with TimerConfigure() so that it expires at
+//! \e ui32Frequency, and registers it so that the load value is recalculated
+//! after every clock change.  The timer must be clocked from the system
+//! clock without a prescaler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ClkGovTimerRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                    uint32_t ui32Timer, uint32_t ui32Frequency)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psPeriph != 0);
+    ASSERT(ui32Frequency != 0);
+
+    psPeriph->ui32Base = ui32Base;
+    psPeriph->ui32Rate = ui32Frequency;
+    psPeriph->ui32Config = ui32Timer;
+    _ClkGovPeriphRegister(psPeriph, _ClkGovTimerNotify);
+}
+
+//*****************************************************************************
+//
+//! Switches the system clock to a level.
+//!
+//! \param ui32Level is the index of the level to enter.
+//!
+//! This function notifies every registered client with
+//! \b CLKGOV_EVENT_PRECHANGE, enters the level with SysCtlClockFreqSet(), and
+//! then notifies every client with \b CLKGOV_EVENT_POSTCHANGE and the actual
+//! new frequency.  If the level cannot be entered, for example because the
+//! PLL fails to lock, the previous level is restored and the clients are
+//! re-clocked for it.  If the previous level cannot be restored either, the
+//! clients are not notified again and are left as they were on
+//! \b CLKGOV_EVENT_PRECHANGE.
+//!
+//! This function must be called from thread context, and not concurrently
+//! with ClkGovUpdate().
+//!
+//! \return Returns the new system clock frequency in Hz, or zero if the
+//! level could not be entered.
+//
+//*****************************************************************************
+uint32_t
+ClkGovLevelSet(uint32_t ui32Level)
+{
+    const tClkGovLevel *psLevel;
+    uint32_t ui32SysClock, ui32Restored;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Level < g_ui32ClkGovNumLevels);
+
+    if(ui32Level == g_ui32ClkGovLevel)
+    {
+        return(g_ui32ClkGovClock);
+    }
+
+    psLevel = &g_psClkGovLevels[ui32Level];
+    _ClkGovNotify(CLKGOV_EVENT_PRECHANGE, psLevel->ui32SysClock);
+
+    ui32SysClock = SysCtlClockFreqSet(psLevel->ui32Config,
+                                      psLevel->ui32SysClock);
+
+    if(ui32SysClock)
+    {
+        g_ui32ClkGovLevel = ui32Level;
+        g_ui32ClkGovClock = ui32SysClock;
+    }
+    else
+    {
+        //
+        // Go back to the previous level so that the clients can be given a
+        // known clock.
+        //
+        psLevel = &g_psClkGovLevels[g_ui32ClkGovLevel];
+        ui32Restored = SysCtlClockFreqSet(psLevel->ui32Config,
+                                          psLevel->ui32SysClock);
+
+        //
+        // There is no known clock to give the clients if that failed too.
+        //
+        if(ui32Restored == 0)
+        {
+            return(0);
+        }
+        g_ui32ClkGovClock = ui32Restored;
+    }
+
+    _ClkGovNotify(CLKGOV_EVENT_POSTCHANGE, g_ui32ClkGovClock);
+
+    return(ui32SysClock);
+}
+
+//*****************************************************************************
+//
+//! Gets the current clock level.
+//!
+//! \return Returns the index of the current clock level.
+//
+//*****************************************************************************
+uint32_t
+ClkGovLevelGet(void)
+{
+    return(g_ui32ClkGovLevel);
+}
+
+//*****************************************************************************
+//
+//! Gets the current system clock frequency.
+//!
+//! \return Returns the system clock frequency in Hz that was reported by
+//! SysCtlClockFreqSet() for the current level.
+//
+//*****************************************************************************
+uint32_t
+ClkGovClockGet(void)
+{
+    return(g_ui32ClkGovClock);
+}
+
+//*****************************************************************************
+//
+//! Selects the clock level for a measured CPU load.
+//!
+//! \param ui32Busy is the time the CPU was busy during the last period.
+//! \param ui32Period is the length of the last period, in the same units as
+//! \e ui32Busy.
+//!
+//! This function calculates the system clock that would have carried the
+//! work of the last period at the load target given to ClkGovInit(), and
+//! switches to the lowest level that is at least that fast, or to the
+//! fastest level if none is.  The application typically measures
+//! \e ui32Busy by counting the time spent outside its idle loop and calls
+//! this function at a fixed rate, for example from a periodic task.
+//!
+//! This function must be called from thread context since a level change
+//! notifies the registered clients and may wait for peripherals to finish
+//! their current transfers.
+//!
+//! \return Returns the index of the level in use after the update.
+//
+//*****************************************************************************
+uint32_t
+ClkGovUpdate(uint32_t ui32Busy, uint32_t ui32Period)
+{
+    uint64_t ui64Required;
+    uint32_t ui32Level;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Period != 0);
+    ASSERT(ui32Busy <= ui32Period);
+
+    //
+    // Scale the busy time to the clock that would have run at the target
+    // load.  The clock is scaled by the load first since the product of the
+    // clock, the busy time and the percentage can overflow 64 bits.
+    //
+    ui64Required = ((uint64_t)g_ui32ClkGovClock * ui32Busy) / ui32Period;
+    ui64Required = (ui64Required * 100) / g_ui32ClkGovLoadTarget;
+
+    //
+    // Find the slowest level that meets it.
+    //
+    for(ui32Level = 0; ui32Level < (g_ui32ClkGovNumLevels - 1); ui32Level++)
+    {
+        if(g_psClkGovLevels[ui32Level].ui32SysClock >= ui64Required)
+        {
+            break;
+        }
+    }
+
+    ClkGovLevelSet(ui32Level);
+
+    return(g_ui32ClkGovLevel);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,192 @@
+//*****************************************************************************
+//
+// clkgov.h - Prototypes for the system clock frequency governor.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_CLKGOV_H__
+#define __DRIVERLIB_CLKGOV_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that are passed as the ui32Event parameter of a tClkGovClient
+// notification function.
+//
+//*****************************************************************************
+#define CLKGOV_EVENT_PRECHANGE  0x00000000
+#define CLKGOV_EVENT_POSTCHANGE 0x00000001
+
+//*****************************************************************************
+//
+//! This structure describes one clock level that the governor can select.  It
+//! holds the arguments that are passed to SysCtlClockFreqSet() to enter the
+//! level.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The ui32Config value for SysCtlClockFreqSet(), selecting the
+    //! oscillator, crystal frequency, PLL use and VCO.
+    //
+    uint32_t ui32Config;
+
+    //
+    //! The requested system clock frequency in Hz.
+    //
+    uint32_t ui32SysClock;
+}
+tClkGovLevel;
+
+//*****************************************************************************
+//
+//! This structure registers a driver for notification of system clock
+//! changes with ClkGovRegister().  The structure is owned by the governor
+//! until it is passed to ClkGovUnregister() and must not go out of scope in
+//! the meantime.
+//
+//*****************************************************************************
+typedef struct tClkGovClient
+{
+    //
+    //! The function called before and after each clock change.  The event is
+    //! \b CLKGOV_EVENT_PRECHANGE with the requested new clock before the
+    //! change, and \b CLKGOV_EVENT_POSTCHANGE with the actual new clock once
+    //! it is running.
+    //
+    void (*pfnNotify)(uint32_t ui32Event, uint32_t ui32SysClock,
+                      void *pvCBData);
+
+    //
+    //! Application data passed to the notification function.
+    //
+    void *pvCBData;
+
+    //
+    //! Used internally to link registered clients.
+    //
+    struct tClkGovClient *psNext;
+}
+tClkGovClient;
+
+//*****************************************************************************
+//
+//! This structure holds the settings of a UART, SSI, I2C or timer that the
+//! governor re-clocks automatically.  It is filled in by
+//! ClkGovUARTRegister(), ClkGovSSIRegister(), ClkGovI2CRegister() or
+//! ClkGovTimerRegister().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The notification client for this peripheral.
+    //
+    tClkGovClient sClient;
+
+    //
+    //! The base address of the peripheral.
+    //
+    uint32_t ui32Base;
+
+    //
+    //! The baud rate, bit rate or timer frequency in Hz.
+    //
+    uint32_t ui32Rate;
+
+    //
+    //! The UART configuration, SSI protocol, I2C fast mode flag or timer
+    //! selection.
+    //
+    uint32_t ui32Config;
+
+    //
+    //! The SSI mode.
+    //
+    uint32_t ui32Mode;
+
+    //
+    //! The SSI data width.
+    //
+    uint32_t ui32Width;
+}
+tClkGovPeriph;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern uint32_t ClkGovInit(const tClkGovLevel *psLevels,
+                           uint32_t ui32NumLevels, uint32_t ui32Level,
+                           uint32_t ui32LoadTarget);
+extern void ClkGovRegister(tClkGovClient *psClient);
+extern void ClkGovUnregister(tClkGovClient *psClient);
+extern void ClkGovUARTRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                               uint32_t ui32Baud, uint32_t ui32Config);
+extern void ClkGovSSIRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                              uint32_t ui32Protocol, uint32_t ui32Mode,
+                              uint32_t ui32BitRate, uint32_t ui32DataWidth);
+extern void ClkGovI2CRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                              bool bFast);
+extern void ClkGovTimerRegister(tClkGovPeriph *psPeriph, uint32_t ui32Base,
+                                uint32_t ui32Timer, uint32_t ui32Frequency);
+extern uint32_t ClkGovLevelSet(uint32_t ui32Level);
+extern uint32_t ClkGovLevelGet(void);
+extern uint32_t ClkGovClockGet(void);
+extern uint32_t ClkGovUpdate(uint32_t ui32Busy, uint32_t ui32Period);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_CLKGOV_H__
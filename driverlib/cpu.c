@@ -41,6 +41,69 @@
 #include <stdint.h>
 #include "driverlib/cpu.h"
 
+//*****************************************************************************
+//
+// Wrapper function for the CPSID instruction.  Returns the state of PRIMASK
+// on entry.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUcpsid(void) {
+    //
+    // Read PRIMASK and disable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsid   i\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUcpsid(void) {
+    //
+    // Read PRIMASK and disable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsid   i\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUcpsid(void) {
+    //
+    // Read PRIMASK and disable interrupts.
+    //
+    mrs r0, PRIMASK;
+    cpsid i;
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUcpsid(void) {
+    //
+    // Read PRIMASK and disable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsid   i\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
+
 //*****************************************************************************
 //
 // Wrapper function returning the state of PRIMASK (indicating whether
@@ -100,6 +163,69 @@ uint32_t CPUprimask(void) {
 }
 #endif
 
+//*****************************************************************************
+//
+// Wrapper function for the CPSIE instruction.  Returns the state of PRIMASK
+// on entry.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUcpsie(void) {
+    //
+    // Read PRIMASK and enable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsie   i\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUcpsie(void) {
+    //
+    // Read PRIMASK and enable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsie   i\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUcpsie(void) {
+    //
+    // Read PRIMASK and enable interrupts.
+    //
+    mrs r0, PRIMASK;
+    cpsie i;
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUcpsie(void) {
+    //
+    // Read PRIMASK and enable interrupts.
+    //
+    __asm("    mrs     r0, PRIMASK\n"
+          "    cpsie   i\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
+
 //*****************************************************************************
 //
 // Wrapper function for the WFI instruction.
@@ -237,3 +363,294 @@ uint32_t CPUbasepriGet(void) {
     return (0);
 }
 #endif
+
+//*****************************************************************************
+//
+// Wrapper function for raising the BASEPRI register through BASEPRI_MAX.
+// The write only takes effect if it raises the execution priority, so
+// nested callers never lower it.  Returns the previous value of BASEPRI.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUbasepriRaise(uint32_t ui32NewBasepri) {
+    //
+    // Read BASEPRI and raise it
+    //
+    __asm("    mrs     r1, BASEPRI\n"
+          "    msr     BASEPRI_MAX, r0\n"
+          "    mov     r0, r1\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUbasepriRaise(uint32_t ui32NewBasepri) {
+    //
+    // Read BASEPRI and raise it
+    //
+    __asm("    mrs     r1, BASEPRI\n"
+          "    msr     BASEPRI_MAX, r0\n"
+          "    mov     r0, r1\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUbasepriRaise(uint32_t ui32NewBasepri) {
+    //
+    // Read BASEPRI and raise it
+    //
+    mrs r1, BASEPRI;
+    msr BASEPRI_MAX, r0;
+    mov r0, r1;
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUbasepriRaise(uint32_t ui32NewBasepri) {
+    //
+    // Read BASEPRI and raise it
+    //
+    __asm("    mrs     r1, BASEPRI\n"
+          "    msr     BASEPRI_MAX, r0\n"
+          "    mov     r0, r1\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
+
+//*****************************************************************************
+//
+// Wrapper function for the LDREX instruction.  Loads a word and marks its
+// address for exclusive access.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUldrex(volatile uint32_t *pui32Addr) {
+    //
+    // Load the word exclusively
+    //
+    __asm("    ldrex   r0, [r0]\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUldrex(volatile uint32_t *pui32Addr) {
+    //
+    // Load the word exclusively
+    //
+    __asm("    ldrex   r0, [r0]\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUldrex(volatile uint32_t *pui32Addr) {
+    //
+    // Load the word exclusively
+    //
+    ldrex r0, [r0];
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUldrex(volatile uint32_t *pui32Addr) {
+    //
+    // Load the word exclusively
+    //
+    __asm("    ldrex   r0, [r0]\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
+
+//*****************************************************************************
+//
+// Wrapper function for the STREX instruction.  Stores a word if the address
+// is still marked for exclusive access, returning 0 if the store was done
+// and 1 if it was not.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUstrex(uint32_t ui32Value, volatile uint32_t *pui32Addr) {
+    //
+    // Store the word exclusively
+    //
+    __asm("    strex   r2, r0, [r1]\n"
+          "    mov     r0, r2\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUstrex(uint32_t ui32Value, volatile uint32_t *pui32Addr) {
+    //
+    // Store the word exclusively
+    //
+    __asm("    strex   r2, r0, [r1]\n"
+          "    mov     r0, r2\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUstrex(uint32_t ui32Value, volatile uint32_t *pui32Addr) {
+    //
+    // Store the word exclusively
+    //
+    strex r2, r0, [r1];
+    mov r0, r2;
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUstrex(uint32_t ui32Value, volatile uint32_t *pui32Addr) {
+    //
+    // Store the word exclusively
+    //
+    __asm("    strex   r2, r0, [r1]\n"
+          "    mov     r0, r2\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
+
+//*****************************************************************************
+//
+// Wrapper function for the CLREX instruction.  Abandons an exclusive access
+// started by LDREX.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+void __attribute__((naked)) CPUclrex(void) {
+    //
+    // Clear the exclusive monitor
+    //
+    __asm("    clrex\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+void CPUclrex(void) {
+    //
+    // Clear the exclusive monitor
+    //
+    __asm("    clrex\n");
+}
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm void CPUclrex(void) {
+    //
+    // Clear the exclusive monitor
+    //
+    clrex;
+    bx lr
+}
+#endif
+#if defined(ccs)
+void CPUclrex(void) {
+    //
+    // Clear the exclusive monitor
+    //
+    __asm("    clrex\n");
+}
+#endif
+
+//*****************************************************************************
+//
+// Wrapper function for the CLZ instruction.  Returns the number of leading
+// zero bits in a word, or 32 if the word is zero.
+//
+//*****************************************************************************
+#if defined(codered) || defined(gcc) || defined(__clang__) || defined(sourcerygxx)
+uint32_t __attribute__((naked)) CPUclz(uint32_t ui32Value) {
+    //
+    // Count the leading zeros
+    //
+    __asm("    clz     r0, r0\n"
+          "    bx      lr\n");
+}
+#endif
+#if defined(ewarm)
+uint32_t CPUclz(uint32_t ui32Value) {
+    //
+    // Count the leading zeros
+    //
+    __asm("    clz     r0, r0\n");
+
+    //
+    // "Warning[Pe940]: missing return statement at end of non-void function"
+    // is suppressed here to avoid putting a "bx lr" in the inline assembly
+    // above and a superfluous return statement here.
+    //
+    #pragma diag_suppress = Pe940
+}
+    #pragma diag_default = Pe940
+#endif
+#if defined(rvmdk) || defined(__ARMCC_VERSION)
+__asm uint32_t CPUclz(uint32_t ui32Value) {
+    //
+    // Count the leading zeros
+    //
+    clz r0, r0;
+    bx lr
+}
+#endif
+#if defined(ccs)
+uint32_t CPUclz(uint32_t ui32Value) {
+    //
+    // Count the leading zeros
+    //
+    __asm("    clz     r0, r0\n"
+          "    bx      lr\n");
+
+    //
+    // The following keeps the compiler happy, because it wants to see a
+    // return value from this function.  It will generate code to return
+    // a zero.  However, the real return is the "bx lr" above, so the
+    // return(0) is never executed and the function returns with the value
+    // you expect in R0.
+    //
+    return (0);
+}
+#endif
@@ -62,6 +62,11 @@ extern uint32_t CPUprimask(void);
 extern void CPUwfi(void);
 extern uint32_t CPUbasepriGet(void);
 extern void CPUbasepriSet(uint32_t ui32NewBasepri);
+extern uint32_t CPUbasepriRaise(uint32_t ui32NewBasepri);
+extern uint32_t CPUldrex(volatile uint32_t *pui32Addr);
+extern uint32_t CPUstrex(uint32_t ui32Value, volatile uint32_t *pui32Addr);
+extern void CPUclrex(void);
+extern uint32_t CPUclz(uint32_t ui32Value);
 
 //*****************************************************************************
 //
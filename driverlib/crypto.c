@@ -0,0 +1,162 @@
+//*****************************************************************************
+//
+// crypto.c - Selection between the hardware and software crypto functions.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup crypto_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/aes.h"
+#include "driverlib/crypto.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/sw_aes.h"
+#include "driverlib/sw_sha256.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The function tables for the CCM module and for the software fallback.
+//
+//*****************************************************************************
+static const tCryptoAESFuncs g_sCryptoAESHardware =
+{
+    AESConfigSet,
+    AESKey1Set,
+    AESIVSet,
+    AESIVRead,
+    AESDataProcess,
+    AESDataProcessAuth
+};
+static const tCryptoAESFuncs g_sCryptoAESSoftware =
+{
+    SWAESConfigSet,
+    SWAESKey1Set,
+    SWAESIVSet,
+    SWAESIVRead,
+    SWAESDataProcess,
+    SWAESDataProcessAuth
+};
+static const tCryptoSHAMD5Funcs g_sCryptoSHAMD5Hardware =
+{
+    SHAMD5ConfigSet,
+    SHAMD5DataProcess,
+    SHAMD5HMACKeySet,
+    SHAMD5HMACProcess
+};
+static const tCryptoSHAMD5Funcs g_sCryptoSHAMD5Software =
+{
+    SWSHAMD5ConfigSet,
+    SWSHAMD5DataProcess,
+    SWSHAMD5HMACKeySet,
+    SWSHAMD5HMACProcess
+};
+
+//*****************************************************************************
+//
+//! Determines if the CCM crypto module is present.
+//!
+//! This function checks the peripheral present register for the CCM module,
+//! which contains the AES, DES and SHA/MD5 engines.
+//!
+//! \return Returns \b true if the CCM module is present and \b false if it
+//! is not.
+//
+//*****************************************************************************
+bool
+CryptoHardwarePresent(void)
+{
+    return(SysCtlPeripheralPresent(SYSCTL_PERIPH_CCM0));
+}
+
+//*****************************************************************************
+//
+//! Returns the AES functions to use on this part.
+//!
+//! This function returns the AES module functions if the CCM module is
+//! present and the software equivalents from sw_aes.c if it is not, so an
+//! application can be built once and run on both kinds of part.  The base
+//! address passed to the functions is \b AES_BASE in either case.  When the
+//! hardware functions are returned, the application must still enable the
+//! CCM module with SysCtlPeripheralEnable() before using them.
+//!
+//! The software functions support the ECB, CBC, CTR and GCM modes only; see
+//! SWAESDataProcess() and SWAESDataProcessAuth().
+//!
+//! \return Returns a pointer to the table of AES functions.
+//
+//*****************************************************************************
+const tCryptoAESFuncs *
+CryptoAESFuncsGet(void)
+{
+    return(CryptoHardwarePresent() ? &g_sCryptoAESHardware :
+           &g_sCryptoAESSoftware);
+}
+
+//*****************************************************************************
+//
+//! Returns the SHA/MD5 functions to use on this part.
+//!
+//! This function returns the SHA/MD5 module functions if the CCM module is
+//! present and the software equivalents from sw_sha256.c if it is not.  The
+//! base address passed to the functions is \b SHAMD5_BASE in either case.
+//!
+//! The software functions support SHA-224 and SHA-256 and the HMAC forms of
+//! both; see SWSHAMD5ConfigSet().
+//!
+//! \return Returns a pointer to the table of SHA/MD5 functions.
+//
+//*****************************************************************************
+const tCryptoSHAMD5Funcs *
+CryptoSHAMD5FuncsGet(void)
+{
+    return(CryptoHardwarePresent() ? &g_sCryptoSHAMD5Hardware :
+           &g_sCryptoSHAMD5Software);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,114 @@
+//*****************************************************************************
+//
+// crypto.h - Selection between the hardware and software crypto functions.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_CRYPTO_H__
+#define __DRIVERLIB_CRYPTO_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The AES functions used by an application that must run both on parts with
+// and without the CCM module.  Each member has the same arguments as the AES
+// module function it is named after.
+//
+//*****************************************************************************
+typedef struct
+{
+    void (*pfnConfigSet)(uint32_t ui32Base, uint32_t ui32Config);
+    void (*pfnKey1Set)(uint32_t ui32Base, uint32_t *pui32Key,
+                       uint32_t ui32Keysize);
+    void (*pfnIVSet)(uint32_t ui32Base, uint32_t *pui32IVdata);
+    void (*pfnIVRead)(uint32_t ui32Base, uint32_t *pui32IVdata);
+    bool (*pfnDataProcess)(uint32_t ui32Base, uint32_t *pui32Src,
+                           uint32_t *pui32Dest, uint32_t ui32Length);
+    bool (*pfnDataProcessAuth)(uint32_t ui32Base, uint32_t *pui32Src,
+                               uint32_t *pui32Dest, uint32_t ui32Length,
+                               uint32_t *pui32AuthSrc,
+                               uint32_t ui32AuthLength, uint32_t *pui32Tag);
+}
+tCryptoAESFuncs;
+
+//*****************************************************************************
+//
+// The SHA/MD5 functions used by an application that must run both on parts
+// with and without the CCM module.
+//
+//*****************************************************************************
+typedef struct
+{
+    void (*pfnConfigSet)(uint32_t ui32Base, uint32_t ui32Mode);
+    void (*pfnDataProcess)(uint32_t ui32Base, uint32_t *pui32DataSrc,
+                           uint32_t ui32DataLength,
+                           uint32_t *pui32HashResult);
+    void (*pfnHMACKeySet)(uint32_t ui32Base, uint32_t *pui32Src);
+    void (*pfnHMACProcess)(uint32_t ui32Base, uint32_t *pui32DataSrc,
+                           uint32_t ui32DataLength,
+                           uint32_t *pui32HashResult);
+}
+tCryptoSHAMD5Funcs;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern bool CryptoHardwarePresent(void);
+extern const tCryptoAESFuncs *CryptoAESFuncsGet(void);
+extern const tCryptoSHAMD5Funcs *CryptoSHAMD5FuncsGet(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_CRYPTO_H__
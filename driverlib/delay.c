@@ -0,0 +1,440 @@
+//*****************************************************************************
+//
+// delay.c - Cycle counter based delay and timing service.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup delay_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_dwt.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
+#include "driverlib/cpu.h"
+#include "driverlib/debug.h"
+#include "driverlib/delay.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The system clock frequency that the conversion factors were calculated
+// for, or zero if the counter has not been started yet.
+//
+//*****************************************************************************
+static uint32_t g_ui32DelayClock;
+
+//*****************************************************************************
+//
+// The number of cycles per microsecond, split into an integer part and a
+// 0.32 fixed-point fraction, and the number of cycles per nanosecond as a
+// 0.32 fixed-point value.
+//
+//*****************************************************************************
+static uint32_t g_ui32DelayPerUs;
+static uint32_t g_ui32DelayPerUsFrac;
+static uint32_t g_ui32DelayPerNs;
+
+//*****************************************************************************
+//
+// The SysTick state used when the DWT cycle counter is not implemented.  The
+// 24-bit SysTick count is extended to 32 bits in software.
+//
+//*****************************************************************************
+static bool g_bDelaySysTick;
+static uint32_t g_ui32DelayLast;
+static uint32_t g_ui32DelayCount;
+
+//*****************************************************************************
+//
+// Starts the cycle counter, using the DWT if it is present and SysTick
+// otherwise.
+//
+//*****************************************************************************
+static void
+_DelayStart(void)
+{
+    //
+    // The DWT registers can only be accessed once trace is enabled.
+    //
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+
+    if((HWREG(DWT_CTRL) & DWT_CTRL_NOCYCCNT) == 0)
+    {
+        HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+        g_bDelaySysTick = false;
+        return;
+    }
+
+    //
+    // Fall back to SysTick.  If it is already running, for example as an
+    // RTOS tick, it is only read; otherwise it is set to free-run over its
+    // full range without an interrupt.
+    //
+    if((HWREG(NVIC_ST_CTRL) & NVIC_ST_CTRL_ENABLE) == 0)
+    {
+        HWREG(NVIC_ST_RELOAD) = NVIC_ST_RELOAD_M;
+        HWREG(NVIC_ST_CURRENT) = 0;
+        HWREG(NVIC_ST_CTRL) = NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_ENABLE;
+    }
+
+    //
+    // SysTick must count system clock cycles.
+    //
+    ASSERT(HWREG(NVIC_ST_CTRL) & NVIC_ST_CTRL_CLK_SRC);
+
+    g_ui32DelayLast = HWREG(NVIC_ST_CURRENT);
+    g_ui32DelayCount = 0;
+    g_bDelaySysTick = true;
+}
+
+//*****************************************************************************
+//
+// Starts the counter on first use and recalculates the conversion factors
+// whenever the system clock has been changed.
+//
+//*****************************************************************************
+static void
+_DelayCheck(void)
+{
+    uint32_t ui32Clock;
+
+    ui32Clock = SysCtlClockFreqGet();
+    if(ui32Clock == g_ui32DelayClock)
+    {
+        return;
+    }
+
+    if(g_ui32DelayClock == 0)
+    {
+        _DelayStart();
+    }
+
+    //
+    // Round the fractions up so that delays are never shorter than asked.
+    //
+    g_ui32DelayPerUs = ui32Clock / 1000000;
+    g_ui32DelayPerUsFrac =
+        (uint32_t)((((uint64_t)(ui32Clock % 1000000) << 32) + 999999) /
+                   1000000);
+    g_ui32DelayPerNs = (uint32_t)((((uint64_t)ui32Clock << 32) + 999999999) /
+                                  1000000000);
+    g_ui32DelayClock = ui32Clock;
+}
+
+//*****************************************************************************
+//
+// Reads the 32-bit cycle count.
+//
+//*****************************************************************************
+static uint32_t
+_DelayCount(void)
+{
+    uint32_t ui32Current, ui32Mask, ui32Count;
+
+    if(!g_bDelaySysTick)
+    {
+        return(HWREG(DWT_CYCCNT));
+    }
+
+    //
+    // Add the SysTick cycles since the last read to the software count.
+    // SysTick counts down and reloads when it reaches zero.
+    //
+    ui32Mask = CPUcpsid();
+    ui32Current = HWREG(NVIC_ST_CURRENT);
+    if(ui32Current <= g_ui32DelayLast)
+    {
+        g_ui32DelayCount += g_ui32DelayLast - ui32Current;
+    }
+    else
+    {
+        g_ui32DelayCount += (g_ui32DelayLast + HWREG(NVIC_ST_RELOAD) + 1 -
+                             ui32Current);
+    }
+    g_ui32DelayLast = ui32Current;
+    ui32Count = g_ui32DelayCount;
+    if(!ui32Mask)
+    {
+        CPUcpsie();
+    }
+
+    return(ui32Count);
+}
+
+//*****************************************************************************
+//
+// Waits for a number of cycles from a starting count.
+//
+//*****************************************************************************
+static void
+_DelayWait(uint32_t ui32Start, uint32_t ui32Cycles)
+{
+    if(!g_bDelaySysTick)
+    {
+        while((HWREG(DWT_CYCCNT) - ui32Start) < ui32Cycles)
+        {
+        }
+    }
+    else
+    {
+        while((_DelayCount() - ui32Start) < ui32Cycles)
+        {
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts the delay service.
+//!
+//! This function enables the DWT cycle counter, or SysTick on a device
+//! without one, and calculates the conversion factors for the current system
+//! clock.  Calling it is optional since every other function in this module
+//! does the same on first use, but doing so at start-up keeps that work out
+//! of the first delay.
+//!
+//! The system clock is read with SysCtlClockFreqGet(), so the conversion
+//! factors follow every change made with SysCtlClockSet(),
+//! SysCtlClockFreqSet() or SysCtlClockFreqSetPLL() without any action by the
+//! application.
+//!
+//! If SysTick is used and is already running, for example as an RTOS tick,
+//! it must be clocked from the system clock and it must be read, through any
+//! of the functions in this module, at least once per SysTick period.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DelayInit(void)
+{
+    _DelayCheck();
+}
+
+//*****************************************************************************
+//
+//! Gets the cycle count.
+//!
+//! This function returns a free-running 32-bit count of system clock cycles,
+//! which may be used to time code.  The count wraps around, so intervals
+//! must be calculated by unsigned subtraction.  Once the counter is running,
+//! this function only reads it, so it is cheap enough to timestamp events in
+//! interrupt handlers.
+//!
+//! \return Returns the current cycle count.
+//
+//*****************************************************************************
+uint32_t
+DelayCountGet(void)
+{
+    //
+    // The count does not depend on the system clock, so the conversion
+    // factors are left alone and the counter is only started on first use.
+    //
+    if(g_ui32DelayClock == 0)
+    {
+        _DelayCheck();
+    }
+
+    return(_DelayCount());
+}
+
+//*****************************************************************************
+//
+//! Converts microseconds to system clock cycles.
+//!
+//! \param ui32Us is the number of microseconds.
+//!
+//! This function converts \e ui32Us to a cycle count at the current system
+//! clock, rounding up.  The result must fit in 32 bits, which allows
+//! intervals of up to about 35 seconds at 120 MHz.
+//!
+//! \return Returns the number of cycles.
+//
+//*****************************************************************************
+uint32_t
+DelayUsToCycles(uint32_t ui32Us)
+{
+    _DelayCheck();
+
+    return((ui32Us * g_ui32DelayPerUs) +
+           (uint32_t)((((uint64_t)ui32Us * g_ui32DelayPerUsFrac) +
+                       0xffffffff) >> 32));
+}
+
+//*****************************************************************************
+//
+//! Delays for a number of system clock cycles.
+//!
+//! \param ui32Cycles is the number of cycles to wait.
+//!
+//! This function waits until the cycle counter has advanced by
+//! \e ui32Cycles.  Unlike SysCtlDelay(), the duration does not depend on
+//! flash wait states, prefetch or interrupts, although an interrupt may
+//! extend the delay beyond the requested time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DelayCycles(uint32_t ui32Cycles)
+{
+    _DelayCheck();
+    _DelayWait(_DelayCount(), ui32Cycles);
+}
+
+//*****************************************************************************
+//
+//! Delays for a number of microseconds.
+//!
+//! \param ui32Us is the number of microseconds to wait.
+//!
+//! This function waits for at least \e ui32Us microseconds at the current
+//! system clock.  The whole 32-bit range is supported; long delays are
+//! split into several waits on the cycle counter.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DelayUs(uint32_t ui32Us)
+{
+    uint64_t ui64Cycles;
+    uint32_t ui32Start;
+
+    _DelayCheck();
+    ui32Start = _DelayCount();
+
+    ui64Cycles = (((uint64_t)ui32Us * g_ui32DelayPerUs) +
+                  ((((uint64_t)ui32Us * g_ui32DelayPerUsFrac) + 0xffffffff) >>
+                   32));
+
+    //
+    // Wait in steps of 2^31 cycles so that the counter cannot wrap past the
+    // start of a step.
+    //
+    while(ui64Cycles > 0x80000000)
+    {
+        _DelayWait(ui32Start, 0x80000000);
+        ui32Start += 0x80000000;
+        ui64Cycles -= 0x80000000;
+    }
+
+    _DelayWait(ui32Start, (uint32_t)ui64Cycles);
+}
+
+//*****************************************************************************
+//
+//! Delays for a number of nanoseconds.
+//!
+//! \param ui32Ns is the number of nanoseconds to wait.
+//!
+//! This function waits for at least \e ui32Ns nanoseconds at the current
+//! system clock.  The delay is rounded up to a whole number of cycles, and
+//! the call overhead of a few tens of cycles sets the shortest delay that
+//! can be achieved.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DelayNs(uint32_t ui32Ns)
+{
+    _DelayCheck();
+    _DelayWait(_DelayCount(),
+               (uint32_t)((((uint64_t)ui32Ns * g_ui32DelayPerNs) +
+                           0xffffffff) >> 32));
+}
+
+//*****************************************************************************
+//
+//! Sets a deadline.
+//!
+//! \param ui32Us is the number of microseconds from now to the deadline.
+//!
+//! This function returns the cycle count at which a deadline \e ui32Us
+//! microseconds from now expires, for use with DelayDeadlineExpired().  This
+//! allows a polling loop to give up after a timeout without counting loop
+//! iterations.  The deadline must be less than 2^31 cycles away, which is
+//! about 17 seconds at 120 MHz.
+//!
+//! A deadline is measured in cycles, so it does not follow a change of the
+//! system clock that is made before it expires.
+//!
+//! \return Returns the deadline.
+//
+//*****************************************************************************
+uint32_t
+DelayDeadlineSet(uint32_t ui32Us)
+{
+    uint32_t ui32Cycles;
+
+    ui32Cycles = DelayUsToCycles(ui32Us);
+    ASSERT(ui32Cycles < 0x80000000);
+
+    return(_DelayCount() + ui32Cycles);
+}
+
+//*****************************************************************************
+//
+//! Checks whether a deadline has expired.
+//!
+//! \param ui32Deadline is the deadline returned by DelayDeadlineSet().
+//!
+//! \return Returns \b true if the deadline has passed or \b false if it has
+//! not.
+//
+//*****************************************************************************
+bool
+DelayDeadlineExpired(uint32_t ui32Deadline)
+{
+    _DelayCheck();
+
+    return((int32_t)(_DelayCount() - ui32Deadline) >= 0);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
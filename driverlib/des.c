@@ -431,6 +431,9 @@ DESDataWrite(uint32_t ui32Base, uint32_t *pui32Src)
 //! \note This functions assumes that the DES module has been configured,
 //! and initialization values and keys have been written.
 //!
+//! \note For bulk transfers that should not occupy the CPU, use the queued
+//! uDMA driver in desdma.c instead; see DESDMASubmit().
+//!
 //! \return true or false.
 //
 //*****************************************************************************
@@ -0,0 +1,445 @@
+//*****************************************************************************
+//
+// desdma.c - Queued uDMA driver for the DES/3DES module.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup desdma_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_des.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/des.h"
+#include "driverlib/desdma.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/udma.h"
+
+//*****************************************************************************
+//
+// The largest number of bytes that can be moved by a single basic-mode uDMA
+// transfer of 32-bit items.
+//
+//*****************************************************************************
+#define DESDMA_SEGMENT_MAX      4096
+
+//*****************************************************************************
+//
+// The queue of submitted requests.  The head of the queue is the request
+// currently being processed by the DES module.
+//
+//*****************************************************************************
+static tDESDMARequest *g_psDESDMAHead;
+static tDESDMARequest *g_psDESDMATail;
+
+//*****************************************************************************
+//
+// The number of bytes of the active request handed to the uDMA controller so
+// far, and the size of the segment currently in flight.
+//
+//*****************************************************************************
+static uint32_t g_ui32DESDMAOffset;
+static uint32_t g_ui32DESDMASegment;
+
+//*****************************************************************************
+//
+// Starts the uDMA transfers for the next segment of the active request.
+//
+//*****************************************************************************
+static void
+_DESDMASegmentStart(tDESDMARequest *psRequest)
+{
+    uint32_t ui32Count;
+
+    //
+    // Determine the size of this segment.
+    //
+    ui32Count = psRequest->ui32Length - g_ui32DESDMAOffset;
+    if(ui32Count > DESDMA_SEGMENT_MAX)
+    {
+        ui32Count = DESDMA_SEGMENT_MAX;
+    }
+    g_ui32DESDMASegment = ui32Count;
+
+    //
+    // Set up the output channel before the input channel so that no result
+    // can be produced before there is somewhere for it to go.
+    //
+    uDMAChannelTransferSet(UDMA_CH22_DES0DOUT | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC, (void *)(DES_BASE + DES_O_DATA_L),
+                           psRequest->pui32Dest + (g_ui32DESDMAOffset / 4),
+                           ui32Count / 4);
+    uDMAChannelTransferSet(UDMA_CH21_DES0DIN | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC,
+                           psRequest->pui32Src + (g_ui32DESDMAOffset / 4),
+                           (void *)(DES_BASE + DES_O_DATA_L), ui32Count / 4);
+    uDMAChannelEnable(UDMA_CH22_DES0DOUT);
+    uDMAChannelEnable(UDMA_CH21_DES0DIN);
+}
+
+//*****************************************************************************
+//
+// Loads the context of a request into the DES module and starts it.
+//
+//*****************************************************************************
+static void
+_DESDMAStart(tDESDMARequest *psRequest)
+{
+    //
+    // Wait for the context registers to become writable.
+    //
+    while((HWREG(DES_BASE + DES_O_CTRL) & DES_CTRL_CONTEXT) == 0)
+    {
+    }
+
+    //
+    // Program the context for this request.
+    //
+    DESConfigSet(DES_BASE, psRequest->ui32Config);
+    DESKeySet(DES_BASE, psRequest->pui32Key);
+    if(psRequest->pui32IV)
+    {
+        DESIVSet(DES_BASE, psRequest->pui32IV);
+    }
+
+    //
+    // Hand the first segment to the uDMA controller.
+    //
+    psRequest->ui32Status = DESDMA_STATUS_ACTIVE;
+    g_ui32DESDMAOffset = 0;
+    _DESDMASegmentStart(psRequest);
+
+    //
+    // Let the module request data and then write the length, which starts
+    // the engine using this context.
+    //
+    DESDMAEnable(DES_BASE, DES_DMA_DATA_IN | DES_DMA_DATA_OUT);
+    DESLengthSet(DES_BASE, psRequest->ui32Length);
+}
+
+//*****************************************************************************
+//
+//! Initializes the queued uDMA DES driver.
+//!
+//! This function assigns uDMA channels 21 and 22 to the DES data input and
+//! output, programs their channel control words and enables the DES
+//! data-out uDMA completion interrupt.  It must be called once after the
+//! DES module has been enabled, the uDMA controller has been enabled and its
+//! control table set with uDMAControlBaseSet(), and before the first call to
+//! DESDMASubmit().
+//!
+//! The application must call DESDMAIntHandler() from the DES interrupt
+//! handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DESDMAInit(void)
+{
+    //
+    // Start with an empty queue.
+    //
+    g_psDESDMAHead = 0;
+    g_psDESDMATail = 0;
+
+    //
+    // Route the DES requests to their channels.
+    //
+    uDMAChannelAssign(UDMA_CH21_DES0DIN);
+    uDMAChannelAssign(UDMA_CH22_DES0DOUT);
+    uDMAChannelAttributeDisable(UDMA_CH21_DES0DIN, UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(UDMA_CH22_DES0DOUT, UDMA_ATTR_ALL);
+
+    //
+    // The DES module requests one 2-word block at a time through its data
+    // registers, which behave as a FIFO.
+    //
+    uDMAChannelControlSet(UDMA_CH21_DES0DIN | UDMA_PRI_SELECT,
+                          UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_2 | UDMA_DST_PROT_PRIV);
+    uDMAChannelControlSet(UDMA_CH22_DES0DOUT | UDMA_PRI_SELECT,
+                          UDMA_SIZE_32 | UDMA_SRC_INC_NONE | UDMA_DST_INC_32 |
+                          UDMA_ARB_2 | UDMA_SRC_PROT_PRIV);
+
+    //
+    // Interrupt when the output channel has delivered a segment.
+    //
+    DESIntClear(DES_BASE, DES_INT_DMA_DATA_OUT);
+    DESIntEnable(DES_BASE, DES_INT_DMA_DATA_OUT);
+    IntEnable(INT_DES0_TM4C129);
+}
+
+//*****************************************************************************
+//
+//! Queues a DES or triple DES operation for uDMA processing.
+//!
+//! \param psRequest is a pointer to the request to queue.
+//!
+//! This function appends \e psRequest to the queue of pending operations and
+//! returns immediately.  If the DES module is idle, the operation is started
+//! right away; otherwise it starts from DESDMAIntHandler() once every
+//! earlier request has completed.  Each request carries its own
+//! configuration, key and initialization vector, so requests for different
+//! peers can be freely interleaved.
+//!
+//! When the operation completes, the \e ui32Status member of the request is
+//! set to \b DESDMA_STATUS_DONE and the callback, if any, is called from
+//! interrupt context.
+//!
+//! This function may be called from thread or interrupt context.
+//!
+//! \return Returns \b true if the request was started immediately or
+//! \b false if it was queued behind other requests.
+//
+//*****************************************************************************
+bool
+DESDMASubmit(tDESDMARequest *psRequest)
+{
+    uint32_t ui32Enabled;
+    bool bStarted;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRequest != 0);
+    ASSERT(psRequest->pui32Key != 0);
+    ASSERT((psRequest->ui32Length != 0) &&
+           ((psRequest->ui32Length % 8) == 0));
+
+    psRequest->psNext = 0;
+    psRequest->ui32Status = DESDMA_STATUS_PENDING;
+
+    //
+    // Keep the DES interrupt from touching the queue while it is updated.
+    // Only the DES interrupt is masked, so unrelated interrupts are not
+    // delayed.
+    //
+    ui32Enabled = IntIsEnabled(INT_DES0_TM4C129);
+    IntDisable(INT_DES0_TM4C129);
+
+    //
+    // Append the request to the queue.
+    //
+    if(g_psDESDMATail)
+    {
+        g_psDESDMATail->psNext = psRequest;
+    }
+    else
+    {
+        g_psDESDMAHead = psRequest;
+    }
+    g_psDESDMATail = psRequest;
+
+    //
+    // Start the request now if the module was idle.
+    //
+    bStarted = (g_psDESDMAHead == psRequest) ? true : false;
+    if(bStarted)
+    {
+        _DESDMAStart(psRequest);
+    }
+
+    //
+    // Restore the DES interrupt.
+    //
+    if(ui32Enabled)
+    {
+        IntEnable(INT_DES0_TM4C129);
+    }
+
+    return(bStarted);
+}
+
+//*****************************************************************************
+//
+//! Removes a pending request from the queue.
+//!
+//! \param psRequest is a pointer to the request to remove.
+//!
+//! This function removes a request that has been queued with DESDMASubmit()
+//! but not yet started.  A request that is already being processed by the
+//! DES module cannot be cancelled.  The callback of a cancelled request is
+//! not called and its status is set back to \b DESDMA_STATUS_IDLE.
+//!
+//! \return Returns \b true if the request was removed or \b false if it was
+//! not found in the pending part of the queue.
+//
+//*****************************************************************************
+bool
+DESDMACancel(tDESDMARequest *psRequest)
+{
+    tDESDMARequest *psPrev;
+    uint32_t ui32Enabled;
+    bool bFound;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRequest != 0);
+
+    ui32Enabled = IntIsEnabled(INT_DES0_TM4C129);
+    IntDisable(INT_DES0_TM4C129);
+
+    //
+    // Search the queue after the active request.
+    //
+    bFound = false;
+    for(psPrev = g_psDESDMAHead; psPrev && psPrev->psNext;
+        psPrev = psPrev->psNext)
+    {
+        if(psPrev->psNext == psRequest)
+        {
+            //
+            // Unlink the request.
+            //
+            psPrev->psNext = psRequest->psNext;
+            if(g_psDESDMATail == psRequest)
+            {
+                g_psDESDMATail = psPrev;
+            }
+            psRequest->psNext = 0;
+            psRequest->ui32Status = DESDMA_STATUS_IDLE;
+            bFound = true;
+            break;
+        }
+    }
+
+    if(ui32Enabled)
+    {
+        IntEnable(INT_DES0_TM4C129);
+    }
+
+    return(bFound);
+}
+
+//*****************************************************************************
+//
+//! Determines whether the queued DES driver has work outstanding.
+//!
+//! \return Returns \b true if a request is being processed or is queued, and
+//! \b false if the driver is idle.
+//
+//*****************************************************************************
+bool
+DESDMABusy(void)
+{
+    return((g_psDESDMAHead != 0) ? true : false);
+}
+
+//*****************************************************************************
+//
+//! Handles the DES interrupt for the queued uDMA DES driver.
+//!
+//! This function must be called from the DES interrupt handler.  It moves
+//! the active request on to its next uDMA segment, completes it when all of
+//! its data has been processed, and starts the next queued request.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+DESDMAIntHandler(void)
+{
+    tDESDMARequest *psRequest;
+
+    //
+    // Only the data-out completion is of interest.
+    //
+    if((DESIntStatus(DES_BASE, true) & DES_INT_DMA_DATA_OUT) == 0)
+    {
+        return;
+    }
+    DESIntClear(DES_BASE, DES_INT_DMA_DATA_OUT);
+
+    psRequest = g_psDESDMAHead;
+    if(psRequest == 0)
+    {
+        return;
+    }
+
+    //
+    // If there is more data in this request, start the next segment.  The
+    // DES context is still loaded, so chaining carries on across segments.
+    //
+    g_ui32DESDMAOffset += g_ui32DESDMASegment;
+    if(g_ui32DESDMAOffset < psRequest->ui32Length)
+    {
+        _DESDMASegmentStart(psRequest);
+        return;
+    }
+
+    //
+    // The request is complete.  Take it off the queue.
+    //
+    DESDMADisable(DES_BASE, DES_DMA_DATA_IN | DES_DMA_DATA_OUT);
+    g_psDESDMAHead = psRequest->psNext;
+    if(g_psDESDMAHead == 0)
+    {
+        g_psDESDMATail = 0;
+    }
+    psRequest->psNext = 0;
+    psRequest->ui32Status = DESDMA_STATUS_DONE;
+
+    //
+    // Start the next request before notifying the owner of this one, so the
+    // module is kept busy while the callback runs.
+    //
+    if(g_psDESDMAHead)
+    {
+        _DESDMAStart(g_psDESDMAHead);
+    }
+
+    if(psRequest->pfnCallback)
+    {
+        psRequest->pfnCallback(psRequest);
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
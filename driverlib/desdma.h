@@ -0,0 +1,150 @@
+//*****************************************************************************
+//
+// desdma.h - Prototypes for the queued uDMA DES/3DES driver.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_DESDMA_H__
+#define __DRIVERLIB_DESDMA_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values returned in the ui32Status member of tDESDMARequest.
+//
+//*****************************************************************************
+#define DESDMA_STATUS_IDLE      0x00000000
+#define DESDMA_STATUS_PENDING   0x00000001
+#define DESDMA_STATUS_ACTIVE    0x00000002
+#define DESDMA_STATUS_DONE      0x00000003
+
+//*****************************************************************************
+//
+//! This structure describes one DES or triple DES operation queued with
+//! DESDMASubmit().  The structure is owned by the driver from the time it is
+//! submitted until its callback has been called, and must not be modified or
+//! go out of scope in the meantime.
+//
+//*****************************************************************************
+typedef struct tDESDMARequest
+{
+    //
+    //! The value passed to DESConfigSet() for this operation.
+    //
+    uint32_t ui32Config;
+
+    //
+    //! The key passed to DESKeySet(); 2 words for single DES or 6 words for
+    //! triple DES.
+    //
+    uint32_t *pui32Key;
+
+    //
+    //! The 2-word initialization vector, or 0 for ECB mode.
+    //
+    uint32_t *pui32IV;
+
+    //
+    //! The source data.  It must be in SRAM and word aligned.
+    //
+    uint32_t *pui32Src;
+
+    //
+    //! The destination buffer.  It must be in SRAM and word aligned, and may
+    //! be the same as \e pui32Src.
+    //
+    uint32_t *pui32Dest;
+
+    //
+    //! The length of the data in bytes.  It must be a non-zero multiple of 8.
+    //
+    uint32_t ui32Length;
+
+    //
+    //! The function called from DESDMAIntHandler() when the operation
+    //! completes, or 0 if no notification is required.
+    //
+    void (*pfnCallback)(struct tDESDMARequest *psRequest);
+
+    //
+    //! Application data for use by the callback.
+    //
+    void *pvCBData;
+
+    //
+    //! The current state of the request; one of the \b DESDMA_STATUS_*
+    //! values.
+    //
+    volatile uint32_t ui32Status;
+
+    //
+    //! Used internally to link queued requests.
+    //
+    struct tDESDMARequest *psNext;
+}
+tDESDMARequest;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void DESDMAInit(void);
+extern bool DESDMASubmit(tDESDMARequest *psRequest);
+extern bool DESDMACancel(tDESDMARequest *psRequest);
+extern bool DESDMABusy(void);
+extern void DESDMAIntHandler(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_DESDMA_H__
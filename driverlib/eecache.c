@@ -0,0 +1,418 @@
+//*****************************************************************************
+//
+// eecache.c - Write-back RAM cache for the EEPROM.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup eecache_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "driverlib/debug.h"
+#include "driverlib/eecache.h"
+#include "driverlib/eeprom.h"
+#include "driverlib/interrupt.h"
+
+//*****************************************************************************
+//
+// The cached EEPROM region, its RAM copy and the bitmap of words in the RAM
+// copy that have not yet been written to the EEPROM.
+//
+//*****************************************************************************
+static uint32_t g_ui32EECacheBase;
+static uint32_t g_ui32EECacheWords;
+static uint32_t *g_pui32EECache;
+static uint32_t *g_pui32EECacheDirty;
+
+//*****************************************************************************
+//
+// Set while a word write started by the cache is in progress, and the
+// accumulated error flags of failed writes.
+//
+//*****************************************************************************
+static volatile bool g_bEECacheBusy;
+static volatile uint32_t g_ui32EECacheStatus;
+
+//*****************************************************************************
+//
+// The EEPROMStatusGet() flags that are recorded for a completed write, which
+// are all of them except EEPROM_RC_WORKING.
+//
+//*****************************************************************************
+#define _EECACHE_RC_ERRORS      (EEPROM_RC_WRBUSY | EEPROM_RC_NOPERM |        \
+                                 EEPROM_RC_WKCOPY | EEPROM_RC_WKERASE |       \
+                                 EEPROM_RC_INVPL)
+
+//*****************************************************************************
+//
+// Starts writing the lowest dirty word to the EEPROM, or marks the cache
+// idle if there are none.  This must be called with the flash interrupt
+// masked or from the flash interrupt handler.
+//
+//*****************************************************************************
+static void
+_EECacheStart(void)
+{
+    uint32_t ui32Idx, ui32Bit, ui32Word, ui32Status;
+
+    for(ui32Idx = 0; ui32Idx < EECacheDirtyWords(g_ui32EECacheWords * 4);
+        ui32Idx++)
+    {
+        while(g_pui32EECacheDirty[ui32Idx])
+        {
+            //
+            // Find the lowest dirty word in this part of the bitmap.
+            //
+            for(ui32Bit = 0;
+                !(g_pui32EECacheDirty[ui32Idx] & ((uint32_t)1 << ui32Bit));
+                ui32Bit++)
+            {
+            }
+            ui32Word = (ui32Idx * 32) + ui32Bit;
+
+            //
+            // Clear the dirty bit before the write starts, so that a change
+            // made to the word while it is being written marks it dirty
+            // again and is written afterwards.
+            //
+            g_pui32EECacheDirty[ui32Idx] &= ~((uint32_t)1 << ui32Bit);
+            ui32Status = EEPROMProgramNonBlocking(g_pui32EECache[ui32Word],
+                                                  g_ui32EECacheBase +
+                                                  (ui32Word * 4));
+
+            //
+            // A word in a write-protected block is rejected at once, so
+            // record the error and move on to the next word.
+            //
+            if(ui32Status & EEPROM_RC_NOPERM)
+            {
+                g_ui32EECacheStatus |= EEPROM_RC_NOPERM;
+                continue;
+            }
+
+            g_bEECacheBusy = true;
+            return;
+        }
+    }
+
+    g_bEECacheBusy = false;
+}
+
+//*****************************************************************************
+//
+//! Initializes the write-back EEPROM cache.
+//!
+//! \param ui32Base is the EEPROM byte address of the start of the region to
+//! cache.  It must be a multiple of four.
+//! \param ui32Size is the size of the region in bytes.  It must be a
+//! multiple of four.
+//! \param pui32Cache is a pointer to a RAM buffer of \e ui32Size bytes that
+//! holds the copy of the region.
+//! \param pui32Dirty is a pointer to a RAM buffer of
+//! EECacheDirtyWords(\e ui32Size) words used to track the words that have
+//! not yet been written.
+//!
+//! This function reads the region into the cache and enables the EEPROM
+//! write-complete interrupt.  It must be called after EEPROMInit() and
+//! before any other cache function.  The application must call
+//! EECacheIntHandler() from the flash interrupt handler, which the EEPROM
+//! shares.
+//!
+//! While the cache is in use, the cached region must only be written
+//! through EECacheWrite(), and no other code may write to the EEPROM while
+//! EECacheDirty() returns \b true.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+EECacheInit(uint32_t ui32Base, uint32_t ui32Size, uint32_t *pui32Cache,
+            uint32_t *pui32Dirty)
+{
+    uint32_t ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(ui32Base & 3));
+    ASSERT(!(ui32Size & 3));
+    ASSERT(ui32Size != 0);
+    ASSERT(pui32Cache != 0);
+    ASSERT(pui32Dirty != 0);
+
+    g_ui32EECacheBase = ui32Base;
+    g_ui32EECacheWords = ui32Size / 4;
+    g_pui32EECache = pui32Cache;
+    g_pui32EECacheDirty = pui32Dirty;
+    g_bEECacheBusy = false;
+    g_ui32EECacheStatus = 0;
+
+    //
+    // Start with a clean copy of the region.
+    //
+    EEPROMRead(pui32Cache, ui32Base, ui32Size);
+    for(ui32Idx = 0; ui32Idx < EECacheDirtyWords(ui32Size); ui32Idx++)
+    {
+        pui32Dirty[ui32Idx] = 0;
+    }
+
+    //
+    // Interrupt when each word write completes.
+    //
+    EEPROMIntClear(EEPROM_INT_PROGRAM);
+    EEPROMIntEnable(EEPROM_INT_PROGRAM);
+    IntEnable(INT_FLASH_TM4C123);
+}
+
+//*****************************************************************************
+//
+//! Reads data through the EEPROM cache.
+//!
+//! \param pui32Data is a pointer to the buffer that receives the data.
+//! \param ui32Address is the EEPROM byte address to read from.  It must be a
+//! multiple of four and lie within the cached region.
+//! \param ui32Count is the number of bytes to read, which must be a multiple
+//! of four.
+//!
+//! This function is the cached equivalent of EEPROMRead().  The data is
+//! copied from RAM, including words that have not been written yet.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+EECacheRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    uint32_t ui32Word;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(ui32Address & 3));
+    ASSERT(!(ui32Count & 3));
+    ASSERT(ui32Address >= g_ui32EECacheBase);
+    ASSERT((ui32Address + ui32Count) <=
+           (g_ui32EECacheBase + (g_ui32EECacheWords * 4)));
+
+    for(ui32Word = (ui32Address - g_ui32EECacheBase) / 4; ui32Count;
+        ui32Count -= 4)
+    {
+        *pui32Data++ = g_pui32EECache[ui32Word++];
+    }
+}
+
+//*****************************************************************************
+//
+//! Writes data through the EEPROM cache.
+//!
+//! \param pui32Data is a pointer to the data to write.
+//! \param ui32Address is the EEPROM byte address to write to.  It must be a
+//! multiple of four and lie within the cached region.
+//! \param ui32Count is the number of bytes to write, which must be a
+//! multiple of four.
+//!
+//! This function is the cached equivalent of EEPROMProgram().  It updates the
+//! RAM copy and returns without waiting for the EEPROM.  Words whose value
+//! does not change are dropped, and a word written several times before it
+//! reaches the EEPROM is only programmed once, with its latest value.  The
+//! changed words are written in the background, one per EEPROM interrupt.
+//!
+//! This function may be called from thread or interrupt context.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+EECacheWrite(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    uint32_t ui32Word, ui32Enabled;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(ui32Address & 3));
+    ASSERT(!(ui32Count & 3));
+    ASSERT(ui32Address >= g_ui32EECacheBase);
+    ASSERT((ui32Address + ui32Count) <=
+           (g_ui32EECacheBase + (g_ui32EECacheWords * 4)));
+
+    //
+    // Keep the flash interrupt from starting a write while the cache is
+    // updated.
+    //
+    ui32Enabled = IntIsEnabled(INT_FLASH_TM4C123);
+    IntDisable(INT_FLASH_TM4C123);
+
+    //
+    // Update the words that change and mark them dirty.
+    //
+    for(ui32Word = (ui32Address - g_ui32EECacheBase) / 4; ui32Count;
+        ui32Count -= 4, ui32Word++, pui32Data++)
+    {
+        if(g_pui32EECache[ui32Word] != *pui32Data)
+        {
+            g_pui32EECache[ui32Word] = *pui32Data;
+            g_pui32EECacheDirty[ui32Word / 32] |= ((uint32_t)1 <<
+                                                   (ui32Word % 32));
+        }
+    }
+
+    //
+    // Start writing if the EEPROM is not already busy with the cache.
+    //
+    if(!g_bEECacheBusy)
+    {
+        _EECacheStart();
+    }
+
+    if(ui32Enabled)
+    {
+        IntEnable(INT_FLASH_TM4C123);
+    }
+}
+
+//*****************************************************************************
+//
+//! Determines whether the EEPROM cache holds data not yet written.
+//!
+//! \return Returns \b true if a word is being written or is waiting to be
+//! written, and \b false if the EEPROM matches the cache.
+//
+//*****************************************************************************
+bool
+EECacheDirty(void)
+{
+    uint32_t ui32Idx;
+
+    if(g_bEECacheBusy)
+    {
+        return(true);
+    }
+
+    for(ui32Idx = 0; ui32Idx < EECacheDirtyWords(g_ui32EECacheWords * 4);
+        ui32Idx++)
+    {
+        if(g_pui32EECacheDirty[ui32Idx])
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+//! Waits until every cached write has reached the EEPROM.
+//!
+//! This function is a barrier: when it returns, every value passed to
+//! EECacheWrite() before the call has been programmed.  It is intended for
+//! use before a reset or power down.
+//!
+//! The writes are done by EECacheIntHandler(), so this function must not be
+//! called with the flash interrupt masked or from an interrupt handler of
+//! the same or higher priority.
+//!
+//! \return Returns the error flags of the writes that failed since the last
+//! call, or 0 if all writes succeeded.  This is a logical OR of the flags
+//! reported by EEPROMStatusGet() for each write other than
+//! \b EEPROM_RC_WORKING, so \b EEPROM_RC_NOPERM means that a word was in a
+//! write-protected block.
+//
+//*****************************************************************************
+uint32_t
+EECacheSync(void)
+{
+    uint32_t ui32Status;
+
+    while(EECacheDirty())
+    {
+    }
+
+    ui32Status = g_ui32EECacheStatus;
+    g_ui32EECacheStatus = 0;
+
+    return(ui32Status);
+}
+
+//*****************************************************************************
+//
+//! Handles the EEPROM interrupt for the write-back cache.
+//!
+//! This function must be called from the flash interrupt handler.  When the
+//! EEPROM has finished writing a word, it starts the next dirty word.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+EECacheIntHandler(void)
+{
+    //
+    // Only the EEPROM write-complete interrupt is of interest.
+    //
+    if(EEPROMIntStatus(true) == 0)
+    {
+        return;
+    }
+    EEPROMIntClear(EEPROM_INT_PROGRAM);
+
+    if(!g_bEECacheBusy)
+    {
+        return;
+    }
+
+    //
+    // Record every error flag of the word that just completed, then move
+    // on.
+    //
+    g_ui32EECacheStatus |= EEPROMStatusGet() & _EECACHE_RC_ERRORS;
+
+    _EECacheStart();
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,877 @@
+//*****************************************************************************
+//
+// eekv.c - Log-structured, wear-leveled key-value store for the EEPROM.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup eekv_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/debug.h"
+#include "driverlib/eekv.h"
+#include "driverlib/eeprom.h"
+#include "driverlib/sw_crc.h"
+
+//*****************************************************************************
+//
+// The first word of a valid page header ("EEKV").
+//
+//*****************************************************************************
+#define EEKV_PAGE_MAGIC         0x564b4545
+
+//*****************************************************************************
+//
+// The value of the length field of a record that marks a key as deleted.
+//
+//*****************************************************************************
+#define EEKV_TOMBSTONE          0x0000ffff
+
+//*****************************************************************************
+//
+// Values stored in the RAM index.  An entry holds the EEPROM address of the
+// newest record for the key, with the deleted flag set if that record is a
+// tombstone.
+//
+//*****************************************************************************
+#define EEKV_INDEX_NONE         0xffffffff
+#define EEKV_INDEX_DELETED      0x80000000
+
+//*****************************************************************************
+//
+// The number of words moved at a time when a record is relocated.
+//
+//*****************************************************************************
+#define EEKV_COPY_WORDS         8
+
+//*****************************************************************************
+//
+// Returns the EEPROM address of a page.
+//
+//*****************************************************************************
+static uint32_t
+_EEKVPageAddr(tEEKVStore *psStore, uint32_t ui32Page)
+{
+    return(psStore->ui32Base + (ui32Page * psStore->ui32PageSize));
+}
+
+//*****************************************************************************
+//
+// Returns the number of pages that are neither in use nor being written.
+//
+//*****************************************************************************
+static uint32_t
+_EEKVFreePages(tEEKVStore *psStore)
+{
+    return((psStore->ui32Tail + psStore->ui32Pages - psStore->ui32Head - 1) %
+           psStore->ui32Pages);
+}
+
+//*****************************************************************************
+//
+// Reads a page header.  Returns true and the sequence number the page was
+// opened with if the header is valid.
+//
+//*****************************************************************************
+static bool
+_EEKVPageCheck(tEEKVStore *psStore, uint32_t ui32Page, uint32_t *pui32Seq)
+{
+    uint32_t pui32Header[3];
+
+    psStore->pfnRead(pui32Header, _EEKVPageAddr(psStore, ui32Page),
+                     sizeof(pui32Header));
+    if((pui32Header[0] != EEKV_PAGE_MAGIC) ||
+       (pui32Header[2] != (Crc32(0xffffffff, (uint8_t *)pui32Header, 8) ^
+                           0xffffffff)))
+    {
+        return(false);
+    }
+
+    *pui32Seq = pui32Header[1];
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Writes a page header, making the page the one being written.  Records
+// left in the page from its previous use are older than the header and are
+// ignored from then on.
+//
+//*****************************************************************************
+static int32_t
+_EEKVPageWrite(tEEKVStore *psStore, uint32_t ui32Page)
+{
+    uint32_t pui32Header[3];
+
+    pui32Header[0] = EEKV_PAGE_MAGIC;
+    pui32Header[1] = psStore->ui32Seq++;
+    pui32Header[2] = (Crc32(0xffffffff, (uint8_t *)pui32Header, 8) ^
+                      0xffffffff);
+
+    psStore->ui32Head = ui32Page;
+    psStore->ui32Offset = psStore->ui32PageSize;
+    if(psStore->pfnProgram(pui32Header, _EEKVPageAddr(psStore, ui32Page),
+                           sizeof(pui32Header)) != 0)
+    {
+        return(EEKV_ERR_PROGRAM);
+    }
+    psStore->ui32Offset = EEKV_PAGE_OVERHEAD;
+
+    return(EEKV_OK);
+}
+
+//*****************************************************************************
+//
+// Invalidates the header of a page whose records are no longer needed, so
+// that the page is known to be free when the store is next mounted.  The
+// sequence number and CRC are cleared rather than the first word, since the
+// first word is programmed first when the page is opened again, and a write
+// interrupted at that point would otherwise bring back the old header.
+//
+//*****************************************************************************
+static int32_t
+_EEKVPageErase(tEEKVStore *psStore, uint32_t ui32Page)
+{
+    uint32_t pui32Header[2];
+
+    pui32Header[0] = 0;
+    pui32Header[1] = 0;
+    if(psStore->pfnProgram(pui32Header, _EEKVPageAddr(psStore, ui32Page) + 4,
+                           sizeof(pui32Header)) != 0)
+    {
+        return(EEKV_ERR_PROGRAM);
+    }
+
+    return(EEKV_OK);
+}
+
+//*****************************************************************************
+//
+// Checks the record at the given address.  Returns true and the header,
+// sequence number and data length of the record if it is complete and its
+// CRC matches.
+//
+//*****************************************************************************
+static bool
+_EEKVRecordCheck(tEEKVStore *psStore, uint32_t ui32Addr, uint32_t ui32End,
+                 uint32_t ui32PageSeq, uint32_t *pui32Record,
+                 uint32_t *pui32Length)
+{
+    uint32_t pui32Buffer[EEKV_COPY_WORDS];
+    uint32_t ui32Length, ui32Idx, ui32Count, ui32Crc;
+
+    //
+    // Read the header and sequence number.
+    //
+    if((ui32Addr + EEKV_RECORD_OVERHEAD) > ui32End)
+    {
+        return(false);
+    }
+    psStore->pfnRead(pui32Record, ui32Addr, 8);
+    if(pui32Record[0] == 0xffffffff)
+    {
+        return(false);
+    }
+
+    //
+    // A record must fit the page and be newer than the page header, or it
+    // is left over from a previous use of the page.
+    //
+    ui32Length = pui32Record[0] & 0xffff;
+    if(ui32Length == EEKV_TOMBSTONE)
+    {
+        ui32Length = 0;
+    }
+    if((ui32Length & 3) ||
+       ((ui32Addr + EEKV_RECORD_OVERHEAD + ui32Length) > ui32End) ||
+       (pui32Record[1] < ui32PageSeq))
+    {
+        return(false);
+    }
+
+    //
+    // Check the CRC over the header, sequence number and data.
+    //
+    ui32Crc = Crc32(0xffffffff, (uint8_t *)pui32Record, 8);
+    for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx += ui32Count)
+    {
+        ui32Count = ui32Length - ui32Idx;
+        if(ui32Count > sizeof(pui32Buffer))
+        {
+            ui32Count = sizeof(pui32Buffer);
+        }
+        psStore->pfnRead(pui32Buffer, ui32Addr + 8 + ui32Idx, ui32Count);
+        ui32Crc = Crc32(ui32Crc, (uint8_t *)pui32Buffer, ui32Count);
+    }
+    psStore->pfnRead(pui32Buffer, ui32Addr + 8 + ui32Length, 4);
+    if(pui32Buffer[0] != (ui32Crc ^ 0xffffffff))
+    {
+        return(false);
+    }
+
+    *pui32Length = ui32Length;
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Appends a record to the page being written, which must have room for it.
+// The data comes from RAM, or is copied from an existing record in the
+// EEPROM if pui32Data is 0.
+//
+// The data and CRC are programmed before the header.  A record whose write
+// is interrupted by a power failure therefore either has no header or fails
+// its CRC check, and is ignored when the store is next mounted, leaving the
+// previous value of the key in effect.
+//
+//*****************************************************************************
+static int32_t
+_EEKVAppend(tEEKVStore *psStore, uint32_t ui32Header, uint32_t *pui32Data,
+            uint32_t ui32Src)
+{
+    uint32_t pui32Buffer[EEKV_COPY_WORDS], pui32Record[2];
+    uint32_t ui32Addr, ui32Length, ui32Idx, ui32Count, ui32Crc, ui32Key;
+
+    ui32Key = ui32Header >> 16;
+    ui32Length = ui32Header & 0xffff;
+    if(ui32Length == EEKV_TOMBSTONE)
+    {
+        ui32Length = 0;
+    }
+    ASSERT((psStore->ui32Offset + EEKV_RECORD_OVERHEAD + ui32Length) <=
+           psStore->ui32PageSize);
+
+    ui32Addr = _EEKVPageAddr(psStore, psStore->ui32Head) + psStore->ui32Offset;
+    pui32Record[0] = ui32Header;
+    pui32Record[1] = psStore->ui32Seq;
+
+    //
+    // Once any part of the record has been written, the rest of the page is
+    // not used if the write fails, so a bad record never sits in front of a
+    // good one.
+    //
+    psStore->ui32Offset = psStore->ui32PageSize;
+
+    //
+    // Program the data, accumulating the CRC as it goes.
+    //
+    ui32Crc = Crc32(0xffffffff, (uint8_t *)pui32Record, 8);
+    if(pui32Data)
+    {
+        ui32Crc = Crc32(ui32Crc, (uint8_t *)pui32Data, ui32Length);
+        if(ui32Length &&
+           (psStore->pfnProgram(pui32Data, ui32Addr + 8, ui32Length) != 0))
+        {
+            return(EEKV_ERR_PROGRAM);
+        }
+    }
+    else
+    {
+        for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx += ui32Count)
+        {
+            ui32Count = ui32Length - ui32Idx;
+            if(ui32Count > sizeof(pui32Buffer))
+            {
+                ui32Count = sizeof(pui32Buffer);
+            }
+            psStore->pfnRead(pui32Buffer, ui32Src + ui32Idx, ui32Count);
+            ui32Crc = Crc32(ui32Crc, (uint8_t *)pui32Buffer, ui32Count);
+            if(psStore->pfnProgram(pui32Buffer, ui32Addr + 8 + ui32Idx,
+                                   ui32Count) != 0)
+            {
+                return(EEKV_ERR_PROGRAM);
+            }
+        }
+    }
+
+    //
+    // Program the CRC and then the header, which commits the record.
+    //
+    ui32Crc ^= 0xffffffff;
+    if((psStore->pfnProgram(&ui32Crc, ui32Addr + 8 + ui32Length, 4) != 0) ||
+       (psStore->pfnProgram(pui32Record, ui32Addr, 8) != 0))
+    {
+        return(EEKV_ERR_PROGRAM);
+    }
+
+    //
+    // The record is committed, so account for it and point the index at it.
+    //
+    psStore->ui32Seq++;
+    psStore->ui32Offset = ((ui32Addr + EEKV_RECORD_OVERHEAD + ui32Length) -
+                           _EEKVPageAddr(psStore, psStore->ui32Head));
+    psStore->pui32Index[ui32Key] = (ui32Addr |
+                                    (((ui32Header & 0xffff) ==
+                                      EEKV_TOMBSTONE) ?
+                                     EEKV_INDEX_DELETED : 0));
+
+    return(EEKV_OK);
+}
+
+//*****************************************************************************
+//
+// Reclaims the oldest page in use by moving its live records to the page
+// being written.  Tombstones are dropped, since every older record of their
+// key is in this page or in a page that has already been reclaimed.
+//
+// The page header is invalidated once every live record has been moved.  If
+// power is lost before then, the page is still in use when the store is
+// next mounted, and the records that were already moved are superseded by
+// their copies.  A page is never opened over the page being reclaimed; if
+// no page is free, nothing more is moved and false is returned.
+//
+//*****************************************************************************
+static bool
+_EEKVCompactTail(tEEKVStore *psStore)
+{
+    uint32_t pui32Record[2];
+    uint32_t ui32Page, ui32Addr, ui32End, ui32PageSeq, ui32Length, ui32Key;
+    bool bValid;
+
+    //
+    // The page being written is never reclaimed.
+    //
+    ui32Page = psStore->ui32Tail;
+    if(ui32Page == psStore->ui32Head)
+    {
+        return(false);
+    }
+
+    bValid = _EEKVPageCheck(psStore, ui32Page, &ui32PageSeq);
+    if(bValid)
+    {
+        ui32Addr = _EEKVPageAddr(psStore, ui32Page);
+        ui32End = ui32Addr + psStore->ui32PageSize;
+        for(ui32Addr += EEKV_PAGE_OVERHEAD;
+            _EEKVRecordCheck(psStore, ui32Addr, ui32End, ui32PageSeq,
+                             pui32Record, &ui32Length);
+            ui32Addr += EEKV_RECORD_OVERHEAD + ui32Length)
+        {
+            //
+            // Skip records that have been superseded.
+            //
+            ui32Key = pui32Record[0] >> 16;
+            if((ui32Key >= psStore->ui32Keys) ||
+               ((psStore->pui32Index[ui32Key] & ~EEKV_INDEX_DELETED) !=
+                ui32Addr))
+            {
+                continue;
+            }
+
+            if(psStore->pui32Index[ui32Key] & EEKV_INDEX_DELETED)
+            {
+                psStore->pui32Index[ui32Key] = EEKV_INDEX_NONE;
+                continue;
+            }
+
+            //
+            // Copy the record to the page being written, moving on to a
+            // free page if it does not fit.
+            //
+            if((psStore->ui32Offset + EEKV_RECORD_OVERHEAD + ui32Length) >
+               psStore->ui32PageSize)
+            {
+                if(_EEKVFreePages(psStore) == 0)
+                {
+                    return(false);
+                }
+                if(_EEKVPageWrite(psStore, (psStore->ui32Head + 1) %
+                                  psStore->ui32Pages) != EEKV_OK)
+                {
+                    return(false);
+                }
+            }
+            if(_EEKVAppend(psStore, pui32Record[0], 0, ui32Addr + 8) !=
+               EEKV_OK)
+            {
+                return(false);
+            }
+        }
+    }
+
+    //
+    // Nothing in the page is needed any more.
+    //
+    if(bValid && (_EEKVPageErase(psStore, ui32Page) != EEKV_OK))
+    {
+        return(false);
+    }
+    psStore->ui32Tail = (ui32Page + 1) % psStore->ui32Pages;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Appends a record for a new value or a deletion, reclaiming pages first if
+// a new page is needed and too few are free.  One free page is always kept
+// back so that the live records of the oldest page can be moved.
+//
+//*****************************************************************************
+static int32_t
+_EEKVCommit(tEEKVStore *psStore, uint32_t ui32Header, uint32_t *pui32Data)
+{
+    uint32_t ui32Size, ui32Idx;
+    int32_t i32Result;
+
+    ui32Size = EEKV_RECORD_OVERHEAD;
+    if((ui32Header & 0xffff) != EEKV_TOMBSTONE)
+    {
+        ui32Size += ui32Header & 0xffff;
+    }
+
+    if((psStore->ui32Offset + ui32Size) > psStore->ui32PageSize)
+    {
+        for(ui32Idx = 0; (ui32Idx < psStore->ui32Pages) &&
+            (_EEKVFreePages(psStore) < 2); ui32Idx++)
+        {
+            if(!_EEKVCompactTail(psStore))
+            {
+                break;
+            }
+        }
+
+        //
+        // Compaction may have opened a page with room for the record.
+        //
+        if((psStore->ui32Offset + ui32Size) > psStore->ui32PageSize)
+        {
+            if(_EEKVFreePages(psStore) < 2)
+            {
+                return(EEKV_ERR_FULL);
+            }
+            i32Result = _EEKVPageWrite(psStore, (psStore->ui32Head + 1) %
+                                       psStore->ui32Pages);
+            if(i32Result != EEKV_OK)
+            {
+                return(i32Result);
+            }
+        }
+    }
+
+    return(_EEKVAppend(psStore, ui32Header, pui32Data, 0));
+}
+
+//*****************************************************************************
+//
+//! Mounts a key-value store, formatting it if it is empty.
+//!
+//! \param psStore is a pointer to the store.  The configuration members must
+//! have been filled in.
+//!
+//! The store is a ring of pages, each holding a header and a sequence of
+//! append-only records.  A record holds a key, the length of its value, a
+//! sequence number, the value and a CRC-32.  Updating a key appends a new
+//! record rather than rewriting the old one, so writes are spread across the
+//! whole store and no EEPROM word is rewritten more often than any other.
+//!
+//! This function scans every page in use, from the oldest to the newest,
+//! and builds the RAM index from the newest valid record of each key.
+//! Records that were being written when power was lost fail their CRC
+//! check and are ignored, and compaction that was interrupted is completed.
+//! If no valid page is found, the store is formatted.
+//!
+//! The index has one word per key, so lookups take constant time.
+//!
+//! \return Returns \b EEKV_OK on success or \b EEKV_ERR_PROGRAM if the store
+//! could not be formatted.
+//
+//*****************************************************************************
+int32_t
+EEKVInit(tEEKVStore *psStore)
+{
+    uint32_t pui32Record[2];
+    uint32_t ui32Idx, ui32Page, ui32PageSeq, ui32MaxSeq, ui32Addr, ui32End;
+    uint32_t ui32Length, ui32Key;
+    bool bFound;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+    ASSERT(!(psStore->ui32Base & 3));
+    ASSERT(!(psStore->ui32PageSize & 3));
+    ASSERT(psStore->ui32PageSize > (EEKV_PAGE_OVERHEAD +
+                                    EEKV_RECORD_OVERHEAD));
+    ASSERT(psStore->ui32Pages >= 3);
+    ASSERT(psStore->pui32Index != 0);
+    ASSERT((psStore->ui32Keys != 0) && (psStore->ui32Keys <= 0xffff));
+
+    //
+    // Use the EEPROM driver unless other access functions were supplied.
+    //
+    if(psStore->pfnRead == 0)
+    {
+        psStore->pfnRead = EEPROMRead;
+    }
+    if(psStore->pfnProgram == 0)
+    {
+        psStore->pfnProgram = EEPROMProgram;
+    }
+
+    for(ui32Idx = 0; ui32Idx < psStore->ui32Keys; ui32Idx++)
+    {
+        psStore->pui32Index[ui32Idx] = EEKV_INDEX_NONE;
+    }
+
+    //
+    // The page being written is the one opened most recently.
+    //
+    bFound = false;
+    ui32MaxSeq = 0;
+    for(ui32Page = 0; ui32Page < psStore->ui32Pages; ui32Page++)
+    {
+        if(_EEKVPageCheck(psStore, ui32Page, &ui32PageSeq) &&
+           (!bFound || (ui32PageSeq > ui32MaxSeq)))
+        {
+            bFound = true;
+            ui32MaxSeq = ui32PageSeq;
+            psStore->ui32Head = ui32Page;
+        }
+    }
+
+    //
+    // Format an empty store.
+    //
+    if(!bFound)
+    {
+        psStore->ui32Seq = 0;
+        psStore->ui32Tail = 0;
+        return(_EEKVPageWrite(psStore, 0));
+    }
+
+    //
+    // Pages are opened in ring order, so the oldest page in use is the
+    // first valid page after the page being written.
+    //
+    psStore->ui32Tail = psStore->ui32Head;
+    for(ui32Idx = 1; ui32Idx < psStore->ui32Pages; ui32Idx++)
+    {
+        ui32Page = (psStore->ui32Head + ui32Idx) % psStore->ui32Pages;
+        if(_EEKVPageCheck(psStore, ui32Page, &ui32PageSeq))
+        {
+            psStore->ui32Tail = ui32Page;
+            break;
+        }
+    }
+
+    //
+    // Scan the pages from oldest to newest, so the newest record of each key
+    // ends up in the index.
+    //
+    psStore->ui32Seq = ui32MaxSeq + 1;
+    ui32Page = psStore->ui32Tail;
+    while(1)
+    {
+        if(_EEKVPageCheck(psStore, ui32Page, &ui32PageSeq))
+        {
+            ui32Addr = _EEKVPageAddr(psStore, ui32Page);
+            ui32End = ui32Addr + psStore->ui32PageSize;
+            for(ui32Addr += EEKV_PAGE_OVERHEAD;
+                _EEKVRecordCheck(psStore, ui32Addr, ui32End, ui32PageSeq,
+                                 pui32Record, &ui32Length);
+                ui32Addr += EEKV_RECORD_OVERHEAD + ui32Length)
+            {
+                ui32Key = pui32Record[0] >> 16;
+                if(ui32Key < psStore->ui32Keys)
+                {
+                    psStore->pui32Index[ui32Key] =
+                        (ui32Addr | (((pui32Record[0] & 0xffff) ==
+                                      EEKV_TOMBSTONE) ?
+                                     EEKV_INDEX_DELETED : 0));
+                }
+                if(pui32Record[1] >= psStore->ui32Seq)
+                {
+                    psStore->ui32Seq = pui32Record[1] + 1;
+                }
+            }
+
+            //
+            // New records go after the last valid record of the newest page.
+            //
+            if(ui32Page == psStore->ui32Head)
+            {
+                psStore->ui32Offset = (ui32Addr -
+                                       _EEKVPageAddr(psStore, ui32Page));
+            }
+        }
+
+        if(ui32Page == psStore->ui32Head)
+        {
+            break;
+        }
+        ui32Page = (ui32Page + 1) % psStore->ui32Pages;
+    }
+
+    //
+    // No page is free only if power was lost part way through compaction,
+    // after a page had been opened for the live records of the oldest page.
+    // Finish moving them now, before new values take the room that was set
+    // aside for them.
+    //
+    if(_EEKVFreePages(psStore) == 0)
+    {
+        _EEKVCompactTail(psStore);
+    }
+
+    return(EEKV_OK);
+}
+
+//*****************************************************************************
+//
+//! Reads the value of a key.
+//!
+//! \param psStore is a pointer to the store.
+//! \param ui32Key is the key to read.
+//! \param pui32Data is a pointer to the buffer that receives the value.
+//! \param ui32Count is the size of the buffer in bytes, which must be a
+//! multiple of four.  If the value is longer, only this many bytes are read.
+//!
+//! \return Returns the length of the value in bytes, or
+//! \b EEKV_ERR_NOTFOUND if the key has no value.
+//
+//*****************************************************************************
+int32_t
+EEKVRead(tEEKVStore *psStore, uint32_t ui32Key, uint32_t *pui32Data,
+         uint32_t ui32Count)
+{
+    uint32_t ui32Entry, ui32Header, ui32Length;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+    ASSERT(ui32Key < psStore->ui32Keys);
+    ASSERT(!(ui32Count & 3));
+
+    ui32Entry = psStore->pui32Index[ui32Key];
+    if((ui32Entry == EEKV_INDEX_NONE) || (ui32Entry & EEKV_INDEX_DELETED))
+    {
+        return(EEKV_ERR_NOTFOUND);
+    }
+
+    //
+    // The index points at the record header, which gives the length.
+    //
+    psStore->pfnRead(&ui32Header, ui32Entry, 4);
+    ui32Length = ui32Header & 0xffff;
+    if(ui32Count > ui32Length)
+    {
+        ui32Count = ui32Length;
+    }
+    if(ui32Count)
+    {
+        psStore->pfnRead(pui32Data, ui32Entry + 8, ui32Count);
+    }
+
+    return((int32_t)ui32Length);
+}
+
+//*****************************************************************************
+//
+//! Writes the value of a key.
+//!
+//! \param psStore is a pointer to the store.
+//! \param ui32Key is the key to write.
+//! \param pui32Data is a pointer to the value.
+//! \param ui32Count is the length of the value in bytes, which must be a
+//! multiple of four.
+//!
+//! This function appends a record holding the new value.  If the key
+//! already holds the same value, nothing is written.  The new value takes
+//! effect once its record has been completely written; if power is lost
+//! before then, the key keeps its previous value.
+//!
+//! If the page being written is full, the next page is opened.  When fewer
+//! than two pages are free, the oldest pages are compacted first; calling
+//! EEKVCompact() from idle time makes this rare.
+//!
+//! \return Returns \b EEKV_OK on success, \b EEKV_ERR_SIZE if the value does
+//! not fit in a page, \b EEKV_ERR_FULL if the live values fill the store, or
+//! \b EEKV_ERR_PROGRAM if the EEPROM reported an error.
+//
+//*****************************************************************************
+int32_t
+EEKVWrite(tEEKVStore *psStore, uint32_t ui32Key, uint32_t *pui32Data,
+          uint32_t ui32Count)
+{
+    uint32_t ui32Entry, ui32Header, ui32Idx, ui32Word;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+    ASSERT(ui32Key < psStore->ui32Keys);
+    ASSERT(!(ui32Count & 3));
+
+    if(ui32Count > (psStore->ui32PageSize - EEKV_PAGE_OVERHEAD -
+                    EEKV_RECORD_OVERHEAD))
+    {
+        return(EEKV_ERR_SIZE);
+    }
+
+    //
+    // Skip the write if the key already holds this value.
+    //
+    ui32Entry = psStore->pui32Index[ui32Key];
+    if((ui32Entry != EEKV_INDEX_NONE) && !(ui32Entry & EEKV_INDEX_DELETED))
+    {
+        psStore->pfnRead(&ui32Header, ui32Entry, 4);
+        if((ui32Header & 0xffff) == ui32Count)
+        {
+            for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx += 4)
+            {
+                psStore->pfnRead(&ui32Word, ui32Entry + 8 + ui32Idx, 4);
+                if(ui32Word != pui32Data[ui32Idx / 4])
+                {
+                    break;
+                }
+            }
+            if(ui32Idx == ui32Count)
+            {
+                return(EEKV_OK);
+            }
+        }
+    }
+
+    return(_EEKVCommit(psStore, (ui32Key << 16) | ui32Count, pui32Data));
+}
+
+//*****************************************************************************
+//
+//! Deletes a key.
+//!
+//! \param psStore is a pointer to the store.
+//! \param ui32Key is the key to delete.
+//!
+//! This function appends a tombstone record for the key.  The tombstone is
+//! dropped when the page holding it is compacted.
+//!
+//! \return Returns \b EEKV_OK on success, \b EEKV_ERR_NOTFOUND if the key
+//! has no value, or one of the errors returned by EEKVWrite().
+//
+//*****************************************************************************
+int32_t
+EEKVDelete(tEEKVStore *psStore, uint32_t ui32Key)
+{
+    uint32_t ui32Entry;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+    ASSERT(ui32Key < psStore->ui32Keys);
+
+    ui32Entry = psStore->pui32Index[ui32Key];
+    if((ui32Entry == EEKV_INDEX_NONE) || (ui32Entry & EEKV_INDEX_DELETED))
+    {
+        return(EEKV_ERR_NOTFOUND);
+    }
+
+    return(_EEKVCommit(psStore, (ui32Key << 16) | EEKV_TOMBSTONE, 0));
+}
+
+//*****************************************************************************
+//
+//! Performs background compaction of a key-value store.
+//!
+//! \param psStore is a pointer to the store.
+//!
+//! This function reclaims the oldest page in use if fewer than a quarter of
+//! the pages, plus two, are free.  The live records of the page are moved to
+//! the page being written.  It is intended to be called from the idle loop,
+//! so that EEKVWrite() seldom has to compact before it can write.
+//!
+//! \return Returns \b true if a page was reclaimed and \b false if no
+//! compaction was needed or it could not be done.
+//
+//*****************************************************************************
+bool
+EEKVCompact(tEEKVStore *psStore)
+{
+    uint32_t ui32Target;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+
+    ui32Target = (psStore->ui32Pages / 4) + 2;
+    if(ui32Target > (psStore->ui32Pages - 1))
+    {
+        ui32Target = psStore->ui32Pages - 1;
+    }
+
+    if(_EEKVFreePages(psStore) >= ui32Target)
+    {
+        return(false);
+    }
+
+    return(_EEKVCompactTail(psStore));
+}
+
+//*****************************************************************************
+//
+//! Returns the number of free pages in a key-value store.
+//!
+//! \param psStore is a pointer to the store.
+//!
+//! \return Returns the number of pages that hold no live records and are not
+//! being written.
+//
+//*****************************************************************************
+uint32_t
+EEKVFreePagesGet(tEEKVStore *psStore)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStore != 0);
+
+    return(_EEKVFreePages(psStore));
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
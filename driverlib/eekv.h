@@ -0,0 +1,159 @@
+//*****************************************************************************
+//
+// eekv.h - Prototypes for the log-structured EEPROM key-value store.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_EEKV_H__
+#define __DRIVERLIB_EEKV_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values returned by the key-value store functions.
+//
+//*****************************************************************************
+#define EEKV_OK                 0           // Success
+#define EEKV_ERR_NOTFOUND       (-1)        // The key has no value
+#define EEKV_ERR_FULL           (-2)        // No room, even after compaction
+#define EEKV_ERR_SIZE           (-3)        // The value does not fit a page
+#define EEKV_ERR_PROGRAM        (-4)        // The EEPROM reported an error
+
+//*****************************************************************************
+//
+// The number of bytes of overhead in each page and in each record.
+//
+//*****************************************************************************
+#define EEKV_PAGE_OVERHEAD      12
+#define EEKV_RECORD_OVERHEAD    12
+
+//*****************************************************************************
+//
+//! This structure holds the configuration and state of a key-value store.
+//! The application fills in the configuration members before calling
+//! EEKVInit(); the remaining members are maintained by the store.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The EEPROM byte address of the start of the store.  It must be word
+    //! aligned.
+    //
+    uint32_t ui32Base;
+
+    //
+    //! The size of each page in bytes.  It must be a multiple of four.  A
+    //! value can be at most \b EEKV_PAGE_OVERHEAD plus
+    //! \b EEKV_RECORD_OVERHEAD bytes smaller than a page.
+    //
+    uint32_t ui32PageSize;
+
+    //
+    //! The number of pages in the store, which must be at least three.
+    //
+    uint32_t ui32Pages;
+
+    //
+    //! The RAM index, with one word for each key.
+    //
+    uint32_t *pui32Index;
+
+    //
+    //! The number of keys; keys range from 0 to this value minus one.  At
+    //! most 65535 keys are allowed, since the tombstone of key 65535 would
+    //! read as blank EEPROM.
+    //
+    uint32_t ui32Keys;
+
+    //
+    //! The function used to read the EEPROM, or 0 to use EEPROMRead().
+    //
+    void (*pfnRead)(uint32_t *pui32Data, uint32_t ui32Address,
+                    uint32_t ui32Count);
+
+    //
+    //! The function used to program the EEPROM, or 0 to use
+    //! EEPROMProgram().
+    //
+    uint32_t (*pfnProgram)(uint32_t *pui32Data, uint32_t ui32Address,
+                           uint32_t ui32Count);
+
+    //
+    // The page being written, the oldest page in use, the offset of the
+    // next record in the page being written, and the next sequence number.
+    //
+    uint32_t ui32Head;
+    uint32_t ui32Tail;
+    uint32_t ui32Offset;
+    uint32_t ui32Seq;
+}
+tEEKVStore;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern int32_t EEKVInit(tEEKVStore *psStore);
+extern int32_t EEKVRead(tEEKVStore *psStore, uint32_t ui32Key,
+                        uint32_t *pui32Data, uint32_t ui32Count);
+extern int32_t EEKVWrite(tEEKVStore *psStore, uint32_t ui32Key,
+                         uint32_t *pui32Data, uint32_t ui32Count);
+extern int32_t EEKVDelete(tEEKVStore *psStore, uint32_t ui32Key);
+extern bool EEKVCompact(tEEKVStore *psStore);
+extern uint32_t EEKVFreePagesGet(tEEKVStore *psStore);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_EEKV_H__
@@ -372,6 +372,9 @@ EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
 //! word-aligned address.  The call is synchronous and returns only after
 //! all data has been written or an error occurs.
 //!
+//! \note For frequent small updates from time-critical code, use
+//! EECacheWrite(), which returns at once and writes in the background.
+//!
 //! \return Returns 0 on success or non-zero values on failure.  Failure codes
 //! are logical OR combinations of \b EEPROM_RC_WRBUSY, \b EEPROM_RC_NOPERM,
 //! \b EEPROM_RC_WKCOPY, \b EEPROM_RC_WKERASE, and \b EEPROM_RC_WORKING.
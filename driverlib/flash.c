@@ -185,6 +185,9 @@ FlashErase(uint32_t ui32Address)
 //!
 //! This function does not return until the data has been programmed.
 //!
+//! \note To program large images without stalling the application, use
+//! FlashQSubmit(), which programs one write buffer per flash interrupt.
+//!
 //! \return Returns 0 on success, or -1 if a programming error is encountered.
 //
 //*****************************************************************************
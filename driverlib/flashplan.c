@@ -0,0 +1,391 @@
+//*****************************************************************************
+//
+// flashplan.c - Sector-aware flash update planner.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup flashplan_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/flash.h"
+#include "driverlib/flashplan.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The size of the flash write buffer in bytes.  Programming is done in
+// blocks of this size, aligned to its size.
+//
+//*****************************************************************************
+#define FLASHPLAN_BLOCK_SIZE    0x80
+
+//*****************************************************************************
+//
+// Returns the offset of the end of the write buffer block containing the
+// given offset, limited to the end of the range being updated.
+//
+//*****************************************************************************
+static uint32_t
+_FlashPlanBlockEnd(uint32_t ui32Address, uint32_t ui32Offset,
+                   uint32_t ui32Count)
+{
+    uint32_t ui32End;
+
+    ui32End = (((ui32Address + ui32Offset) & ~(FLASHPLAN_BLOCK_SIZE - 1)) +
+               FLASHPLAN_BLOCK_SIZE - ui32Address);
+    return((ui32End < ui32Count) ? ui32End : ui32Count);
+}
+
+//*****************************************************************************
+//
+// Determines whether any word of an image range differs from the erased
+// state.
+//
+//*****************************************************************************
+static bool
+_FlashPlanBlockUsed(uint32_t *pui32Image, uint32_t ui32Start,
+                    uint32_t ui32End)
+{
+    for(; ui32Start < ui32End; ui32Start += 4)
+    {
+        if(pui32Image[ui32Start / 4] != 0xffffffff)
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Programs a freshly erased sector.  Blocks that are entirely 0xFF in the
+// image are skipped, and runs of adjacent blocks are merged into a single
+// FlashProgram() call.
+//
+//*****************************************************************************
+static int32_t
+_FlashPlanProgramErased(uint32_t ui32Address, uint32_t *pui32Image,
+                        uint32_t ui32Count, tFlashPlanStats *psStats)
+{
+    uint32_t ui32Offset, ui32Start, ui32End;
+
+    for(ui32Offset = 0; ui32Offset < ui32Count; )
+    {
+        //
+        // Skip blocks that the erase already left in the right state.
+        //
+        ui32End = _FlashPlanBlockEnd(ui32Address, ui32Offset, ui32Count);
+        if(!_FlashPlanBlockUsed(pui32Image, ui32Offset, ui32End))
+        {
+            ui32Offset = ui32End;
+            continue;
+        }
+
+        //
+        // Extend the run over the following blocks that need programming.
+        //
+        ui32Start = ui32Offset;
+        do
+        {
+            psStats->ui32BlocksProgrammed++;
+            ui32Offset = ui32End;
+            ui32End = _FlashPlanBlockEnd(ui32Address, ui32Offset, ui32Count);
+        }
+        while((ui32Offset < ui32Count) &&
+              _FlashPlanBlockUsed(pui32Image, ui32Offset, ui32End));
+
+        psStats->ui32ProgramCalls++;
+        if(FlashProgram(pui32Image + (ui32Start / 4), ui32Address + ui32Start,
+                        ui32Offset - ui32Start) != 0)
+        {
+            return(-1);
+        }
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Programs the words of a sector that differ from the image, all of which
+// are known to be erased.  Words that already hold their value are never
+// programmed again.
+//
+//*****************************************************************************
+static int32_t
+_FlashPlanProgramChanged(uint32_t ui32Address, uint32_t *pui32Image,
+                         uint32_t ui32Count, tFlashPlanStats *psStats)
+{
+    uint32_t ui32Offset, ui32Start, ui32Block, ui32LastBlock;
+
+    ui32LastBlock = 0xffffffff;
+    for(ui32Offset = 0; ui32Offset < ui32Count; )
+    {
+        if(HWREG(ui32Address + ui32Offset) == pui32Image[ui32Offset / 4])
+        {
+            ui32Offset += 4;
+            continue;
+        }
+
+        //
+        // Find the end of this run of changed words.
+        //
+        ui32Start = ui32Offset;
+        while((ui32Offset < ui32Count) &&
+              (HWREG(ui32Address + ui32Offset) != pui32Image[ui32Offset / 4]))
+        {
+            ui32Offset += 4;
+        }
+
+        //
+        // Count the write buffer blocks touched, not counting a block shared
+        // with the previous run twice.
+        //
+        ui32Block = (ui32Address + ui32Start) / FLASHPLAN_BLOCK_SIZE;
+        psStats->ui32BlocksProgrammed +=
+            (((ui32Address + ui32Offset - 4) / FLASHPLAN_BLOCK_SIZE) -
+             ui32Block + 1 - ((ui32Block == ui32LastBlock) ? 1 : 0));
+        ui32LastBlock = (ui32Address + ui32Offset - 4) / FLASHPLAN_BLOCK_SIZE;
+
+        psStats->ui32ProgramCalls++;
+        if(FlashProgram(pui32Image + (ui32Start / 4), ui32Address + ui32Start,
+                        ui32Offset - ui32Start) != 0)
+        {
+            return(-1);
+        }
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+//! Determines what is needed to bring one flash sector up to date.
+//!
+//! \param ui32Address is the start address of the sector.
+//! \param pui32Image is a pointer to the new contents of the sector.
+//! \param ui32Count is the number of bytes to compare, which must be a
+//! multiple of four and no larger than the sector size.
+//!
+//! This function compares the current flash contents directly against the
+//! image.  Flash is memory mapped, so a direct comparison is cheaper than
+//! computing and comparing a CRC of both.
+//!
+//! \return Returns \b FLASHPLAN_SECTOR_SAME if the sector already holds the
+//! image, \b FLASHPLAN_SECTOR_PROGRAM if every word that differs is still
+//! erased so the sector can be programmed without an erase, or
+//! \b FLASHPLAN_SECTOR_ERASE if the sector must be erased first.
+//
+//*****************************************************************************
+uint32_t
+FlashPlanSectorCheck(uint32_t ui32Address, uint32_t *pui32Image,
+                     uint32_t ui32Count)
+{
+    uint32_t ui32Offset, ui32Flash, ui32Result;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(ui32Address & 3));
+    ASSERT(!(ui32Count & 3));
+
+    ui32Result = FLASHPLAN_SECTOR_SAME;
+    for(ui32Offset = 0; ui32Offset < ui32Count; ui32Offset += 4)
+    {
+        ui32Flash = HWREG(ui32Address + ui32Offset);
+        if(ui32Flash != pui32Image[ui32Offset / 4])
+        {
+            //
+            // A word that has already been programmed cannot be changed
+            // without an erase.
+            //
+            if(ui32Flash != 0xffffffff)
+            {
+                return(FLASHPLAN_SECTOR_ERASE);
+            }
+            ui32Result = FLASHPLAN_SECTOR_PROGRAM;
+        }
+    }
+
+    return(ui32Result);
+}
+
+//*****************************************************************************
+//
+//! Updates a region of flash with a new image, touching only what changed.
+//!
+//! \param ui32Address is the start address of the region, which must be
+//! aligned to the flash sector size.
+//! \param pui32Image is a pointer to the new image.
+//! \param ui32Count is the number of bytes in the image, which must be a
+//! multiple of four.
+//! \param psStats is a pointer to a structure that receives the amount of
+//! work done, or 0 if it is not required.
+//!
+//! This function walks the region one sector at a time, using the sector
+//! size reported by SysCtlFlashSectorSizeGet(), and handles each sector
+//! according to FlashPlanSectorCheck():
+//!
+//! - A sector that already holds the image is skipped.
+//! - A sector in which only erased words differ is not erased; only the
+//!   changed words are programmed.
+//! - Any other sector is erased, and then only the write buffer blocks that
+//!   are not entirely 0xFF in the image are programmed.
+//!
+//! Adjacent blocks are merged into a single FlashProgram() call.  Each
+//! sector is compared against the image again after it has been written.
+//!
+//! If the image ends part way through a sector and that sector has to be
+//! erased, the flash after the end of the image in that sector is erased
+//! too.
+//!
+//! This function does not return until the update has completed.
+//!
+//! \return Returns 0 on success, or -1 if an erase or program failed or a
+//! sector did not match the image after it was written.
+//
+//*****************************************************************************
+int32_t
+FlashPlanUpdate(uint32_t ui32Address, uint32_t *pui32Image,
+                uint32_t ui32Count, tFlashPlanStats *psStats)
+{
+    tFlashPlanStats sStats;
+    uint32_t ui32Sector, ui32Offset, ui32Length;
+    int32_t i32Result;
+
+    ui32Sector = SysCtlFlashSectorSizeGet();
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(ui32Address & (ui32Sector - 1)));
+    ASSERT(!(ui32Count & 3));
+    ASSERT(pui32Image != 0);
+
+    sStats.ui32SectorsErased = 0;
+    sStats.ui32SectorsSkipped = 0;
+    sStats.ui32BlocksProgrammed = 0;
+    sStats.ui32ProgramCalls = 0;
+    i32Result = 0;
+
+    for(ui32Offset = 0; ui32Offset < ui32Count; ui32Offset += ui32Sector)
+    {
+        ui32Length = ui32Count - ui32Offset;
+        if(ui32Length > ui32Sector)
+        {
+            ui32Length = ui32Sector;
+        }
+
+        switch(FlashPlanSectorCheck(ui32Address + ui32Offset,
+                                    pui32Image + (ui32Offset / 4),
+                                    ui32Length))
+        {
+            //
+            // Nothing has changed in this sector.
+            //
+            case FLASHPLAN_SECTOR_SAME:
+            {
+                sStats.ui32SectorsSkipped++;
+                continue;
+            }
+
+            //
+            // Only erased words have changed, so program them in place.
+            //
+            case FLASHPLAN_SECTOR_PROGRAM:
+            {
+                i32Result = _FlashPlanProgramChanged(ui32Address + ui32Offset,
+                                                     pui32Image +
+                                                     (ui32Offset / 4),
+                                                     ui32Length, &sStats);
+                break;
+            }
+
+            //
+            // Erase the sector and program the blocks that are not blank.
+            //
+            default:
+            {
+                sStats.ui32SectorsErased++;
+                i32Result = FlashErase(ui32Address + ui32Offset);
+                if(i32Result == 0)
+                {
+                    i32Result = _FlashPlanProgramErased(ui32Address +
+                                                        ui32Offset,
+                                                        pui32Image +
+                                                        (ui32Offset / 4),
+                                                        ui32Length, &sStats);
+                }
+                break;
+            }
+        }
+
+        //
+        // Make sure the sector now holds the image.
+        //
+        if((i32Result != 0) ||
+           (FlashPlanSectorCheck(ui32Address + ui32Offset,
+                                 pui32Image + (ui32Offset / 4),
+                                 ui32Length) != FLASHPLAN_SECTOR_SAME))
+        {
+            i32Result = -1;
+            break;
+        }
+    }
+
+    if(psStats)
+    {
+        *psStats = sStats;
+    }
+
+    return(i32Result);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
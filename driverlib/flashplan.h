@@ -0,0 +1,114 @@
+//*****************************************************************************
+//
+// flashplan.h - Prototypes for the sector-aware flash update planner.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_FLASHPLAN_H__
+#define __DRIVERLIB_FLASHPLAN_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values returned by FlashPlanSectorCheck().
+//
+//*****************************************************************************
+#define FLASHPLAN_SECTOR_SAME   0x00000000  // Sector already holds the image
+#define FLASHPLAN_SECTOR_PROGRAM \
+                                0x00000001  // Only erased words must change
+#define FLASHPLAN_SECTOR_ERASE  0x00000002  // Sector must be erased
+
+//*****************************************************************************
+//
+//! This structure receives the work done by FlashPlanUpdate().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of sectors that were erased.
+    //
+    uint32_t ui32SectorsErased;
+
+    //
+    //! The number of sectors that already held the image and were skipped.
+    //
+    uint32_t ui32SectorsSkipped;
+
+    //
+    //! The number of 32-word write buffer blocks that were programmed.
+    //
+    uint32_t ui32BlocksProgrammed;
+
+    //
+    //! The number of FlashProgram() calls made after merging adjacent
+    //! blocks.
+    //
+    uint32_t ui32ProgramCalls;
+}
+tFlashPlanStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern uint32_t FlashPlanSectorCheck(uint32_t ui32Address,
+                                     uint32_t *pui32Image,
+                                     uint32_t ui32Count);
+extern int32_t FlashPlanUpdate(uint32_t ui32Address, uint32_t *pui32Image,
+                               uint32_t ui32Count, tFlashPlanStats *psStats);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_FLASHPLAN_H__
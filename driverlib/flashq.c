@@ -0,0 +1,454 @@
+//*****************************************************************************
+//
+// flashq.c - Interrupt-driven flash programming queue.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup flashq_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_flash.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/flash.h"
+#include "driverlib/flashq.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The flash controller interrupts used by the queue.  The EEPROM interrupt
+// shares the vector on TM4C123 devices and is left alone.
+//
+//*****************************************************************************
+#define FLASHQ_INT_ERRORS       (FLASH_INT_ACCESS | FLASH_INT_VOLTAGE_ERR |  \
+                                 FLASH_INT_DATA_ERR | FLASH_INT_ERASE_ERR |   \
+                                 FLASH_INT_PROGRAM_ERR)
+#define FLASHQ_INT_ALL          (FLASH_INT_PROGRAM | FLASHQ_INT_ERRORS)
+
+//*****************************************************************************
+//
+// The queue of submitted requests.  The head of the queue is the request
+// currently being processed by the flash controller.
+//
+//*****************************************************************************
+static tFlashQRequest *g_psFlashQHead;
+static tFlashQRequest *g_psFlashQTail;
+
+//*****************************************************************************
+//
+// The number of bytes covered by the flash operation currently in progress,
+// and the erase sector size of this device.
+//
+//*****************************************************************************
+static uint32_t g_ui32FlashQStep;
+static uint32_t g_ui32FlashQSectorSize;
+
+//*****************************************************************************
+//
+// Starts the next sector erase or write buffer program of a request.  This
+// only starts the flash controller; completion is signalled by the flash
+// interrupt.
+//
+//*****************************************************************************
+static void
+_FlashQStep(tFlashQRequest *psRequest)
+{
+    uint32_t ui32Address, ui32Count;
+    uint32_t *pui32Data;
+
+    ui32Address = psRequest->ui32Address + psRequest->ui32Done;
+
+    if(psRequest->ui32Operation == FLASHQ_OP_ERASE)
+    {
+        //
+        // Erase one sector.
+        //
+        g_ui32FlashQStep = g_ui32FlashQSectorSize;
+        HWREG(FLASH_FMA) = ui32Address;
+        HWREG(FLASH_FMC) = FLASH_FMC_WRKEY | FLASH_FMC_ERASE;
+        return;
+    }
+
+    //
+    // Fill the write buffer up to the end of this 32-word row, so that each
+    // interrupt programs as many words as the controller allows.
+    //
+    pui32Data = psRequest->pui32Data + (psRequest->ui32Done / 4);
+    ui32Count = 0x80 - (ui32Address & 0x7c);
+    if(ui32Count > (psRequest->ui32Count - psRequest->ui32Done))
+    {
+        ui32Count = psRequest->ui32Count - psRequest->ui32Done;
+    }
+    g_ui32FlashQStep = ui32Count;
+
+    HWREG(FLASH_FMA) = ui32Address & ~(0x7f);
+    for(; ui32Count; ui32Count -= 4, ui32Address += 4)
+    {
+        HWREG(FLASH_FWBN + (ui32Address & 0x7c)) = *pui32Data++;
+    }
+
+    //
+    // Program the contents of the write buffer into flash.
+    //
+    HWREG(FLASH_FMC2) = FLASH_FMC2_WRKEY | FLASH_FMC2_WRBUF;
+}
+
+//*****************************************************************************
+//
+// Starts processing a request.
+//
+//*****************************************************************************
+static void
+_FlashQStart(tFlashQRequest *psRequest)
+{
+    psRequest->ui32Status = FLASHQ_STATUS_ACTIVE;
+    psRequest->ui32Done = 0;
+    _FlashQStep(psRequest);
+}
+
+//*****************************************************************************
+//
+//! Initializes the flash programming queue.
+//!
+//! This function reads the erase sector size of the device, clears any
+//! stale flash controller interrupts and enables the program-complete and
+//! error interrupts.  It must be called once before the first call to
+//! FlashQSubmit().
+//!
+//! The application must call FlashQIntHandler() from the flash interrupt
+//! handler.  On TM4C123 devices the EEPROM shares that interrupt; the queue
+//! only handles the flash sources and leaves the EEPROM source alone.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+FlashQInit(void)
+{
+    //
+    // Start with an empty queue.
+    //
+    g_psFlashQHead = 0;
+    g_psFlashQTail = 0;
+    g_ui32FlashQSectorSize = SysCtlFlashSectorSizeGet();
+
+    //
+    // Interrupt when an erase or program cycle completes or fails.
+    //
+    FlashIntClear(FLASHQ_INT_ALL);
+    FlashIntEnable(FLASHQ_INT_ALL);
+    IntEnable(INT_FLASH_TM4C123);
+}
+
+//*****************************************************************************
+//
+//! Queues a flash erase or program operation.
+//!
+//! \param psRequest is a pointer to the request to queue.
+//!
+//! This function appends \e psRequest to the queue of pending operations and
+//! returns immediately.  If the flash controller is idle, the operation is
+//! started right away; otherwise it starts from FlashQIntHandler() once
+//! every earlier request has completed.  The work is done one sector or one
+//! 32-word write buffer at a time, each step being started from the flash
+//! interrupt when the previous one completes, so the processor is free
+//! between steps instead of polling the controller.
+//!
+//! After each step the \e ui32Done member of the request is updated and the
+//! progress callback, if any, is called.  When the operation completes, the
+//! \e ui32Status member is set to \b FLASHQ_STATUS_DONE, or to
+//! \b FLASHQ_STATUS_ERROR if the controller reported an access violation or
+//! an erase or program failure, and the completion callback, if any, is
+//! called.  Both callbacks are called from interrupt context.  A failed
+//! request does not stop the requests queued behind it.
+//!
+//! FlashErase() and FlashProgram() must not be called while the queue is
+//! busy, since they share the flash controller and its interrupt status.
+//!
+//! \note Instruction fetches from flash stall while an erase or program
+//! cycle is in progress.  Code that must keep running during an update,
+//! including the flash interrupt handler and the callbacks, should be placed
+//! in SRAM to get the full benefit of background programming.
+//!
+//! This function may be called from thread or interrupt context.
+//!
+//! \return Returns \b true if the request was started immediately or
+//! \b false if it was queued behind other requests.
+//
+//*****************************************************************************
+bool
+FlashQSubmit(tFlashQRequest *psRequest)
+{
+    uint32_t ui32Enabled;
+    bool bStarted;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRequest != 0);
+    ASSERT((psRequest->ui32Operation == FLASHQ_OP_ERASE) ||
+           (psRequest->ui32Operation == FLASHQ_OP_PROGRAM));
+    ASSERT(psRequest->ui32Count != 0);
+    ASSERT((psRequest->ui32Operation != FLASHQ_OP_ERASE) ||
+           (((psRequest->ui32Address % g_ui32FlashQSectorSize) == 0) &&
+            ((psRequest->ui32Count % g_ui32FlashQSectorSize) == 0)));
+    ASSERT((psRequest->ui32Operation != FLASHQ_OP_PROGRAM) ||
+           ((psRequest->pui32Data != 0) &&
+            ((psRequest->ui32Address & 3) == 0) &&
+            ((psRequest->ui32Count & 3) == 0)));
+
+    psRequest->psNext = 0;
+    psRequest->ui32Done = 0;
+    psRequest->ui32Status = FLASHQ_STATUS_PENDING;
+
+    //
+    // Keep the flash interrupt from touching the queue while it is updated.
+    //
+    ui32Enabled = IntIsEnabled(INT_FLASH_TM4C123);
+    IntDisable(INT_FLASH_TM4C123);
+
+    //
+    // Append the request to the queue.
+    //
+    if(g_psFlashQTail)
+    {
+        g_psFlashQTail->psNext = psRequest;
+    }
+    else
+    {
+        g_psFlashQHead = psRequest;
+    }
+    g_psFlashQTail = psRequest;
+
+    //
+    // Start the request now if the controller was idle.
+    //
+    bStarted = (g_psFlashQHead == psRequest) ? true : false;
+    if(bStarted)
+    {
+        _FlashQStart(psRequest);
+    }
+
+    //
+    // Restore the flash interrupt.
+    //
+    if(ui32Enabled)
+    {
+        IntEnable(INT_FLASH_TM4C123);
+    }
+
+    return(bStarted);
+}
+
+//*****************************************************************************
+//
+//! Removes a pending request from the queue.
+//!
+//! \param psRequest is a pointer to the request to remove.
+//!
+//! This function removes a request that has been queued with FlashQSubmit()
+//! but not yet started.  A request that is already being processed cannot be
+//! cancelled.  The callbacks of a cancelled request are not called and its
+//! status is set back to \b FLASHQ_STATUS_IDLE.
+//!
+//! \return Returns \b true if the request was removed or \b false if it was
+//! not found in the pending part of the queue.
+//
+//*****************************************************************************
+bool
+FlashQCancel(tFlashQRequest *psRequest)
+{
+    tFlashQRequest *psPrev;
+    uint32_t ui32Enabled;
+    bool bFound;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRequest != 0);
+
+    ui32Enabled = IntIsEnabled(INT_FLASH_TM4C123);
+    IntDisable(INT_FLASH_TM4C123);
+
+    //
+    // Search the queue after the active request.
+    //
+    bFound = false;
+    for(psPrev = g_psFlashQHead; psPrev && psPrev->psNext;
+        psPrev = psPrev->psNext)
+    {
+        if(psPrev->psNext == psRequest)
+        {
+            //
+            // Unlink the request.
+            //
+            psPrev->psNext = psRequest->psNext;
+            if(g_psFlashQTail == psRequest)
+            {
+                g_psFlashQTail = psPrev;
+            }
+            psRequest->psNext = 0;
+            psRequest->ui32Status = FLASHQ_STATUS_IDLE;
+            bFound = true;
+            break;
+        }
+    }
+
+    if(ui32Enabled)
+    {
+        IntEnable(INT_FLASH_TM4C123);
+    }
+
+    return(bFound);
+}
+
+//*****************************************************************************
+//
+//! Determines whether the flash programming queue has work outstanding.
+//!
+//! \return Returns \b true if a request is being processed or is queued, and
+//! \b false if the queue is idle.
+//
+//*****************************************************************************
+bool
+FlashQBusy(void)
+{
+    return((g_psFlashQHead != 0) ? true : false);
+}
+
+//*****************************************************************************
+//
+//! Handles the flash interrupt for the flash programming queue.
+//!
+//! This function must be called from the flash interrupt handler.  It
+//! records the completion of the current erase or program step, starts the
+//! next step of the active request, completes the request when all of it has
+//! been processed, and starts the next queued request.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+FlashQIntHandler(void)
+{
+    tFlashQRequest *psRequest;
+    uint32_t ui32Status;
+
+    //
+    // Only the flash sources are of interest.
+    //
+    ui32Status = FlashIntStatus(true) & FLASHQ_INT_ALL;
+    if(ui32Status == 0)
+    {
+        return;
+    }
+    FlashIntClear(ui32Status);
+
+    psRequest = g_psFlashQHead;
+    if(psRequest == 0)
+    {
+        return;
+    }
+
+    if(ui32Status & FLASHQ_INT_ERRORS)
+    {
+        //
+        // The controller rejected or failed this step, so give up on the
+        // rest of the request.
+        //
+        psRequest->ui32Status = FLASHQ_STATUS_ERROR;
+    }
+    else
+    {
+        //
+        // Account for the step that just completed.
+        //
+        psRequest->ui32Done += g_ui32FlashQStep;
+        if(psRequest->pfnProgress)
+        {
+            psRequest->pfnProgress(psRequest);
+        }
+
+        //
+        // If there is more to do in this request, start the next step.
+        //
+        if(psRequest->ui32Done < psRequest->ui32Count)
+        {
+            _FlashQStep(psRequest);
+            return;
+        }
+        psRequest->ui32Status = FLASHQ_STATUS_DONE;
+    }
+
+    //
+    // The request is finished.  Take it off the queue.
+    //
+    g_psFlashQHead = psRequest->psNext;
+    if(g_psFlashQHead == 0)
+    {
+        g_psFlashQTail = 0;
+    }
+    psRequest->psNext = 0;
+
+    //
+    // Start the next request before notifying the owner of this one, so the
+    // controller is kept busy while the callback runs.
+    //
+    if(g_psFlashQHead)
+    {
+        _FlashQStart(g_psFlashQHead);
+    }
+
+    if(psRequest->pfnCallback)
+    {
+        psRequest->pfnCallback(psRequest);
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,161 @@
+//*****************************************************************************
+//
+// flashq.h - Prototypes for the interrupt-driven flash programming queue.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_FLASHQ_H__
+#define __DRIVERLIB_FLASHQ_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that can be passed in the ui32Operation member of tFlashQRequest.
+//
+//*****************************************************************************
+#define FLASHQ_OP_ERASE         0x00000000
+#define FLASHQ_OP_PROGRAM       0x00000001
+
+//*****************************************************************************
+//
+// Values returned in the ui32Status member of tFlashQRequest.
+//
+//*****************************************************************************
+#define FLASHQ_STATUS_IDLE      0x00000000
+#define FLASHQ_STATUS_PENDING   0x00000001
+#define FLASHQ_STATUS_ACTIVE    0x00000002
+#define FLASHQ_STATUS_DONE      0x00000003
+#define FLASHQ_STATUS_ERROR     0x00000004
+
+//*****************************************************************************
+//
+//! This structure describes one erase or program operation queued with
+//! FlashQSubmit().  The structure is owned by the driver from the time it is
+//! submitted until its callback has been called, and must not be modified or
+//! go out of scope in the meantime.
+//
+//*****************************************************************************
+typedef struct tFlashQRequest
+{
+    //
+    //! The operation to perform; \b FLASHQ_OP_ERASE or \b FLASHQ_OP_PROGRAM.
+    //
+    uint32_t ui32Operation;
+
+    //
+    //! The starting flash address.  It must be sector aligned for an erase
+    //! and word aligned for a program.
+    //
+    uint32_t ui32Address;
+
+    //
+    //! The data to program.  Unused for an erase.
+    //
+    uint32_t *pui32Data;
+
+    //
+    //! The number of bytes to erase or program.  It must be a multiple of
+    //! the sector size for an erase and a multiple of four for a program.
+    //
+    uint32_t ui32Count;
+
+    //
+    //! The function called from FlashQIntHandler() each time a sector has
+    //! been erased or a write buffer has been programmed, or 0 if progress
+    //! is not required.
+    //
+    void (*pfnProgress)(struct tFlashQRequest *psRequest);
+
+    //
+    //! The function called from FlashQIntHandler() when the operation
+    //! completes or fails, or 0 if no notification is required.
+    //
+    void (*pfnCallback)(struct tFlashQRequest *psRequest);
+
+    //
+    //! Application data for use by the callbacks.
+    //
+    void *pvCBData;
+
+    //
+    //! The number of bytes erased or programmed so far.
+    //
+    volatile uint32_t ui32Done;
+
+    //
+    //! The current state of the request; one of the \b FLASHQ_STATUS_*
+    //! values.
+    //
+    volatile uint32_t ui32Status;
+
+    //
+    //! Used internally to link queued requests.
+    //
+    struct tFlashQRequest *psNext;
+}
+tFlashQRequest;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void FlashQInit(void);
+extern bool FlashQSubmit(tFlashQRequest *psRequest);
+extern bool FlashQCancel(tFlashQRequest *psRequest);
+extern bool FlashQBusy(void);
+extern void FlashQIntHandler(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_FLASHQ_H__
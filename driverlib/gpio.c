@@ -49,9 +49,12 @@
 #include "inc/hw_gpio.h"
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_nvic.h"
 #include "inc/hw_sysctl.h"
 #include "inc/hw_types.h"
+#include "driverlib/cpu.h"
 #include "driverlib/debug.h"
+#include "driverlib/delay.h"
 #include "driverlib/gpio.h"
 #include "driverlib/interrupt.h"
 
@@ -152,6 +155,25 @@ static const uint32_t g_pui32GPIOBaseAddrs[] =
     GPIO_PORTT_BASE, GPIO_PORTT_BASE,
 };
 
+//*****************************************************************************
+//
+// The pin handlers registered with GPIOIntDemuxRegister(), indexed by port
+// index and pin number, and the base address through which each port was
+// registered.
+//
+//*****************************************************************************
+static tGPIOIntDemuxPin *g_ppsGPIOIntDemuxPins[GPIO_CONFIG_PORTS][8];
+static uint32_t g_pui32GPIOIntDemuxBase[GPIO_CONFIG_PORTS];
+
+//*****************************************************************************
+//
+// Maps an interrupt number to one more than the index of the GPIO port that
+// raises it, or to 0 for interrupts not handled by GPIOIntDemuxHandler().
+// The table is sized for the device class with the most interrupts.
+//
+//*****************************************************************************
+static uint8_t g_pui8GPIOIntDemuxPort[NUM_INTERRUPTS_TM4C123];
+
 //*****************************************************************************
 //
 //! \internal
@@ -752,6 +774,7 @@ GPIOPadConfigGet(uint32_t ui32Port, uint8_t ui8Pin,
 //! - \b GPIO_INT_PIN_6 - interrupt due to activity on Pin 6.
 //! - \b GPIO_INT_PIN_7 - interrupt due to activity on Pin 7.
 //! - \b GPIO_INT_DMA - interrupt due to DMA activity on this GPIO module.
+//!   This source is only available on TM4C129 devices.
 //!
 //! \note If this call is being used to enable summary interrupts on GPIO port
 //! P or Q (GPIOIntTypeSet() with GPIO_DISCRETE_INT not enabled), then all
@@ -772,6 +795,7 @@ GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags)
     // Check the arguments.
     //
     ASSERT(_GPIOBaseValid(ui32Port));
+    ASSERT(!(ui32IntFlags & GPIO_INT_DMA) || CLASS_IS_TM4C129);
 
     //
     // Enable the interrupts.
@@ -1080,6 +1104,227 @@ GPIOIntUnregisterPin(uint32_t ui32Port, uint32_t ui32Pin)
     IntUnregister(ui32Int + ui32Pin);
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! Gets the index of a GPIO port.
+//!
+//! \param ui32Port is the base address of the GPIO port.
+//!
+//! This function returns the port index, as used by the \b GPIO_CONFIG_PORT_*
+//! values, of either aperture of a GPIO port.
+//!
+//! \return Returns the index of the port.
+//
+//*****************************************************************************
+static uint32_t
+_GPIOPortIndexGet(uint32_t ui32Port)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < (GPIO_CONFIG_PORTS * 2) - 1; ui32Idx++)
+    {
+        if(g_pui32GPIOBaseAddrs[ui32Idx] == ui32Port)
+        {
+            break;
+        }
+    }
+
+    return(ui32Idx >> 1);
+}
+
+//*****************************************************************************
+//
+//! Registers a handler for one pin with the GPIO interrupt demultiplexer.
+//!
+//! \param psPin is a pointer to the pin handler structure.
+//! \param ui32Port is the base address of the GPIO port.
+//! \param ui8Pin is the bit-packed representation of the pin.
+//!
+//! This function arranges for the \e pfnHandler member of \e psPin to be
+//! called by GPIOIntDemuxHandler() when the selected pin interrupts.  The
+//! handler, its data and the debounce interval must be set in \e psPin
+//! before calling this function; the port, pin and counters are filled in
+//! here.  The pin interrupt is cleared and enabled, and
+//! GPIOIntDemuxHandler() is registered and enabled for the port's interrupt
+//! (or, on ports with one interrupt per pin, the pin's interrupt).  The
+//! interrupt type must be set beforehand with GPIOIntTypeSet().
+//!
+//! Handlers are looked up in a table indexed by port and pin, so the cost of
+//! dispatching does not depend on the number of pins registered.  Interrupts
+//! that arrive within \e ui32Debounce processor clocks of the last one passed
+//! to the handler are counted in \e ui32Bounces and otherwise ignored.  The
+//! timestamps come from DelayCountGet(), which this function starts with
+//! DelayInit().
+//!
+//! \sa IntRegister() for important information about registering interrupt
+//! handlers.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIOIntDemuxRegister(tGPIOIntDemuxPin *psPin, uint32_t ui32Port,
+                     uint8_t ui8Pin)
+{
+    uint32_t ui32Idx, ui32PinNum, ui32Int;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psPin != 0);
+    ASSERT(psPin->pfnHandler != 0);
+    ASSERT(_GPIOBaseValid(ui32Port));
+    ASSERT((ui8Pin != 0) && ((ui8Pin & (ui8Pin - 1)) == 0));
+
+    ui32Idx = _GPIOPortIndexGet(ui32Port);
+    ui32PinNum = 31 - CPUclz(ui8Pin);
+
+    //
+    // Start the cycle counter used for the debounce timestamps.
+    //
+    DelayInit();
+
+    //
+    // Back-date the last accepted interrupt so that the first one is not
+    // mistaken for a bounce.
+    //
+    psPin->ui32Port = ui32Port;
+    psPin->ui8Pin = ui8Pin;
+    psPin->ui32Edges = 0;
+    psPin->ui32Bounces = 0;
+    psPin->ui32Time = DelayCountGet() - psPin->ui32Debounce;
+
+    g_pui32GPIOIntDemuxBase[ui32Idx] = ui32Port;
+    g_ppsGPIOIntDemuxPins[ui32Idx][ui32PinNum] = psPin;
+
+    //
+    // Ports P and Q have an interrupt for each pin.
+    //
+    ui32Int = _GPIOIntNumberGet(ui32Port);
+    if((ui32Idx == GPIO_CONFIG_PORT_P) || (ui32Idx == GPIO_CONFIG_PORT_Q))
+    {
+        ui32Int += ui32PinNum;
+    }
+    g_pui8GPIOIntDemuxPort[ui32Int] = ui32Idx + 1;
+    IntRegister(ui32Int, GPIOIntDemuxHandler);
+
+    GPIOIntClear(ui32Port, ui8Pin);
+    GPIOIntEnable(ui32Port, ui8Pin);
+    IntEnable(ui32Int);
+}
+
+//*****************************************************************************
+//
+//! Removes a pin handler from the GPIO interrupt demultiplexer.
+//!
+//! \param ui32Port is the base address of the GPIO port.
+//! \param ui8Pin is the bit-packed representation of the pin.
+//!
+//! This function disables the pin interrupt and removes its handler.  The
+//! interrupt of the port is disabled in the interrupt controller once no
+//! pins of the port remain registered.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIOIntDemuxUnregister(uint32_t ui32Port, uint8_t ui8Pin)
+{
+    uint32_t ui32Idx, ui32PinNum, ui32Int;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(_GPIOBaseValid(ui32Port));
+    ASSERT((ui8Pin != 0) && ((ui8Pin & (ui8Pin - 1)) == 0));
+
+    ui32Idx = _GPIOPortIndexGet(ui32Port);
+    ui32PinNum = 31 - CPUclz(ui8Pin);
+
+    GPIOIntDisable(ui32Port, ui8Pin);
+    g_ppsGPIOIntDemuxPins[ui32Idx][ui32PinNum] = 0;
+
+    ui32Int = _GPIOIntNumberGet(ui32Port);
+    if((ui32Idx == GPIO_CONFIG_PORT_P) || (ui32Idx == GPIO_CONFIG_PORT_Q))
+    {
+        IntDisable(ui32Int + ui32PinNum);
+        return;
+    }
+
+    for(ui32PinNum = 0; ui32PinNum < 8; ui32PinNum++)
+    {
+        if(g_ppsGPIOIntDemuxPins[ui32Idx][ui32PinNum])
+        {
+            return;
+        }
+    }
+    IntDisable(ui32Int);
+}
+
+//*****************************************************************************
+//
+//! Dispatches GPIO interrupts to the handlers of individual pins.
+//!
+//! This function is registered by GPIOIntDemuxRegister() for each GPIO
+//! interrupt that has pins registered, and may instead be placed directly in
+//! a vector table in flash.  It finds the port from the active interrupt
+//! number, clears the pending pin interrupts and calls the handler of each
+//! one, highest pin first, using a count-leading-zeros scan of the masked
+//! interrupt status.  The uDMA completion interrupt of the port is left for
+//! its owner to handle.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIOIntDemuxHandler(void)
+{
+    uint32_t ui32Port, ui32Base, ui32Status, ui32Pin, ui32Now;
+    tGPIOIntDemuxPin *psPin;
+
+    //
+    // Find the port from the active interrupt.
+    //
+    ui32Port = g_pui8GPIOIntDemuxPort[HWREG(NVIC_INT_CTRL) &
+                                      NVIC_INT_CTRL_VEC_ACT_M];
+    if(ui32Port == 0)
+    {
+        return;
+    }
+    ui32Port--;
+    ui32Base = g_pui32GPIOIntDemuxBase[ui32Port];
+
+    //
+    // Acknowledge the pending pin interrupts and timestamp them together.
+    //
+    ui32Status = HWREG(ui32Base + GPIO_O_MIS) & 0xff;
+    HWREG(ui32Base + GPIO_O_ICR) = ui32Status;
+    ui32Now = DelayCountGet();
+
+    while(ui32Status)
+    {
+        ui32Pin = 31 - CPUclz(ui32Status);
+        ui32Status &= ~(1 << ui32Pin);
+
+        psPin = g_ppsGPIOIntDemuxPins[ui32Port][ui32Pin];
+        if(psPin == 0)
+        {
+            continue;
+        }
+
+        if((ui32Now - psPin->ui32Time) < psPin->ui32Debounce)
+        {
+            psPin->ui32Bounces++;
+            continue;
+        }
+        psPin->ui32Time = ui32Now;
+        psPin->ui32Edges++;
+
+        psPin->pfnHandler(psPin);
+    }
+}
+
 //*****************************************************************************
 //
 //! Reads the values present of the specified pin(s).
@@ -1095,6 +1340,9 @@ GPIOIntUnregisterPin(uint32_t ui32Port, uint32_t ui32Pin)
 //! set identifies the pin to be accessed, and where bit 0 of the byte
 //! represents GPIO port pin 0, bit 1 represents GPIO port pin 1, and so on.
 //!
+//! \note When the port and pins are known at compile time, GPIO_FAST_PIN()
+//! with GPIO_FAST_READ() performs the same access inline.
+//!
 //! \return Returns a bit-packed byte providing the state of the specified
 //! pin, where bit 0 of the byte represents GPIO port pin 0, bit 1 represents
 //! GPIO port pin 1, and so on.  Any bit that is not specified by \e ui8Pins
@@ -1130,6 +1378,9 @@ GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
 //! set identifies the pin to be accessed, and where bit 0 of the byte
 //! represents GPIO port pin 0, bit 1 represents GPIO port pin 1, and so on.
 //!
+//! \note When the port and pins are known at compile time, GPIO_FAST_PIN()
+//! with GPIO_FAST_WRITE() performs the same access inline.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -2453,6 +2704,9 @@ GPIOPinWakeStatus(uint32_t ui32Port)
 //! pins, the signal is assigned to the port with the lowest letter and the
 //! assignment to the higher letter port is ignored.
 //!
+//! \note To configure all of the pins of a board at once, use
+//! GPIO_CONFIG_DEFINE() and GPIOConfigApply() instead.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -2498,6 +2752,132 @@ GPIOPinConfigure(uint32_t ui32PinConfig)
                                      ((ui32PinConfig & 0xf) << ui32Shift));
 }
 
+//*****************************************************************************
+//
+//! \internal
+//! Writes the pins of a GPIO register that are set by a configuration.
+//!
+//! \param ui32Reg is the address of the register.
+//! \param ui32Mask is the mask of the register bits that are set by the
+//! configuration.
+//! \param ui32Full is the mask of all of the bits of the register.
+//! \param ui32Value is the value of the bits that are set.
+//!
+//! The register is written with a single store when the configuration sets
+//! all of its bits, and with a read-modify-write otherwise.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+_GPIOConfigRegWrite(uint32_t ui32Reg, uint32_t ui32Mask, uint32_t ui32Full,
+                    uint32_t ui32Value)
+{
+    if(ui32Mask == ui32Full)
+    {
+        HWREG(ui32Reg) = ui32Value;
+    }
+    else
+    {
+        HWREG(ui32Reg) = (HWREG(ui32Reg) & ~ui32Mask) | ui32Value;
+    }
+}
+
+//*****************************************************************************
+//
+//! Applies a pre-packed GPIO pin configuration.
+//!
+//! \param psConfig is a pointer to the configuration, as defined with
+//! GPIO_CONFIG_DEFINE().
+//!
+//! This function sets the pin muxing, direction, digital and analog enables,
+//! and pull-up, pull-down and open-drain selections of every pin in a GPIO
+//! configuration table.  The register values of each port are packed at
+//! compile time, so a port that has all of its pins in the table is
+//! configured with one store per register, and a port that has only some of
+//! them in the table with one read-modify-write per register.  Pins that are
+//! not in the table are left alone, as are the drive strengths.
+//!
+//! As for GPIOPinConfigure(), the AHB or APB aperture of each port is
+//! selected according to SysCtlGPIOAHBEnable(), and the GPIO ports must be
+//! enabled with SysCtlPeripheralEnable() before this function is called.
+//!
+//! \note Writes to pins that are locked against reconfiguration, such as the
+//! JTAG/SWD pins, are ignored by the hardware unless the pins have been
+//! unlocked through the GPIO_O_LOCK and GPIO_O_CR registers.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIOConfigApply(const tGPIOConfig *psConfig)
+{
+    uint32_t ui32Port, ui32Base, ui32Pins, ui32PCTLMask, ui32Pin;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig != 0);
+
+    for(ui32Port = 0; ui32Port < GPIO_CONFIG_PORTS; ui32Port++)
+    {
+        //
+        // Skip the ports that the configuration does not touch.
+        //
+        ui32Pins = psConfig->pui8Pins[ui32Port];
+        if(ui32Pins == 0)
+        {
+            continue;
+        }
+
+        //
+        // Get the base address of the GPIO module, selecting either the APB
+        // or the AHB aperture as appropriate.
+        //
+        if(HWREG(SYSCTL_GPIOHBCTL) & (1 << ui32Port))
+        {
+            ui32Base = g_pui32GPIOBaseAddrs[(ui32Port << 1) + 1];
+        }
+        else
+        {
+            ui32Base = g_pui32GPIOBaseAddrs[ui32Port << 1];
+        }
+
+        //
+        // Build the mask of the port control fields of the pins.
+        //
+        ui32PCTLMask = 0;
+        for(ui32Pin = 0; ui32Pin < 8; ui32Pin++)
+        {
+            if(ui32Pins & (1 << ui32Pin))
+            {
+                ui32PCTLMask |= 0xf << (ui32Pin * 4);
+            }
+        }
+
+        //
+        // Select the pin functions before routing the pins to them, and
+        // enable the digital functions last.
+        //
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_PCTL, ui32PCTLMask, 0xffffffff,
+                            psConfig->pui32PCTL[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_DIR, ui32Pins, 0xff,
+                            psConfig->pui8DIR[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_AFSEL, ui32Pins, 0xff,
+                            psConfig->pui8AFSEL[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_ODR, ui32Pins, 0xff,
+                            psConfig->pui8ODR[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_PUR, ui32Pins, 0xff,
+                            psConfig->pui8PUR[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_PDR, ui32Pins, 0xff,
+                            psConfig->pui8PDR[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_AMSEL, ui32Pins, 0xff,
+                            psConfig->pui8AMSEL[ui32Port]);
+        _GPIOConfigRegWrite(ui32Base + GPIO_O_DEN, ui32Pins, 0xff,
+                            psConfig->pui8DEN[ui32Port]);
+    }
+}
+
 //*****************************************************************************
 //
 //! Enables a GPIO pin as a trigger to start a DMA transaction.
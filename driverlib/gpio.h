@@ -133,6 +133,405 @@ extern "C"
 #define GPIO_INT_PIN_7          0x00000080
 #define GPIO_INT_DMA            0x00000100
 
+//*****************************************************************************
+//
+// Macros that bind a GPIO port and set of pins into a pin handle at compile
+// time, and access the pins through the handle with a single load or store.
+// These are the inline equivalent of GPIOPinRead() and GPIOPinWrite(), for
+// bit-banged protocols and chip selects where the cost of the function call
+// matters.  No argument checking is performed.
+//
+// GPIO_FAST_PIN() gives the address of the data register of ui32Port with the
+// ui8Pins mask applied, so that only those pins are read or written; several
+// pins of one port can be updated together by including all of them in the
+// mask.  GPIO_FAST_BIT() gives the bit-band alias of pin number ui32Pin (0 to
+// 7, not a GPIO_PIN_? value), which reads as 0 or 1 and takes the value of
+// bit 0 of what is written to it.  When the port and pins are constants the
+// handle is a constant, and each access compiles to a single load or store.
+// For the fastest toggle rate, use the AHB aperture of the port (see
+// SysCtlGPIOAHBEnable()).
+//
+// GPIO_FAST_WRITE() writes ui8Val to the pins of a handle, GPIO_FAST_SET()
+// and GPIO_FAST_CLEAR() drive all of them high or low, and GPIO_FAST_TOGGLE()
+// inverts them.  GPIO_FAST_READ() returns the state of the pins of a
+// GPIO_FAST_PIN() handle in their bit positions, or 0 or 1 for a
+// GPIO_FAST_BIT() handle.
+//
+//*****************************************************************************
+#define GPIO_FAST_PIN(ui32Port, ui8Pins)                                      \
+        ((uint32_t)(ui32Port) + ((uint32_t)(ui8Pins) << 2))
+#define GPIO_FAST_BIT(ui32Port, ui32Pin)                                      \
+        (((uint32_t)(ui32Port) & 0xF0000000) | 0x02000000 |                   \
+         ((((uint32_t)(ui32Port) + 0x3FC) & 0x000FFFFF) << 5) |               \
+         ((uint32_t)(ui32Pin) << 2))
+#define GPIO_FAST_WRITE(ui32Handle, ui8Val)                                   \
+        (HWREG(ui32Handle) = (ui8Val))
+#define GPIO_FAST_READ(ui32Handle)                                            \
+        HWREG(ui32Handle)
+#define GPIO_FAST_SET(ui32Handle)                                             \
+        (HWREG(ui32Handle) = 0xFF)
+#define GPIO_FAST_CLEAR(ui32Handle)                                           \
+        (HWREG(ui32Handle) = 0)
+#define GPIO_FAST_TOGGLE(ui32Handle)                                          \
+        (HWREG(ui32Handle) ^= 0xFF)
+
+//*****************************************************************************
+//
+// Values that can be passed as the mode of an entry in a GPIO configuration
+// table built with GPIO_CONFIG_DEFINE().  One of GPIO_CONFIG_AF,
+// GPIO_CONFIG_IN, GPIO_CONFIG_OUT and GPIO_CONFIG_ANALOG can be ORed with any
+// of the pad options.
+//
+//*****************************************************************************
+#define GPIO_CONFIG_AF          0x00000003  // Peripheral function
+#define GPIO_CONFIG_IN          0x00000002  // GPIO input
+#define GPIO_CONFIG_OUT         0x00000006  // GPIO output
+#define GPIO_CONFIG_ANALOG      0x00000009  // Analog input
+#define GPIO_CONFIG_OD          0x00000010  // Open-drain
+#define GPIO_CONFIG_WPU         0x00000020  // Weak pull-up
+#define GPIO_CONFIG_WPD         0x00000040  // Weak pull-down
+
+//*****************************************************************************
+//
+// The register that each bit of a GPIO configuration mode selects.  These are
+// used internally by GPIO_CONFIG_DEFINE().
+//
+//*****************************************************************************
+#define GPIO_CONFIG_R_AFSEL     0x00000001
+#define GPIO_CONFIG_R_DEN       0x00000002
+#define GPIO_CONFIG_R_DIR       0x00000004
+#define GPIO_CONFIG_R_AMSEL     0x00000008
+#define GPIO_CONFIG_R_ODR       0x00000010
+#define GPIO_CONFIG_R_PUR       0x00000020
+#define GPIO_CONFIG_R_PDR       0x00000040
+#define GPIO_CONFIG_R_ALL       0x0000007F
+
+//*****************************************************************************
+//
+// The index of each GPIO port in a pin configuration value, as used by the
+// GPIO_P??_??? values in pin_map.h.
+//
+//*****************************************************************************
+#define GPIO_CONFIG_PORT_A      0
+#define GPIO_CONFIG_PORT_B      1
+#define GPIO_CONFIG_PORT_C      2
+#define GPIO_CONFIG_PORT_D      3
+#define GPIO_CONFIG_PORT_E      4
+#define GPIO_CONFIG_PORT_F      5
+#define GPIO_CONFIG_PORT_G      6
+#define GPIO_CONFIG_PORT_H      7
+#define GPIO_CONFIG_PORT_J      8
+#define GPIO_CONFIG_PORT_K      9
+#define GPIO_CONFIG_PORT_L      10
+#define GPIO_CONFIG_PORT_M      11
+#define GPIO_CONFIG_PORT_N      12
+#define GPIO_CONFIG_PORT_P      13
+#define GPIO_CONFIG_PORT_Q      14
+#define GPIO_CONFIG_PORT_R      15
+#define GPIO_CONFIG_PORT_S      16
+#define GPIO_CONFIG_PORT_T      17
+#define GPIO_CONFIG_PORTS       18
+
+//*****************************************************************************
+//
+// Builds the pin configuration value of a pin that is used as a GPIO or an
+// analog input, which has no GPIO_P??_??? value in pin_map.h.  For example,
+// GPIO_CONFIG_PIN(F, 3) is pin PF3.
+//
+//*****************************************************************************
+#define GPIO_CONFIG_PIN(port, ui32Pin)                                        \
+        ((GPIO_CONFIG_PORT_##port << 16) | ((ui32Pin) << 10))
+
+//*****************************************************************************
+//
+//! A pre-packed image of the pin muxing and pad registers of the GPIO ports,
+//! built at compile time from a GPIO configuration table by
+//! GPIO_CONFIG_DEFINE() and applied by GPIOConfigApply().  Each array is
+//! indexed by the port index used in pin configuration values.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The port control register values.
+    //
+    uint32_t pui32PCTL[GPIO_CONFIG_PORTS];
+
+    //
+    //! The pins of each port that are set by the table.
+    //
+    uint8_t pui8Pins[GPIO_CONFIG_PORTS];
+
+    //
+    //! The alternate function select register values.
+    //
+    uint8_t pui8AFSEL[GPIO_CONFIG_PORTS];
+
+    //
+    //! The digital enable register values.
+    //
+    uint8_t pui8DEN[GPIO_CONFIG_PORTS];
+
+    //
+    //! The direction register values.
+    //
+    uint8_t pui8DIR[GPIO_CONFIG_PORTS];
+
+    //
+    //! The analog mode select register values.
+    //
+    uint8_t pui8AMSEL[GPIO_CONFIG_PORTS];
+
+    //
+    //! The open drain select register values.
+    //
+    uint8_t pui8ODR[GPIO_CONFIG_PORTS];
+
+    //
+    //! The pull-up select register values.
+    //
+    uint8_t pui8PUR[GPIO_CONFIG_PORTS];
+
+    //
+    //! The pull-down select register values.
+    //
+    uint8_t pui8PDR[GPIO_CONFIG_PORTS];
+}
+tGPIOConfig;
+
+//*****************************************************************************
+//
+// Helper macros used by GPIO_CONFIG_DEFINE().  The fields of a pin
+// configuration value are the port index in bits 16-23, four times the pin
+// number in bits 8-15 and the port control function in bits 0-3.
+//
+//*****************************************************************************
+#define _GPIO_CONFIG_PORT(ui32PinConfig)                                      \
+        (((ui32PinConfig) >> 16) & 0xff)
+#define _GPIO_CONFIG_SHIFT(ui32PinConfig)                                     \
+        (((ui32PinConfig) >> 8) & 0xff)
+#define _GPIO_CONFIG_BIT(ui32PinConfig)                                       \
+        ((uint32_t)1 << (_GPIO_CONFIG_SHIFT(ui32PinConfig) / 4))
+
+//*****************************************************************************
+//
+// Helper macros that are applied to every entry of a GPIO configuration table
+// and produce a term of a constant expression.  The argument of the register
+// terms is the port index times 256 plus the GPIO_CONFIG_R_* bit of the
+// register.
+//
+//*****************************************************************************
+#define _GPIO_CONFIG_PCTL(ui32Port, ui32PinConfig, ui32Mode)                  \
+        | ((_GPIO_CONFIG_PORT(ui32PinConfig) == (ui32Port)) ?                 \
+           (((uint32_t)(ui32PinConfig) & 0xf) <<                              \
+            _GPIO_CONFIG_SHIFT(ui32PinConfig)) : 0)
+#define _GPIO_CONFIG_REG(ui32Arg, ui32PinConfig, ui32Mode)                    \
+        | (((_GPIO_CONFIG_PORT(ui32PinConfig) == ((ui32Arg) >> 8)) &&         \
+            ((ui32Mode) & (ui32Arg) & 0xff)) ?                                \
+           _GPIO_CONFIG_BIT(ui32PinConfig) : 0)
+#define _GPIO_CONFIG_SUM(ui32Port, ui32PinConfig, ui32Mode)                   \
+        + ((_GPIO_CONFIG_PORT(ui32PinConfig) == (ui32Port)) ?                 \
+           _GPIO_CONFIG_BIT(ui32PinConfig) : 0)
+#define _GPIO_CONFIG_BADPIN(ui32Arg, ui32PinConfig, ui32Mode)                 \
+        | (_GPIO_CONFIG_PORT(ui32PinConfig) >= GPIO_CONFIG_PORTS) |           \
+        ((_GPIO_CONFIG_SHIFT(ui32PinConfig) & 0xe3) != 0)
+#define _GPIO_CONFIG_BADMODE(ui32Arg, ui32PinConfig, ui32Mode)                \
+        | ((ui32Mode) & ~GPIO_CONFIG_R_ALL) |                                 \
+        ((((ui32Mode) & 0xf) != GPIO_CONFIG_AF) &&                            \
+         (((ui32Mode) & 0xf) != GPIO_CONFIG_IN) &&                            \
+         (((ui32Mode) & 0xf) != GPIO_CONFIG_OUT) &&                           \
+         (((ui32Mode) & 0xf) != GPIO_CONFIG_ANALOG)) |                        \
+        (((ui32Mode) & GPIO_CONFIG_WPU) && ((ui32Mode) & GPIO_CONFIG_WPD))
+#define _GPIO_CONFIG_NOFUNC(ui32Arg, ui32PinConfig, ui32Mode)                 \
+        | ((((ui32Mode) & 0xf) == GPIO_CONFIG_AF) &&                          \
+           (((ui32PinConfig) & 0xf) == 0))
+
+//*****************************************************************************
+//
+// Helper macros that evaluate one port of the image.
+//
+//*****************************************************************************
+#define _GPIO_CONFIG_PCTL_PORT(pfnTable, ui32Port)                            \
+        (0 pfnTable(_GPIO_CONFIG_PCTL, ui32Port))
+#define _GPIO_CONFIG_REG_PORT(pfnTable, ui32Port, ui32Reg)                    \
+        (0 pfnTable(_GPIO_CONFIG_REG, ((ui32Port) << 8) | (ui32Reg)))
+#define _GPIO_CONFIG_DUP_PORT(pfnTable, ui32Port)                             \
+        ((0 pfnTable(_GPIO_CONFIG_SUM, ui32Port)) !=                          \
+         _GPIO_CONFIG_REG_PORT(pfnTable, ui32Port, GPIO_CONFIG_R_ALL))
+
+#define _GPIO_CONFIG_PCTL_IMAGE(pfnTable)                                     \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 0),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 1),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 2),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 3),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 4),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 5),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 6),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 7),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 8),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 9),                                  \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 10),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 11),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 12),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 13),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 14),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 15),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 16),                                 \
+        _GPIO_CONFIG_PCTL_PORT(pfnTable, 17)
+#define _GPIO_CONFIG_REG_IMAGE(pfnTable, ui32Reg)                             \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 0, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 1, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 2, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 3, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 4, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 5, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 6, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 7, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 8, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 9, ui32Reg),                          \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 10, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 11, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 12, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 13, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 14, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 15, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 16, ui32Reg),                         \
+        _GPIO_CONFIG_REG_PORT(pfnTable, 17, ui32Reg)
+#define _GPIO_CONFIG_DUPS(pfnTable)                                           \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 0) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 1) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 2) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 3) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 4) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 5) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 6) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 7) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 8) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 9) ||                                 \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 10) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 11) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 12) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 13) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 14) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 15) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 16) ||                                \
+        _GPIO_CONFIG_DUP_PORT(pfnTable, 17)
+
+//*****************************************************************************
+//
+//! Defines a pre-packed GPIO pin configuration.
+//!
+//! \param sName is the name of the tGPIOConfig variable to define.
+//! \param pfnTable is the name of the GPIO configuration table macro.
+//!
+//! The table is a function-like macro that takes an entry macro and an
+//! argument, and applies the entry macro to the argument, a pin configuration
+//! value and a mode, once per pin.  A table with several entries lists them
+//! one after another, continuing the macro over several lines.  The pin
+//! configuration value is one of the \b GPIO_P??_??? values from
+//! <tt>pin_map.h</tt> for a peripheral function, or \b GPIO_CONFIG_PIN() for
+//! a GPIO or analog pin.  The mode is one of \b GPIO_CONFIG_AF,
+//! \b GPIO_CONFIG_IN, \b GPIO_CONFIG_OUT and \b GPIO_CONFIG_ANALOG, ORed with
+//! any of \b GPIO_CONFIG_OD, \b GPIO_CONFIG_WPU and \b GPIO_CONFIG_WPD.
+//!
+//! The register images of every port are packed at compile time.  Since the
+//! \b GPIO_P??_??? values only exist for the part selected with
+//! \b PART_<partno>, a function that the part does not have on the given pin
+//! fails to build.  The build also fails if a pin is listed twice, a mode is
+//! not valid, or a peripheral function mode is given a pin without a
+//! function.
+//!
+//! \note The parameters of the table macro must not be named after a port
+//! letter, since \b GPIO_CONFIG_PIN() pastes the letter it is given.
+//!
+//! \b Example: Define and apply a board configuration.
+//!
+//! \verbatim
+//! #define BOARD_PINS(ENTRY, ARG) ENTRY(ARG, GPIO_PA0_U0RX, GPIO_CONFIG_AF)
+//!
+//! GPIO_CONFIG_DEFINE(g_sBoardPins, BOARD_PINS);
+//!
+//! GPIOConfigApply(&g_sBoardPins);
+//! \endverbatim
+//
+//*****************************************************************************
+#define GPIO_CONFIG_DEFINE(sName, pfnTable)                                   \
+        typedef char sName##_InvalidPin[                                      \
+            (0 pfnTable(_GPIO_CONFIG_BADPIN, 0)) ? -1 : 1];                   \
+        typedef char sName##_InvalidMode[                                     \
+            (0 pfnTable(_GPIO_CONFIG_BADMODE, 0)) ? -1 : 1];                  \
+        typedef char sName##_NoPinFunction[                                   \
+            (0 pfnTable(_GPIO_CONFIG_NOFUNC, 0)) ? -1 : 1];                   \
+        typedef char sName##_DuplicatePin[                                    \
+            (_GPIO_CONFIG_DUPS(pfnTable)) ? -1 : 1];                          \
+        const tGPIOConfig sName =                                             \
+        {                                                                     \
+            { _GPIO_CONFIG_PCTL_IMAGE(pfnTable) },                            \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_ALL) },          \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_AFSEL) },        \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_DEN) },          \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_DIR) },          \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_AMSEL) },        \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_ODR) },          \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_PUR) },          \
+            { _GPIO_CONFIG_REG_IMAGE(pfnTable, GPIO_CONFIG_R_PDR) }           \
+        }
+
+//*****************************************************************************
+//
+//! This structure describes a pin handler registered with
+//! GPIOIntDemuxRegister().  The structure is owned by the driver from the
+//! time it is registered until it is unregistered, and must not go out of
+//! scope in the meantime.
+//
+//*****************************************************************************
+typedef struct tGPIOIntDemuxPin
+{
+    //
+    //! The function called from GPIOIntDemuxHandler() for each accepted
+    //! interrupt on the pin.
+    //
+    void (*pfnHandler)(struct tGPIOIntDemuxPin *psPin);
+
+    //
+    //! Application data for use by the handler.
+    //
+    void *pvCBData;
+
+    //
+    //! The minimum time, in processor clocks, between two interrupts on the
+    //! pin for the second to be passed to the handler, or 0 to pass all of
+    //! them.
+    //
+    uint32_t ui32Debounce;
+
+    //
+    //! The base address of the GPIO port, filled in on registration.
+    //
+    uint32_t ui32Port;
+
+    //
+    //! The bit-packed representation of the pin, filled in on registration.
+    //
+    uint8_t ui8Pin;
+
+    //
+    //! The processor clock count at the last interrupt passed to the handler.
+    //
+    volatile uint32_t ui32Time;
+
+    //
+    //! The number of interrupts passed to the handler.
+    //
+    volatile uint32_t ui32Edges;
+
+    //
+    //! The number of interrupts rejected by the debounce interval.
+    //
+    volatile uint32_t ui32Bounces;
+}
+tGPIOIntDemuxPin;
+
 //*****************************************************************************
 //
 // Prototypes for the APIs.
@@ -157,6 +556,10 @@ extern void GPIOIntUnregister(uint32_t ui32Port);
 extern void GPIOIntRegisterPin(uint32_t ui32Port, uint32_t ui32Pin,
                                void (*pfnIntHandler)(void));
 extern void GPIOIntUnregisterPin(uint32_t ui32Port, uint32_t ui32Pin);
+extern void GPIOIntDemuxRegister(tGPIOIntDemuxPin *psPin, uint32_t ui32Port,
+                                 uint8_t ui8Pin);
+extern void GPIOIntDemuxUnregister(uint32_t ui32Port, uint8_t ui8Pin);
+extern void GPIOIntDemuxHandler(void);
 extern int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins);
 extern void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val);
 extern void GPIOPinConfigure(uint32_t ui32PinConfig);
@@ -191,6 +594,7 @@ extern void GPIODMATriggerEnable(uint32_t ui32Port, uint8_t ui8Pins);
 extern void GPIODMATriggerDisable(uint32_t ui32Port, uint8_t ui8Pins);
 extern void GPIOADCTriggerEnable(uint32_t ui32Port, uint8_t ui8Pins);
 extern void GPIOADCTriggerDisable(uint32_t ui32Port, uint8_t ui8Pins);
+extern void GPIOConfigApply(const tGPIOConfig *psConfig);
 
 //*****************************************************************************
 //
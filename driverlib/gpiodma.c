@@ -0,0 +1,474 @@
+//*****************************************************************************
+//
+// gpiodma.c - uDMA-driven parallel waveform capture and playback on GPIO.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup gpiodma_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_gpio.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/gpio.h"
+#include "driverlib/gpiodma.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+
+//*****************************************************************************
+//
+// The largest number of samples that can be moved by a single uDMA control
+// structure.
+//
+//*****************************************************************************
+#define GPIODMA_SEGMENT_MAX     1024
+
+//*****************************************************************************
+//
+// Maps a control structure index (0 for primary, 1 for alternate) to the
+// value that selects it in calls to the uDMA driver.
+//
+//*****************************************************************************
+static const uint32_t g_pui32GPIODMASelect[2] =
+{
+    UDMA_PRI_SELECT, UDMA_ALT_SELECT
+};
+
+//*****************************************************************************
+//
+// Loads the next segment of the buffer into one of the control structures of
+// the stream's channel.  The structure is left unused if a one-shot stream
+// has no samples left to queue.
+//
+//*****************************************************************************
+static void
+_GPIODMASegmentLoad(tGPIODMAStream *psStream, uint32_t ui32Index)
+{
+    uint32_t ui32Count;
+    void *pvData, *pvBuffer;
+
+    //
+    // Determine the size of this segment.  A segment never crosses the end
+    // of the buffer.
+    //
+    ui32Count = psStream->ui32Count - psStream->ui32Queued;
+    if(ui32Count > GPIODMA_SEGMENT_MAX)
+    {
+        ui32Count = GPIODMA_SEGMENT_MAX;
+    }
+    psStream->pui16Segment[ui32Index] = ui32Count;
+    if(ui32Count == 0)
+    {
+        return;
+    }
+
+    //
+    // The masked data address touches only the selected pins, so other pins
+    // of the port are unaffected by playback and read as zero on capture.
+    //
+    pvData = (void *)(psStream->ui32Port + GPIO_O_DATA +
+                      (psStream->ui8Pins << 2));
+    pvBuffer = psStream->pui8Buffer + psStream->ui32Queued;
+
+    if(psStream->ui32Flags & GPIODMA_CAPTURE)
+    {
+        uDMAChannelTransferSet(psStream->ui32Channel |
+                               g_pui32GPIODMASelect[ui32Index],
+                               UDMA_MODE_PINGPONG, pvData, pvBuffer,
+                               ui32Count);
+    }
+    else
+    {
+        uDMAChannelTransferSet(psStream->ui32Channel |
+                               g_pui32GPIODMASelect[ui32Index],
+                               UDMA_MODE_PINGPONG, pvBuffer, pvData,
+                               ui32Count);
+    }
+
+    //
+    // Advance through the buffer, going back to the start in continuous
+    // mode.
+    //
+    psStream->ui32Queued += ui32Count;
+    if((psStream->ui32Flags & GPIODMA_CONTINUOUS) &&
+       (psStream->ui32Queued == psStream->ui32Count))
+    {
+        psStream->ui32Queued = 0;
+    }
+}
+
+//*****************************************************************************
+//
+//! Configures a timer to pace a capture or playback stream.
+//!
+//! \param ui32Base is the base address of the timer module.
+//! \param ui32Period is the number of timer clocks between samples.
+//!
+//! This function configures timer A of the given module as a 32-bit periodic
+//! timer that issues one uDMA request every \e ui32Period clocks.  The
+//! stream using it must set its \e ui32Channel member to the timer A uDMA
+//! channel mapping, for example \b UDMA_CH18_TIMER0A.  On parts that
+//! support TimerDMAEventSet(), the timeout is selected as the uDMA trigger
+//! and the uDMA completion interrupt is enabled as well.
+//!
+//! The timer is left disabled.  Call TimerEnable() with \b TIMER_A after
+//! GPIODMAStreamStart() so that no samples are missed at the start of the
+//! stream.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIODMATimerPaceSet(uint32_t ui32Base, uint32_t ui32Period)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Period != 0);
+
+    TimerConfigure(ui32Base, TIMER_CFG_PERIODIC);
+    TimerLoadSet(ui32Base, TIMER_A, ui32Period - 1);
+
+    if(CLASS_IS_TM4C129)
+    {
+        TimerDMAEventSet(ui32Base, TIMER_DMA_TIMEOUT_A);
+        TimerIntEnable(ui32Base, TIMER_TIMA_DMA);
+    }
+}
+
+//*****************************************************************************
+//
+//! Configures a GPIO pin edge to pace a capture or playback stream.
+//!
+//! \param ui32Port is the base address of the GPIO port with the strobe pin.
+//! \param ui8Pin is the bit-packed representation of the strobe pin.
+//! \param ui32Edge is the edge that triggers a sample, and is one of
+//! \b GPIO_FALLING_EDGE, \b GPIO_RISING_EDGE or \b GPIO_BOTH_EDGES.
+//!
+//! This function makes each selected edge on the pin issue a uDMA request on
+//! the port's uDMA channel.  On TM4C129 devices, it also enables the uDMA
+//! completion interrupt of the port with \b GPIO_INT_DMA, which only exists
+//! on those devices; on TM4C123 devices the completion is signaled on the
+//! port's interrupt without it.  The stream using it must set its
+//! \e ui32Channel member to the port's channel mapping, for example
+//! \b UDMA_CH15_GPIOF.  The data port of the stream does not need to be the
+//! same as the strobe port.
+//!
+//! The pin must already be configured as an input with
+//! GPIOPinTypeGPIOInput().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIODMAEdgePaceSet(uint32_t ui32Port, uint8_t ui8Pin, uint32_t ui32Edge)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Edge == GPIO_FALLING_EDGE) ||
+           (ui32Edge == GPIO_RISING_EDGE) ||
+           (ui32Edge == GPIO_BOTH_EDGES));
+
+    GPIOIntTypeSet(ui32Port, ui8Pin, ui32Edge);
+    GPIODMATriggerEnable(ui32Port, ui8Pin);
+    if(CLASS_IS_TM4C129)
+    {
+        GPIOIntEnable(ui32Port, GPIO_INT_DMA);
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts a parallel capture or playback stream.
+//!
+//! \param psStream is a pointer to the stream to start.
+//!
+//! This function programs the uDMA channel given by the \e ui32Channel member
+//! of the stream to move one byte between the buffer and the selected pins of
+//! the GPIO port for each request of the pacing peripheral.  The buffer is
+//! split into segments of up to 1024 samples, which are fed alternately to
+//! the primary and alternate control structures in ping-pong mode so that
+//! streams of any length run without gaps.  The uDMA controller must already
+//! be enabled and have a control table.
+//!
+//! For playback, the pins must be configured as outputs.  For capture, they
+//! must be configured as inputs.
+//!
+//! The pacing peripheral should be enabled after this function returns.  Its
+//! interrupt handler must call GPIODMAIntHandler() after clearing its own
+//! interrupt sources.  The GPIO uDMA completion interrupt used by edge pacing
+//! is only enabled by GPIODMAEdgePaceSet() on TM4C129 devices, as is the
+//! timer uDMA interrupt by GPIODMATimerPaceSet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIODMAStreamStart(tGPIODMAStream *psStream)
+{
+    uint32_t ui32Control;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStream);
+    ASSERT(psStream->pui8Buffer);
+    ASSERT(psStream->ui32Count != 0);
+    ASSERT(psStream->ui8Pins != 0);
+
+    psStream->ui32Status = GPIODMA_STATUS_ACTIVE;
+    psStream->ui32Queued = 0;
+    psStream->ui32Done = 0;
+    psStream->ui8Next = 0;
+
+    //
+    // Route the pacing peripheral to the channel, and give the channel high
+    // priority so that it keeps up at high sample rates.
+    //
+    uDMAChannelAssign(psStream->ui32Channel);
+    uDMAChannelAttributeDisable(psStream->ui32Channel, UDMA_ATTR_ALL);
+    uDMAChannelAttributeEnable(psStream->ui32Channel,
+                               UDMA_ATTR_HIGH_PRIORITY);
+
+    //
+    // Move one byte per request.
+    //
+    if(psStream->ui32Flags & GPIODMA_CAPTURE)
+    {
+        ui32Control = (UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 |
+                       UDMA_ARB_1);
+    }
+    else
+    {
+        ui32Control = (UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE |
+                       UDMA_ARB_1);
+    }
+    uDMAChannelControlSet(psStream->ui32Channel | UDMA_PRI_SELECT,
+                          ui32Control);
+    uDMAChannelControlSet(psStream->ui32Channel | UDMA_ALT_SELECT,
+                          ui32Control);
+
+    //
+    // Load the first two segments.  If the whole buffer fits in the primary
+    // structure of a one-shot stream, stop the alternate structure so that
+    // the channel finishes after the primary.
+    //
+    _GPIODMASegmentLoad(psStream, 0);
+    _GPIODMASegmentLoad(psStream, 1);
+    if(psStream->pui16Segment[1] == 0)
+    {
+        uDMAChannelTransferSet(psStream->ui32Channel | UDMA_ALT_SELECT,
+                               UDMA_MODE_STOP, psStream->pui8Buffer,
+                               psStream->pui8Buffer, 1);
+    }
+
+    uDMAChannelEnable(psStream->ui32Channel);
+}
+
+//*****************************************************************************
+//
+//! Stops a parallel capture or playback stream.
+//!
+//! \param psStream is a pointer to the stream to stop.
+//!
+//! This function disables the uDMA channel of an active stream and marks it
+//! as stopped.  The number of samples transferred before it stopped can be
+//! read with GPIODMAStreamCountGet().  The callback is not called.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIODMAStreamStop(tGPIODMAStream *psStream)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStream);
+
+    if(psStream->ui32Status != GPIODMA_STATUS_ACTIVE)
+    {
+        return;
+    }
+
+    uDMAChannelDisable(psStream->ui32Channel);
+
+    //
+    // Fold the progress of the segment in flight into the final count.
+    //
+    psStream->ui32Done = GPIODMAStreamCountGet(psStream);
+    psStream->pui16Segment[0] = 0;
+    psStream->pui16Segment[1] = 0;
+    psStream->ui32Status = GPIODMA_STATUS_STOPPED;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of samples transferred by a stream.
+//!
+//! \param psStream is a pointer to the stream.
+//!
+//! This function returns the number of samples moved since the stream was
+//! started, including the progress of the segment in flight.  In continuous
+//! mode the count keeps increasing as the buffer wraps; the most recent
+//! sample is at index (count - 1) modulo \e ui32Count of the buffer.
+//!
+//! \return Returns the number of samples transferred.
+//
+//*****************************************************************************
+uint32_t
+GPIODMAStreamCountGet(tGPIODMAStream *psStream)
+{
+    uint32_t ui32Count, ui32Segment;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStream);
+
+    ui32Count = psStream->ui32Done;
+    if(psStream->ui32Status == GPIODMA_STATUS_ACTIVE)
+    {
+        ui32Segment = psStream->pui16Segment[psStream->ui8Next];
+        if(ui32Segment != 0)
+        {
+            ui32Count += (ui32Segment -
+                          uDMAChannelSizeGet(psStream->ui32Channel |
+                                             g_pui32GPIODMASelect[
+                                                 psStream->ui8Next]));
+        }
+    }
+
+    return(ui32Count);
+}
+
+//*****************************************************************************
+//
+//! Handles the uDMA completion interrupt for a stream.
+//!
+//! \param psStream is a pointer to the stream.
+//!
+//! This function must be called from the interrupt handler of the pacing
+//! peripheral, after it has cleared that peripheral's own interrupt sources.
+//! It refills each control structure that has finished with the next segment
+//! of the buffer, and completes one-shot streams when all of their samples
+//! have been transferred.
+//!
+//! If the handler is delayed for long enough that both control structures
+//! finish, the uDMA channel stops and the stream ends with status
+//! \b GPIODMA_STATUS_OVERRUN.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+GPIODMAIntHandler(tGPIODMAStream *psStream)
+{
+    uint32_t ui32Index;
+    bool bEnd;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStream);
+
+    if(psStream->ui32Status != GPIODMA_STATUS_ACTIVE)
+    {
+        return;
+    }
+
+    //
+    // Retire the finished control structures in the order in which the
+    // controller uses them, refilling each one as it is retired.
+    //
+    bEnd = false;
+    ui32Index = psStream->ui8Next;
+    while((psStream->pui16Segment[ui32Index] != 0) &&
+          (uDMAChannelModeGet(psStream->ui32Channel |
+                              g_pui32GPIODMASelect[ui32Index]) ==
+           UDMA_MODE_STOP))
+    {
+        psStream->ui32Done += psStream->pui16Segment[ui32Index];
+        if((psStream->ui32Done % psStream->ui32Count) == 0)
+        {
+            bEnd = true;
+        }
+
+        _GPIODMASegmentLoad(psStream, ui32Index);
+        ui32Index ^= 1;
+        psStream->ui8Next = ui32Index;
+    }
+
+    if((psStream->pui16Segment[0] == 0) && (psStream->pui16Segment[1] == 0))
+    {
+        //
+        // A one-shot stream has transferred all of its samples.
+        //
+        uDMAChannelDisable(psStream->ui32Channel);
+        psStream->ui32Status = GPIODMA_STATUS_DONE;
+    }
+    else if(!uDMAChannelIsEnabled(psStream->ui32Channel))
+    {
+        //
+        // The controller reached a structure before it was refilled.
+        //
+        psStream->pui16Segment[0] = 0;
+        psStream->pui16Segment[1] = 0;
+        psStream->ui32Status = GPIODMA_STATUS_OVERRUN;
+        bEnd = true;
+    }
+
+    if(bEnd && psStream->pfnCallback)
+    {
+        psStream->pfnCallback(psStream);
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,183 @@
+//*****************************************************************************
+//
+// gpiodma.h - uDMA-driven parallel waveform capture and playback on GPIO.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_GPIODMA_H__
+#define __DRIVERLIB_GPIODMA_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that can be passed in the ui32Flags member of tGPIODMAStream.
+//
+//*****************************************************************************
+#define GPIODMA_PLAYBACK        0x00000000  // Buffer to GPIO port
+#define GPIODMA_CAPTURE         0x00000001  // GPIO port to buffer
+#define GPIODMA_CONTINUOUS      0x00000002  // Wrap to start of buffer at end
+
+//*****************************************************************************
+//
+// Values returned in the ui32Status member of tGPIODMAStream.
+//
+//*****************************************************************************
+#define GPIODMA_STATUS_IDLE     0x00000000
+#define GPIODMA_STATUS_ACTIVE   0x00000001
+#define GPIODMA_STATUS_DONE     0x00000002
+#define GPIODMA_STATUS_STOPPED  0x00000003
+#define GPIODMA_STATUS_OVERRUN  0x00000004
+
+//*****************************************************************************
+//
+//! This structure describes one parallel capture or playback stream started
+//! with GPIODMAStreamStart().  The structure is owned by the driver while the
+//! stream is active and must not be modified or go out of scope until it has
+//! completed or been stopped.
+//
+//*****************************************************************************
+typedef struct tGPIODMAStream
+{
+    //
+    //! The uDMA channel mapping of the peripheral that paces the transfers,
+    //! such as \b UDMA_CH18_TIMER0A for a timer or \b UDMA_CH15_GPIOF for an
+    //! edge on a GPIO port configured with GPIODMAEdgePaceSet().
+    //
+    uint32_t ui32Channel;
+
+    //
+    //! The base address of the GPIO port that is driven or sampled.  Using
+    //! the AHB aperture of the port gives the highest transfer rate.
+    //
+    uint32_t ui32Port;
+
+    //
+    //! The pins of the port that are driven or sampled.  Pins outside of this
+    //! mask are left unchanged on playback and read as zero on capture.
+    //
+    uint8_t ui8Pins;
+
+    //
+    //! The direction of the stream, \b GPIODMA_PLAYBACK or
+    //! \b GPIODMA_CAPTURE, optionally ORed with \b GPIODMA_CONTINUOUS.
+    //
+    uint32_t ui32Flags;
+
+    //
+    //! The sample buffer, holding one byte per pacing event.  It must be in
+    //! SRAM.
+    //
+    uint8_t *pui8Buffer;
+
+    //
+    //! The number of samples in the buffer.
+    //
+    uint32_t ui32Count;
+
+    //
+    //! The function called from GPIODMAIntHandler() when the end of the
+    //! buffer is reached or the stream fails, or 0 if no notification is
+    //! required.  In continuous mode it is called each time the buffer wraps.
+    //
+    void (*pfnCallback)(struct tGPIODMAStream *psStream);
+
+    //
+    //! Application data for use by the callback.
+    //
+    void *pvCBData;
+
+    //
+    //! The current state of the stream; one of the \b GPIODMA_STATUS_*
+    //! values.
+    //
+    volatile uint32_t ui32Status;
+
+    //
+    //! Used internally to track the samples handed to the uDMA controller.
+    //
+    uint32_t ui32Queued;
+
+    //
+    //! Used internally to count the samples that have been transferred.
+    //
+    volatile uint32_t ui32Done;
+
+    //
+    //! Used internally to record the number of samples loaded into the
+    //! primary and alternate control structures.
+    //
+    uint16_t pui16Segment[2];
+
+    //
+    //! Used internally to record which control structure completes next.
+    //
+    uint8_t ui8Next;
+}
+tGPIODMAStream;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void GPIODMATimerPaceSet(uint32_t ui32Base, uint32_t ui32Period);
+extern void GPIODMAEdgePaceSet(uint32_t ui32Port, uint8_t ui8Pin,
+                               uint32_t ui32Edge);
+extern void GPIODMAStreamStart(tGPIODMAStream *psStream);
+extern void GPIODMAStreamStop(tGPIODMAStream *psStream);
+extern uint32_t GPIODMAStreamCountGet(tGPIODMAStream *psStream);
+extern void GPIODMAIntHandler(tGPIODMAStream *psStream);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_GPIODMA_H__
@@ -51,7 +51,9 @@
 #include "inc/hw_ints.h"
 #include "inc/hw_sysctl.h"
 #include "inc/hw_types.h"
+#include "driverlib/atomic.h"
 #include "driverlib/debug.h"
+#include "driverlib/delay.h"
 #include "driverlib/hibernate.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
@@ -86,6 +88,66 @@
 //*****************************************************************************
 #define HIBERNATE_CLOCK_OUTPUT  CLASS_IS_TM4C129
 
+//*****************************************************************************
+//
+// The state of the cached clock maintained by HibernateClockSync().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The number of RTC sub seconds per processor clock, in 0.32 fixed point.
+    //
+    uint32_t ui32Scale;
+
+    //
+    // The processor cycle count at the last synchronization.
+    //
+    uint32_t ui32Cycles;
+
+    //
+    // The RTC sub second count at the last synchronization.
+    //
+    uint32_t ui32SubSeconds;
+
+    //
+    // The RTC counter, or the calendar time register in calendar mode, at the
+    // last synchronization.
+    //
+    uint32_t ui32Seconds;
+
+    //
+    // The second and sub second count last returned, used to keep the clock
+    // from going backwards across a synchronization.
+    //
+    uint32_t ui32LastSeconds;
+    uint32_t ui32LastSubSeconds;
+
+    //
+    // Indicates that the module is in calendar mode.
+    //
+    bool bCalendar;
+
+    //
+    // The calendar time at the last synchronization in calendar mode.
+    //
+    struct tm sTime;
+}
+tHibernateClock;
+
+static tHibernateClock g_sHibernateClock;
+
+//*****************************************************************************
+//
+// The number of 32-bit words of battery-backed memory, the write-behind copy
+// of it used by HibernateDataWrite() and HibernateDataFlush(), and the words
+// of it that have not yet been written to the module.
+//
+//*****************************************************************************
+#define HIBERNATE_DATA_WORDS    16
+static uint32_t g_pui32HibernateData[HIBERNATE_DATA_WORDS];
+static uint32_t g_ui32HibernateDataDirty;
+
 //*****************************************************************************
 //
 //! \internal
@@ -878,13 +940,18 @@ HibernateRTCTrimGet(void)
 //! battery-backed memory.  The data can be restored by calling the
 //! HibernateDataGet() function.
 //!
+//! Words that already hold the value being stored are not written, so only
+//! the words that change incur the write delay of the module.  Any of the
+//! words that were queued by HibernateDataWrite() are taken out of the queue,
+//! so that a later HibernateDataFlush() does not overwrite them.
+//!
 //! \return None.
 //
 //*****************************************************************************
 void
 HibernateDataSet(uint32_t *pui32Data, uint32_t ui32Count)
 {
-    uint32_t ui32Idx;
+    uint32_t ui32Idx, ui32Key;
 
     //
     // Check the arguments.
@@ -892,11 +959,28 @@ HibernateDataSet(uint32_t *pui32Data, uint32_t ui32Count)
     ASSERT(ui32Count <= 64);
     ASSERT(pui32Data != 0);
 
+    //
+    // Drop any queued writes of these words.
+    //
+    ui32Key = AtomicEnter();
+    g_ui32HibernateDataDirty &= ((ui32Count < HIBERNATE_DATA_WORDS) ?
+                                 ~((1 << ui32Count) - 1) : 0);
+    AtomicExit(ui32Key);
+
     //
     // Loop through all the words to be stored, storing one at a time.
     //
     for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
     {
+        //
+        // Skip words that already hold the value, since reads need no delay
+        // but each write must wait for the module.
+        //
+        if(HWREG(HIB_DATA + (ui32Idx * 4)) == pui32Data[ui32Idx])
+        {
+            continue;
+        }
+
         //
         // Write a word to the battery-backed storage area.
         //
@@ -951,6 +1035,90 @@ HibernateDataGet(uint32_t *pui32Data, uint32_t ui32Count)
     }
 }
 
+//*****************************************************************************
+//
+//! Queues a word to be stored in the battery-backed memory of the Hibernation
+//! module.
+//!
+//! \param ui32Index is the index of the 32-bit word to store, from 0 to 15.
+//! \param ui32Value is the value to store.
+//!
+//! This function records the value in a copy of the battery-backed memory
+//! held in SRAM and returns without accessing the module, so it can be used
+//! where the write delay of the module is not acceptable, such as when
+//! updating a sequence number for every log record.  The value is written to
+//! the module by the next call to HibernateDataFlush(); until then,
+//! HibernateDataGet() returns the previous value.  Repeated writes to the
+//! same word before a flush cost a single write to the module.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HibernateDataWrite(uint32_t ui32Index, uint32_t ui32Value)
+{
+    uint32_t ui32Key;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Index < HIBERNATE_DATA_WORDS);
+
+    //
+    // Record the value and mark the word as needing to be written.
+    //
+    ui32Key = AtomicEnter();
+    g_pui32HibernateData[ui32Index] = ui32Value;
+    g_ui32HibernateDataDirty |= 1 << ui32Index;
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Writes queued words to the battery-backed memory of the Hibernation
+//! module.
+//!
+//! This function writes the words queued by HibernateDataWrite() since the
+//! last flush, waiting for the module after each one as HibernateDataSet()
+//! does.  Words whose queued value is already in the module are not written.
+//! It would typically be called from a low priority task, or before
+//! requesting hibernation.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HibernateDataFlush(void)
+{
+    uint32_t ui32Idx, ui32Key, ui32Value;
+
+    for(ui32Idx = 0; ui32Idx < HIBERNATE_DATA_WORDS; ui32Idx++)
+    {
+        if(!(g_ui32HibernateDataDirty & (1 << ui32Idx)))
+        {
+            continue;
+        }
+
+        //
+        // Take the word out of the queue.  A later HibernateDataWrite() of
+        // the same word queues it again.
+        //
+        ui32Key = AtomicEnter();
+        g_ui32HibernateDataDirty &= ~(1 << ui32Idx);
+        ui32Value = g_pui32HibernateData[ui32Idx];
+        AtomicExit(ui32Key);
+
+        //
+        // Write the word if it changed, and wait for write completion.
+        //
+        if(HWREG(HIB_DATA + (ui32Idx * 4)) != ui32Value)
+        {
+            HWREG(HIB_DATA + (ui32Idx * 4)) = ui32Value;
+            _HibernateWriteComplete();
+        }
+    }
+}
+
 //*****************************************************************************
 //
 //! Requests hibernation mode.
@@ -2545,6 +2713,277 @@ HibernateTamperExtOscValid(void)
     return(false);
 }
 
+//*****************************************************************************
+//
+//! \internal
+//!
+//! Synchronizes the cached clock with the RTC.
+//!
+//! This function reads the RTC sub second count before and after the
+//! seconds, retrying if a second boundary was crossed, and records the
+//! processor cycle count alongside.  It must be called with interrupts
+//! disabled.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+_HibernateClockResync(void)
+{
+    uint32_t ui32SubSeconds, ui32Seconds, ui32Cycles, ui32Check;
+    int i32Fail;
+
+    do
+    {
+        ui32SubSeconds = HWREG(HIB_RTCSS) & HIB_RTCSS_RTCSSC_M;
+
+        //
+        // In calendar mode, read the calendar.  The read only fails if the
+        // date changes while it is being read, in which case it is retried
+        // along with the sub seconds.
+        //
+        if(g_sHibernateClock.bCalendar)
+        {
+            i32Fail = HibernateCalendarGet(&g_sHibernateClock.sTime);
+            ui32Seconds = HWREG(HIB_CAL0);
+        }
+        else
+        {
+            i32Fail = 0;
+            ui32Seconds = HWREG(HIB_RTCC);
+        }
+
+        ui32Cycles = DelayCountGet();
+        ui32Check = HWREG(HIB_RTCSS) & HIB_RTCSS_RTCSSC_M;
+    }
+    while(i32Fail || (ui32Check < ui32SubSeconds));
+
+    g_sHibernateClock.ui32Cycles = ui32Cycles;
+    g_sHibernateClock.ui32SubSeconds = ui32Check;
+    g_sHibernateClock.ui32Seconds = ui32Seconds;
+}
+
+//*****************************************************************************
+//
+//! \internal
+//!
+//! Returns the sub second count of the cached clock, synchronizing it with
+//! the RTC if the count has rolled over into the next second.  It must be
+//! called with interrupts disabled.
+//!
+//! \return Returns the sub second count in 1/32768 seconds.
+//
+//*****************************************************************************
+static uint32_t
+_HibernateClockSubSecondsGet(void)
+{
+    uint32_t ui32SubSeconds;
+
+    //
+    // Extrapolate the sub second count from the processor cycles elapsed
+    // since the last synchronization.
+    //
+    ui32SubSeconds = (g_sHibernateClock.ui32SubSeconds +
+                      (uint32_t)(((uint64_t)(DelayCountGet() -
+                                             g_sHibernateClock.ui32Cycles) *
+                                  g_sHibernateClock.ui32Scale) >> 32));
+
+    //
+    // Once the count reaches the next second, read the RTC again so that
+    // the seconds and any difference between the processor clock and the
+    // RTC are picked up.
+    //
+    if(ui32SubSeconds > HIB_RTCSS_RTCSSC_M)
+    {
+        _HibernateClockResync();
+        ui32SubSeconds = g_sHibernateClock.ui32SubSeconds;
+    }
+
+    //
+    // If the processor clock runs faster than the RTC, the count can be
+    // ahead of the RTC when it is synchronized.  Hold it until the RTC
+    // catches up, so that the clock never goes backwards.
+    //
+    if((g_sHibernateClock.ui32Seconds == g_sHibernateClock.ui32LastSeconds) &&
+       (ui32SubSeconds < g_sHibernateClock.ui32LastSubSeconds))
+    {
+        ui32SubSeconds = g_sHibernateClock.ui32LastSubSeconds;
+    }
+    g_sHibernateClock.ui32LastSeconds = g_sHibernateClock.ui32Seconds;
+    g_sHibernateClock.ui32LastSubSeconds = ui32SubSeconds;
+
+    return(ui32SubSeconds);
+}
+
+//*****************************************************************************
+//
+//! Synchronizes the cached clock with the real time clock.
+//!
+//! \param ui32SysClock is the frequency of the processor clock in Hz.
+//!
+//! This function starts a time-of-day clock that reads the Hibernation
+//! module's RTC once and then extrapolates it from the processor's cycle
+//! counter, so that HibernateClockGet() and HibernateClockCalendarGet() can
+//! be used to timestamp events at a cost of a few tens of cycles.  The RTC is
+//! read again only when the extrapolated sub second count rolls over into the
+//! next second, so at most once per second, which also bounds the drift
+//! between the processor clock and the RTC to what accumulates in a second
+//! while the processor is running.
+//!
+//! The cycle counter stops while the processor sleeps, and deep sleep may
+//! run it from a different clock, so the clock falls behind the RTC by the
+//! time spent asleep.  HibernateClockResume() must be called after each
+//! sleep to pick up that time; IdleEnter() does so.
+//!
+//! The RTC must already be running, in counter or calendar mode.  This
+//! function must be called again if the processor clock frequency, the RTC
+//! or the calendar is changed.  The cycle count is read with
+//! DelayCountGet(), and the delay service is started by this function if it
+//! is not already running.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HibernateClockSync(uint32_t ui32SysClock)
+{
+    uint32_t ui32Key;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32SysClock > 32768);
+
+    //
+    // Make sure the cycle counter is running.
+    //
+    DelayInit();
+
+    ui32Key = AtomicEnter();
+
+    g_sHibernateClock.ui32Scale = (uint32_t)(((uint64_t)32768 << 32) /
+                                             ui32SysClock);
+    g_sHibernateClock.bCalendar =
+        (HWREG(HIB_CALCTL) & HIB_CALCTL_CALEN) ? true : false;
+    _HibernateClockResync();
+    g_sHibernateClock.ui32LastSeconds = g_sHibernateClock.ui32Seconds;
+    g_sHibernateClock.ui32LastSubSeconds = g_sHibernateClock.ui32SubSeconds;
+
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Resynchronizes the cached clock with the real time clock after a sleep.
+//!
+//! This function reads the RTC again so that the clock started by
+//! HibernateClockSync() includes the time that the processor spent in sleep
+//! or deep sleep, during which the cycle counter that it extrapolates from
+//! does not run.  It does nothing if HibernateClockSync() has not been
+//! called, so it can be called unconditionally on wake.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HibernateClockResume(void)
+{
+    uint32_t ui32Key;
+
+    ui32Key = AtomicEnter();
+    if(g_sHibernateClock.ui32Scale)
+    {
+        _HibernateClockResync();
+    }
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Gets the value of the cached real time clock.
+//!
+//! \param pui32SubSeconds is a pointer to the location that receives the sub
+//! second count in 1/32768 seconds, or 0 if it is not needed.
+//!
+//! This function returns the time of the clock started by
+//! HibernateClockSync() without accessing the Hibernation module, except
+//! once per second.  The time never goes backwards.  It can be called from
+//! any context, including interrupt handlers; interrupts are disabled for
+//! the few cycles it takes, and for the RTC read when one is needed.
+//!
+//! The extrapolation relies on the 32-bit processor cycle counter, so the
+//! clock must be read at least once per 2^32 processor clocks (about 35
+//! seconds at 120 MHz), or HibernateClockSync() called again after a longer
+//! gap.  The counter does not run while the processor sleeps, so
+//! HibernateClockResume() must be called on wake, as IdleEnter() does;
+//! otherwise the clock lags the RTC by the time spent asleep.
+//!
+//! This function can only be used with the Hibernation module in counter
+//! mode; HibernateClockCalendarGet() is its equivalent in calendar mode.
+//!
+//! \return Returns the value of the RTC counter in seconds.
+//
+//*****************************************************************************
+uint32_t
+HibernateClockGet(uint32_t *pui32SubSeconds)
+{
+    uint32_t ui32Key, ui32SubSeconds, ui32Seconds;
+
+    ASSERT(!g_sHibernateClock.bCalendar);
+
+    ui32Key = AtomicEnter();
+    ui32SubSeconds = _HibernateClockSubSecondsGet();
+    ui32Seconds = g_sHibernateClock.ui32Seconds;
+    AtomicExit(ui32Key);
+
+    if(pui32SubSeconds)
+    {
+        *pui32SubSeconds = ui32SubSeconds;
+    }
+
+    return(ui32Seconds);
+}
+
+//*****************************************************************************
+//
+//! Gets the date and time of the cached real time clock in calendar mode.
+//!
+//! \param psTime is the structure that receives the date and time.
+//! \param pui32SubSeconds is a pointer to the location that receives the sub
+//! second count in 1/32768 seconds, or 0 if it is not needed.
+//!
+//! This function is the calendar mode equivalent of HibernateClockGet().  The
+//! calendar registers are read and converted only when the clock moves to
+//! the next second; otherwise the date and time are copied from the last
+//! conversion.  Unlike HibernateCalendarGet(), this function does not fail
+//! when the date changes during the read.  The requirements of
+//! HibernateClockGet() apply.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HibernateClockCalendarGet(struct tm *psTime, uint32_t *pui32SubSeconds)
+{
+    uint32_t ui32Key, ui32SubSeconds;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(g_sHibernateClock.bCalendar);
+    ASSERT(psTime != 0);
+
+    ui32Key = AtomicEnter();
+    ui32SubSeconds = _HibernateClockSubSecondsGet();
+    *psTime = g_sHibernateClock.sTime;
+    AtomicExit(ui32Key);
+
+    if(pui32SubSeconds)
+    {
+        *pui32SubSeconds = ui32SubSeconds;
+    }
+}
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
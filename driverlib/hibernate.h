@@ -211,6 +211,8 @@ extern void HibernateRTCTrimSet(uint32_t ui32Trim);
 extern uint32_t HibernateRTCTrimGet(void);
 extern void HibernateDataSet(uint32_t *pui32Data, uint32_t ui32Count);
 extern void HibernateDataGet(uint32_t *pui32Data, uint32_t ui32Count);
+extern void HibernateDataWrite(uint32_t ui32Index, uint32_t ui32Value);
+extern void HibernateDataFlush(void);
 extern void HibernateRequest(void);
 extern void HibernateIntEnable(uint32_t ui32IntFlags);
 extern void HibernateIntDisable(uint32_t ui32IntFlags);
@@ -230,6 +232,11 @@ extern void HibernateCalendarSet(struct tm *psTime);
 extern int HibernateCalendarGet(struct tm *psTime);
 extern void HibernateCalendarMatchSet(uint32_t ui32Index, struct tm *psTime);
 extern void HibernateCalendarMatchGet(uint32_t ui32Index, struct tm *psTime);
+extern void HibernateClockSync(uint32_t ui32SysClock);
+extern void HibernateClockResume(void);
+extern uint32_t HibernateClockGet(uint32_t *pui32SubSeconds);
+extern void HibernateClockCalendarGet(struct tm *psTime,
+                                      uint32_t *pui32SubSeconds);
 extern void HibernateTamperEnable(void);
 extern void HibernateTamperEventsConfig(uint32_t ui32Config);
 extern bool HibernateTamperEventsGet(uint32_t ui32Index, uint32_t *pui32RTC,
@@ -0,0 +1,403 @@
+//*****************************************************************************
+//
+// idle.c - Tickless low-power idle manager.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup idle_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/hibernate.h"
+#include "driverlib/idle.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The number of RTC sub-second counts per second.
+//
+//*****************************************************************************
+#define IDLE_RTC_RATE           32768
+
+//*****************************************************************************
+//
+// The number of RTC sub-second counts to wait for power to be removed after
+// a hibernation request, before carrying on as if it had been refused.
+//
+//*****************************************************************************
+#define IDLE_HIBERNATE_WAIT     64
+
+//*****************************************************************************
+//
+// The idle configuration, the hibernation module interrupt number for this
+// device, and the idle statistics.
+//
+//*****************************************************************************
+static tIdleConfig g_sIdleConfig;
+static uint32_t g_ui32IdleInt;
+static tIdleStats g_sIdleStats;
+
+//*****************************************************************************
+//
+// Reads the RTC as a count of 1/32768 second ticks.  The seconds counter is
+// read again to catch a sub-second count that wrapped between the reads.
+//
+//*****************************************************************************
+static uint64_t
+_IdleRTCGet(void)
+{
+    uint32_t ui32Seconds, ui32SubSeconds;
+
+    do
+    {
+        ui32Seconds = HibernateRTCGet();
+        ui32SubSeconds = HibernateRTCSSGet();
+    }
+    while(ui32Seconds != HibernateRTCGet());
+
+    return(((uint64_t)ui32Seconds * IDLE_RTC_RATE) + ui32SubSeconds);
+}
+
+//*****************************************************************************
+//
+//! Initializes the idle manager.
+//!
+//! \param psConfig is a pointer to the description of the low-power modes.
+//!
+//! This function records the wake latencies and break-even times of the
+//! low-power modes and applies the deep-sleep clock and power settings.  The
+//! Hibernation module must already be enabled with its RTC running, since
+//! the RTC provides both the wake-up event and the time base that is kept
+//! while the system clock is stopped.
+//!
+//! The deep-sleep clock settings apply to TM4C129 devices; on TM4C123
+//! devices \e ui32DeepSleepDiv should be 0 and the deep-sleep clock should be
+//! configured with SysCtlDeepSleepClockSet() instead.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+IdleInit(const tIdleConfig *psConfig)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig != 0);
+
+    g_sIdleConfig = *psConfig;
+    g_sIdleStats.ui32SleepCount = 0;
+    g_sIdleStats.ui32DeepSleepCount = 0;
+    g_sIdleStats.ui64SleepTime = 0;
+    g_sIdleStats.ui64DeepSleepTime = 0;
+
+    g_ui32IdleInt = CLASS_IS_TM4C129 ? INT_HIBERNATE_TM4C129 :
+                                       INT_HIBERNATE_TM4C123;
+
+    if(psConfig->ui32DeepSleepDiv)
+    {
+        SysCtlDeepSleepClockConfigSet(psConfig->ui32DeepSleepDiv,
+                                      psConfig->ui32DeepSleepClock);
+    }
+
+    if(psConfig->ui32DeepSleepPower)
+    {
+        SysCtlDeepSleepPowerSet(psConfig->ui32DeepSleepPower);
+    }
+}
+
+//*****************************************************************************
+//
+//! Idles the processor until the next deadline.
+//!
+//! \param ui32IdleUs is the time in microseconds until the next deadline, or
+//! \b IDLE_FOREVER if there is none.
+//!
+//! This function picks the deepest low-power mode whose break-even time fits
+//! in \e ui32IdleUs, programs an RTC match that wakes the device early by
+//! that mode's wake latency, and enters the mode.  Hibernation is used for
+//! the longest periods, deep sleep with the reduced deep-sleep clock for
+//! medium periods, and sleep otherwise.  Any enabled interrupt also ends the
+//! idle period early.
+//!
+//! If SysTick is running, it is stopped for the idle period so that its tick
+//! does not wake the processor, and is restarted afterwards with the part
+//! of its period that remained.  The time actually spent idle is measured on
+//! the RTC and returned, so that an operating system can advance its tick
+//! count by the ticks that were skipped.  The cached clock of
+//! HibernateClockGet() is resynchronized with the RTC on wake.
+//!
+//! A successful hibernation does not return; the device resets when the RTC
+//! match occurs and the application must restore its state, for example
+//! from the battery-backed memory.  If hibernation cannot be entered, for
+//! example because a wake event is already pending, the function falls back
+//! to deep sleep.
+//!
+//! This function should be called with interrupts disabled by
+//! IntMasterDisable(), so that no interrupt can make work ready between the
+//! caller deciding to idle and the processor stopping.  A pending interrupt
+//! still wakes the processor; it is serviced once the caller enables
+//! interrupts again.
+//!
+//! \return Returns the time in microseconds spent idle.
+//
+//*****************************************************************************
+uint32_t
+IdleEnter(uint32_t ui32IdleUs)
+{
+    uint64_t ui64Start, ui64Elapsed, ui64Wait;
+    uint32_t ui32Latency, ui32Ticks, ui32STCtrl, ui32STReload, ui32STCurrent;
+    uint32_t ui32WakeFlags;
+    bool bDeep, bHibernate, bIntEnabled;
+
+    //
+    // Pick the deepest mode that pays off over the idle period.
+    //
+    bHibernate = (g_sIdleConfig.ui32HibernateMin &&
+                  (ui32IdleUs != IDLE_FOREVER) &&
+                  (ui32IdleUs >= g_sIdleConfig.ui32HibernateMin));
+    bDeep = (bHibernate || (g_sIdleConfig.ui32DeepSleepMin &&
+                            (ui32IdleUs >= g_sIdleConfig.ui32DeepSleepMin)));
+    ui32Latency = (bHibernate ? g_sIdleConfig.ui32HibernateLatency :
+                   (bDeep ? g_sIdleConfig.ui32DeepSleepLatency :
+                    g_sIdleConfig.ui32SleepLatency));
+
+    //
+    // Wake early by the latency of the chosen mode.  Periods too short for
+    // the RTC to time are not worth idling for.
+    //
+    ui32Ticks = 0;
+    if(ui32IdleUs != IDLE_FOREVER)
+    {
+        if(ui32IdleUs <= ui32Latency)
+        {
+            return(0);
+        }
+        ui32Ticks = (uint32_t)((((uint64_t)(ui32IdleUs - ui32Latency)) *
+                                IDLE_RTC_RATE) / 1000000);
+        if(ui32Ticks < 2)
+        {
+            return(0);
+        }
+    }
+
+    //
+    // Stop the SysTick so that its interrupt does not end the idle period,
+    // noting how far through its period it was.
+    //
+    ui32STCtrl = HWREG(NVIC_ST_CTRL);
+    ui32STCurrent = 0;
+    if(ui32STCtrl & NVIC_ST_CTRL_ENABLE)
+    {
+        HWREG(NVIC_ST_CTRL) = ui32STCtrl & ~NVIC_ST_CTRL_ENABLE;
+        ui32STCurrent = HWREG(NVIC_ST_CURRENT);
+    }
+
+    ui64Start = _IdleRTCGet();
+
+    //
+    // Set the RTC match that ends the idle period and let it wake the
+    // processor.
+    //
+    bIntEnabled = IntIsEnabled(g_ui32IdleInt) ? true : false;
+    if(ui32Ticks)
+    {
+        HibernateRTCMatchSet(0, (uint32_t)((ui64Start + ui32Ticks) /
+                                           IDLE_RTC_RATE));
+        HibernateRTCSSMatchSet(0, (uint32_t)((ui64Start + ui32Ticks) %
+                                             IDLE_RTC_RATE));
+        HibernateIntClear(HIBERNATE_INT_RTC_MATCH_0);
+        HibernateIntEnable(HIBERNATE_INT_RTC_MATCH_0);
+        IntEnable(g_ui32IdleInt);
+    }
+
+    //
+    // Writes to the Hibernation module are slow, so make sure that a short
+    // match has not already passed before stopping.  A match that occurs
+    // after this check leaves its interrupt pending, which ends the sleep
+    // immediately.
+    //
+    if((ui32Ticks == 0) || (_IdleRTCGet() < (ui64Start + ui32Ticks)))
+    {
+        if(bHibernate)
+        {
+            //
+            // Hibernate until the RTC match.  Power is removed some time
+            // after the request, so wait for it with the RTC wake still
+            // enabled.  If power is still on after a while, or the match has
+            // passed, carry on into deep sleep with the same match.
+            //
+            ui32WakeFlags = HibernateWakeGet();
+            HibernateWakeSet(ui32WakeFlags | HIBERNATE_WAKE_RTC);
+            HibernateRequest();
+
+            ui64Wait = _IdleRTCGet() + IDLE_HIBERNATE_WAIT;
+            if(ui64Wait > (ui64Start + ui32Ticks))
+            {
+                ui64Wait = ui64Start + ui32Ticks;
+            }
+            while(_IdleRTCGet() < ui64Wait)
+            {
+            }
+
+            HibernateWakeSet(ui32WakeFlags);
+        }
+
+        if(bDeep)
+        {
+            SysCtlDeepSleep();
+        }
+        else
+        {
+            SysCtlSleep();
+        }
+    }
+
+    //
+    // Measure the time spent idle.
+    //
+    ui64Elapsed = ((_IdleRTCGet() - ui64Start) * 1000000) / IDLE_RTC_RATE;
+    if(ui64Elapsed > 0xFFFFFFFE)
+    {
+        ui64Elapsed = 0xFFFFFFFE;
+    }
+
+    //
+    // The cycle counter did not run during the sleep, so bring the cached
+    // clock up to the RTC.
+    //
+    HibernateClockResume();
+
+    //
+    // Remove the RTC match so that it does not fire later.  Its pending
+    // interrupt is dropped unless another Hibernation module interrupt is
+    // also waiting to be handled.
+    //
+    if(ui32Ticks)
+    {
+        HibernateIntDisable(HIBERNATE_INT_RTC_MATCH_0);
+        HibernateIntClear(HIBERNATE_INT_RTC_MATCH_0);
+        if(HibernateIntStatus(true) == 0)
+        {
+            IntPendClear(g_ui32IdleInt);
+        }
+        if(!bIntEnabled)
+        {
+            IntDisable(g_ui32IdleInt);
+        }
+    }
+
+    //
+    // Restart the SysTick with the rest of the period it was stopped in.
+    // The counter can only be cleared, so the remaining count is loaded
+    // through the reload register, which is put back once the counter has
+    // taken it.
+    //
+    if(ui32STCtrl & NVIC_ST_CTRL_ENABLE)
+    {
+        ui32STReload = HWREG(NVIC_ST_RELOAD);
+        if(ui32STCurrent)
+        {
+            HWREG(NVIC_ST_RELOAD) = ui32STCurrent;
+        }
+        HWREG(NVIC_ST_CURRENT) = 0;
+        HWREG(NVIC_ST_CTRL) = ui32STCtrl;
+        if(ui32STCurrent)
+        {
+            while(HWREG(NVIC_ST_CURRENT) == 0)
+            {
+            }
+            HWREG(NVIC_ST_RELOAD) = ui32STReload;
+        }
+    }
+
+    if(bDeep)
+    {
+        g_sIdleStats.ui32DeepSleepCount++;
+        g_sIdleStats.ui64DeepSleepTime += ui64Elapsed;
+    }
+    else
+    {
+        g_sIdleStats.ui32SleepCount++;
+        g_sIdleStats.ui64SleepTime += ui64Elapsed;
+    }
+
+    return((uint32_t)ui64Elapsed);
+}
+
+//*****************************************************************************
+//
+//! Gets the idle statistics.
+//!
+//! \param psStats is a pointer to the structure that receives the
+//! statistics.
+//!
+//! This function returns the number of times each low-power mode was
+//! entered and the total time spent in it since IdleInit().  Together with
+//! the current drawn in each mode, this gives the average idle current.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+IdleStatsGet(tIdleStats *psStats)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStats != 0);
+
+    *psStats = g_sIdleStats;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
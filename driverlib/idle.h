@@ -0,0 +1,166 @@
+//*****************************************************************************
+//
+// idle.h - Prototypes for the tickless low-power idle manager.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_IDLE_H__
+#define __DRIVERLIB_IDLE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The value that can be passed to IdleEnter() when there is no pending
+// deadline.
+//
+//*****************************************************************************
+#define IDLE_FOREVER            0xFFFFFFFF
+
+//*****************************************************************************
+//
+//! This structure describes the low-power modes available to IdleEnter().
+//! All times are in microseconds.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The time from a wake event to code running again after sleep mode.
+    //
+    uint32_t ui32SleepLatency;
+
+    //
+    //! The shortest idle period for which deep-sleep mode is used, or 0 to
+    //! never use deep-sleep mode.
+    //
+    uint32_t ui32DeepSleepMin;
+
+    //
+    //! The time from a wake event to code running again after deep-sleep
+    //! mode, including the time for the oscillators and PLL to restart.
+    //
+    uint32_t ui32DeepSleepLatency;
+
+    //
+    //! The shortest idle period for which hibernation is used, or 0 to never
+    //! hibernate.
+    //
+    uint32_t ui32HibernateMin;
+
+    //
+    //! The time from the RTC match to the application being ready to run
+    //! after hibernation, including the reset and start-up code.
+    //
+    uint32_t ui32HibernateLatency;
+
+    //
+    //! The divider passed to SysCtlDeepSleepClockConfigSet(), or 0 to leave
+    //! the deep-sleep clock unchanged.
+    //
+    uint32_t ui32DeepSleepDiv;
+
+    //
+    //! The configuration passed to SysCtlDeepSleepClockConfigSet().
+    //
+    uint32_t ui32DeepSleepClock;
+
+    //
+    //! The configuration passed to SysCtlDeepSleepPowerSet(), or 0 to leave
+    //! the deep-sleep power configuration unchanged.
+    //
+    uint32_t ui32DeepSleepPower;
+}
+tIdleConfig;
+
+//*****************************************************************************
+//
+//! This structure receives the idle statistics from IdleStatsGet().  Times
+//! are in microseconds.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of times sleep mode was entered.
+    //
+    uint32_t ui32SleepCount;
+
+    //
+    //! The number of times deep-sleep mode was entered.
+    //
+    uint32_t ui32DeepSleepCount;
+
+    //
+    //! The total time spent in sleep mode.
+    //
+    uint64_t ui64SleepTime;
+
+    //
+    //! The total time spent in deep-sleep mode.
+    //
+    uint64_t ui64DeepSleepTime;
+}
+tIdleStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void IdleInit(const tIdleConfig *psConfig);
+extern uint32_t IdleEnter(uint32_t ui32IdleUs);
+extern void IdleStatsGet(tIdleStats *psStats);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_IDLE_H__
@@ -48,9 +48,11 @@
 #include <stdint.h>
 #include "inc/hw_ints.h"
 #include "inc/hw_nvic.h"
+#include "inc/hw_sysctl.h"
 #include "inc/hw_types.h"
 #include "driverlib/cpu.h"
 #include "driverlib/debug.h"
+#include "driverlib/delay.h"
 #include "driverlib/interrupt.h"
 
 //*****************************************************************************
@@ -115,6 +117,220 @@ static const uint32_t g_pui32PendRegs[] = {NVIC_PEND0, NVIC_PEND1, NVIC_PEND2, N
 //*****************************************************************************
 static const uint32_t g_pui32UnpendRegs[] = {NVIC_UNPEND0, NVIC_UNPEND1, NVIC_UNPEND2, NVIC_UNPEND3, NVIC_UNPEND4};
 
+//*****************************************************************************
+//
+// The number of entries in the RAM vector table and the number of vectors
+// implemented by the device in use.  When the library is built without a part
+// or target class, the table is sized for the class with the most vectors so
+// that it can serve either, and the device class is read at run time.
+//
+//*****************************************************************************
+#ifdef INT_RESOLVE
+#define INT_NUM_VECTORS         NUM_INTERRUPTS
+#define INT_NUM_ACTIVE          NUM_INTERRUPTS
+#else
+#define INT_NUM_VECTORS         NUM_INTERRUPTS_TM4C123
+#define INT_NUM_ACTIVE          (CLASS_IS_TM4C129 ? NUM_INTERRUPTS_TM4C129 :  \
+                                 NUM_INTERRUPTS_TM4C123)
+#endif
+
+//*****************************************************************************
+//
+// The processor vector table.
+//
+// This contains a list of the handlers for the various interrupt sources in
+// the system.  The layout of this list is defined by the hardware; assertion
+// of an interrupt causes the processor to start executing directly at the
+// address given in the corresponding location in this list.  The table must
+// be aligned on a 1024-byte boundary since the vector table offset register
+// ignores the lower ten bits.
+//
+//*****************************************************************************
+#if defined(ewarm)
+#pragma data_alignment = 1024
+static __no_init void (*g_pfnRAMVectors[INT_NUM_VECTORS])(void) @ "VTABLE";
+#elif defined(sourcerygxx)
+static __attribute__((section(".cs3.region-head.ram"))) void (*g_pfnRAMVectors[INT_NUM_VECTORS])(void) __attribute__((aligned(1024)));
+#elif defined(ccs) || defined(DOXYGEN)
+#pragma DATA_ALIGN(g_pfnRAMVectors, 1024)
+#pragma DATA_SECTION(g_pfnRAMVectors, ".vtable")
+void (*g_pfnRAMVectors[INT_NUM_VECTORS])(void);
+#else
+static __attribute__((section("vtable"))) void (*g_pfnRAMVectors[INT_NUM_VECTORS])(void) __attribute__((aligned(1024)));
+#endif
+
+#ifdef INTERRUPT_PROFILE
+//*****************************************************************************
+//
+// The handlers of the vectors that are being profiled.  While a vector is
+// profiled its entry in the RAM vector table points at _IntProfileHandler()
+// and the application handler is called from here instead.  Entries of
+// vectors that are dispatched directly are not used.
+//
+//*****************************************************************************
+static void (*g_pfnProfileVectors[INT_NUM_VECTORS])(void);
+
+//*****************************************************************************
+//
+// The service time statistics for each vector, in processor cycles.
+//
+//*****************************************************************************
+static tIntProfile g_psIntProfile[INT_NUM_VECTORS];
+
+//*****************************************************************************
+//
+// The number of cycles spent in profiled handlers that have run to
+// completion, used to remove the time spent in preempting handlers from the
+// service time of the handler they preempted.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32IntProfileNested;
+#endif
+
+//*****************************************************************************
+//
+//! \internal
+//! The default interrupt handler.
+//!
+//! This is the default interrupt handler for all interrupts.  It simply loops
+//! forever so that the system state is preserved for observation by a
+//! debugger.  Since interrupts must be disabled on unregistering their
+//! handlers, this handler should never be called during normal operation.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void _IntDefaultHandler(void) {
+    //
+    // Go into an infinite loop.
+    //
+    while (1) {
+    }
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! Copies the current vector table into the RAM vector table.
+//!
+//! This function copies the vector table that the processor is using, which
+//! is the flash table placed at reset unless the application has moved it,
+//! into \e g_pfnRAMVectors and then points the vector table offset register at
+//! the RAM copy.  It does nothing if the RAM table is already in use.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void _IntVTableRelocate(void) {
+    uint32_t ui32Idx, ui32Value;
+
+    //
+    // Make sure that the RAM vector table is correctly aligned.
+    //
+    ASSERT(((uint32_t)g_pfnRAMVectors & ~NVIC_VTABLE_OFFSET_M) == 0);
+
+    //
+    // There is nothing to do if the RAM vector table is already in use.
+    //
+    ui32Value = HWREG(NVIC_VTABLE);
+    if (ui32Value == (uint32_t)g_pfnRAMVectors) {
+        return;
+    }
+
+    //
+    // Copy the vector table from its current location into the RAM table.
+    // Only the vectors that the device implements are copied since the table
+    // being copied may be no longer than that.
+    //
+    for (ui32Idx = 0; ui32Idx < INT_NUM_ACTIVE; ui32Idx++) {
+        g_pfnRAMVectors[ui32Idx] = (void (*)(void))HWREG((ui32Idx * 4) + ui32Value);
+    }
+
+    //
+    // Point the NVIC at the RAM vector table.
+    //
+    HWREG(NVIC_VTABLE) = (uint32_t)g_pfnRAMVectors;
+}
+
+#ifdef INTERRUPT_PROFILE
+//*****************************************************************************
+//
+//! \internal
+//! The instrumented interrupt handler.
+//!
+//! This handler is placed in the RAM vector table for every vector that is
+//! being profiled.  It determines the active vector from the interrupt
+//! control register, takes a cycle count stamp, calls the application
+//! handler, and then takes a second stamp and folds the service time into the
+//! statistics for that vector.  Time spent in profiled handlers that preempt
+//! this one is not charged to this vector.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void _IntProfileHandler(void) {
+    uint32_t ui32Int, ui32Start, ui32Nested, ui32Elapsed, ui32Service;
+    tIntProfile *psProfile;
+    bool bMasked;
+
+    //
+    // Take the entry stamp and snapshot the preemption accumulator.
+    //
+    ui32Start = DelayCountGet();
+    ui32Nested = g_ui32IntProfileNested;
+    ui32Int = HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M;
+
+    //
+    // Call the application handler.
+    //
+    g_pfnProfileVectors[ui32Int]();
+
+    //
+    // Take the exit stamp and update the statistics with interrupts disabled
+    // so that a preempting handler cannot interleave with the update.
+    //
+    bMasked = CPUcpsid();
+    ui32Elapsed = DelayCountGet() - ui32Start;
+    ui32Service = ui32Elapsed - (g_ui32IntProfileNested - ui32Nested);
+    g_ui32IntProfileNested = ui32Nested + ui32Elapsed;
+
+    psProfile = &g_psIntProfile[ui32Int];
+    psProfile->ui32Count++;
+    psProfile->ui64Total += ui32Service;
+    if (ui32Service < psProfile->ui32Min) {
+        psProfile->ui32Min = ui32Service;
+    }
+    if (ui32Service > psProfile->ui32Max) {
+        psProfile->ui32Max = ui32Service;
+    }
+
+    if (!bMasked) {
+        CPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! \internal
+//! Clears the statistics of a vector.
+//!
+//! \param ui32Interrupt specifies the vector whose statistics are cleared.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void _IntProfileClear(uint32_t ui32Interrupt) {
+    tIntProfile *psProfile;
+
+    psProfile = &g_psIntProfile[ui32Interrupt];
+    psProfile->ui32Count = 0;
+    psProfile->ui32Min = 0xFFFFFFFF;
+    psProfile->ui32Max = 0;
+    psProfile->ui32Average = 0;
+    psProfile->ui64Total = 0;
+}
+#endif
+
 //*****************************************************************************
 //
 //! Enables the processor interrupt.
@@ -180,6 +396,141 @@ bool IntMasterDisable(void) {
     return (CPUcpsid());
 }
 
+//*****************************************************************************
+//
+//! Registers a function to be called when an interrupt occurs.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//! \param pfnHandler is a pointer to the function to be called.
+//!
+//! This function is used to specify the handler function to be called when
+//! the given interrupt is asserted to the processor.  The \e ui32Interrupt
+//! parameter must be one of the valid \b INT_* values listed in Peripheral
+//! Driver Library User's Guide and defined in the inc/hw_ints.h header file.
+//! When the interrupt occurs, if it is enabled (via IntEnable()), the handler
+//! function is called in interrupt context.  Because the handler function can
+//! preempt other code, care must be taken to protect memory or peripherals
+//! that are accessed by the handler and other non-handler code.
+//!
+//! On the first call, the vector table currently in use is copied into a
+//! 1024-byte aligned table in SRAM and the NVIC is pointed at the copy, so
+//! handlers that were fixed at link time keep working.  The RAM table is
+//! dispatched by the hardware exactly like the flash table, so a registered
+//! handler adds no overhead to the interrupt entry.
+//!
+//! \note The use of this function (directly or indirectly via a peripheral
+//! driver interrupt register function) moves the interrupt vector table from
+//! flash to SRAM.  Therefore, care must be taken when linking the application
+//! to ensure that the SRAM vector table is located at the beginning of SRAM;
+//! otherwise the NVIC does not look in the correct portion of memory for the
+//! vector table (it requires the vector table be on a 1 kB memory alignment).
+//! Normally, the SRAM vector table is so placed via the use of the linker
+//! script.  See the discussion of compile-time versus run-time interrupt
+//! handler registration in the introduction to this chapter.
+//!
+//! \b Example: Set the UART 0 interrupt handler.
+//!
+//! \verbatim
+//! //
+//! // UART 0 interrupt handler.
+//! //
+//! void
+//! UART0Handler(void)
+//! {
+//!     //
+//!     // Handle interrupt.
+//!     //
+//! }
+//!
+//! //
+//! // Set the UART 0 interrupt handler.
+//! //
+//! IntRegister(INT_UART0, UART0Handler);
+//!
+//! \endverbatim
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void)) {
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Interrupt < NUM_INTERRUPTS);
+
+    //
+    // Move the vector table into SRAM if that has not been done already.
+    //
+    _IntVTableRelocate();
+
+#ifdef INTERRUPT_PROFILE
+    //
+    // If this vector is being profiled, replace the handler called by the
+    // instrumentation and leave the vector table entry alone.
+    //
+    if (pfnHandler &&
+        (g_pfnRAMVectors[ui32Interrupt] == _IntProfileHandler)) {
+        g_pfnProfileVectors[ui32Interrupt] = pfnHandler;
+        return;
+    }
+#endif
+
+    //
+    // Save the interrupt handler.
+    //
+    g_pfnRAMVectors[ui32Interrupt] = pfnHandler;
+}
+
+//*****************************************************************************
+//
+//! Unregisters the function to be called when an interrupt occurs.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//!
+//! This function is used to indicate that no handler is registered in the
+//! vector table for the given interrupt.  The \e ui32Interrupt parameter must
+//! be one of the valid \b INT_* values listed in Peripheral Driver Library
+//! User's Guide and defined in the inc/hw_ints.h header file.  The interrupt
+//! should be disabled before calling this function.  If profiling was enabled
+//! for the interrupt it is stopped; the statistics collected so far are kept.
+//!
+//! \b Example: Reset the UART 0 interrupt handler to the default handler.
+//!
+//! \verbatim
+//! //
+//! // Reset the UART 0 interrupt handler to the default handler.
+//! //
+//! IntUnregister(INT_UART0);
+//!
+//! \endverbatim
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntUnregister(uint32_t ui32Interrupt) {
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Interrupt < NUM_INTERRUPTS);
+
+    //
+    // Move the vector table into SRAM if that has not been done already.
+    //
+    _IntVTableRelocate();
+
+#ifdef INTERRUPT_PROFILE
+    //
+    // Stop profiling this vector.
+    //
+    g_pfnProfileVectors[ui32Interrupt] = 0;
+#endif
+
+    //
+    // Reset the interrupt handler.
+    //
+    g_pfnRAMVectors[ui32Interrupt] = _IntDefaultHandler;
+}
+
 //*****************************************************************************
 //
 //! Sets the priority grouping of the interrupt controller.
@@ -667,6 +1018,84 @@ void IntPendClear(uint32_t ui32Interrupt) {
     }
 }
 
+//*****************************************************************************
+//
+//! Sets the priority masking level
+//!
+//! \param ui32PriorityMask is the priority level that is masked.
+//!
+//! This function sets the interrupt priority masking level so that all
+//! interrupts at the specified or lesser priority level are masked.  Masking
+//! interrupts can be used to globally disable a set of interrupts with
+//! priority below a predetermined threshold.  A value of 0 disables priority
+//! masking.
+//!
+//! Smaller numbers correspond to higher interrupt priorities.  So for example
+//! a priority level mask of 4 allows interrupts of priority level 0-3,
+//! and interrupts with a numerical priority of 4 and greater are blocked.
+//!
+//! \note The hardware priority mechanism only looks at the upper 3 bits of the
+//! priority level, so any prioritization must be performed in those bits.
+//!
+//! \note For critical sections that nest, AtomicEnter() and AtomicExit()
+//! raise and restore the mask without lowering a mask set by the caller.
+//!
+//! \b Example: Mask of interrupt priorities greater than or equal to 0x80.
+//!
+//! \verbatim
+//! //
+//! // Mask of interrupt priorities greater than or equal to 0x80.
+//! //
+//! IntPriorityMaskSet(0x80);
+//!
+//! \endverbatim
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntPriorityMaskSet(uint32_t ui32PriorityMask) {
+    //
+    // Set the priority mask.
+    //
+    CPUbasepriSet(ui32PriorityMask);
+}
+
+//*****************************************************************************
+//
+//! Gets the priority masking level
+//!
+//! This function gets the current setting of the interrupt priority masking
+//! level.  The value returned is the priority level such that all interrupts
+//! of that and lesser priority are masked.  A value of 0 means that priority
+//! masking is disabled.
+//!
+//! Smaller numbers correspond to higher interrupt priorities.  So for example
+//! a priority level mask of 4 allows interrupts of priority level 0-3,
+//! and interrupts with a numerical priority of 4 and greater are blocked.
+//!
+//! \note The hardware priority mechanism only looks at the upper 3 bits of the
+//! priority level, so any prioritization must be performed in those bits.
+//!
+//! \b Example: Get the current interrupt priority mask.
+//!
+//! \verbatim
+//! //
+//! // Get the current interrupt priority mask.
+//! //
+//! IntPriorityMaskGet();
+//!
+//! \endverbatim
+//!
+//! \return Returns the value of the interrupt priority level mask.
+//
+//*****************************************************************************
+uint32_t IntPriorityMaskGet(void) {
+    //
+    // Return the current priority mask.
+    //
+    return (CPUbasepriGet());
+}
+
 //*****************************************************************************
 //
 //! Triggers an interrupt.
@@ -697,6 +1126,284 @@ void IntTrigger(uint32_t ui32Interrupt) {
     HWREG(NVIC_SW_TRIG) = ui32Interrupt - 16;
 }
 
+//*****************************************************************************
+//
+//! Applies a pre-packed interrupt configuration.
+//!
+//! \param psConfig is a pointer to the configuration, as defined with
+//! INT_CONFIG_DEFINE().
+//!
+//! This function sets the priorities and enables of all of the interrupts in
+//! an interrupt configuration table at once.  The table is packed into
+//! register images at compile time, so each priority register is written
+//! with a single store (or a single read-modify-write where the table leaves
+//! some of its fields alone) and each enable register with a single store,
+//! instead of one read-modify-write per interrupt as with IntPrioritySet()
+//! and IntEnable().  Interrupts that are not enabled by the table are not
+//! disabled.
+//!
+//! Handlers named by the table that differ from the ones in the vector table
+//! in use are installed with IntRegister(), which moves the vector table into
+//! SRAM.  When the table names the same handlers as the vector table linked
+//! into flash, the vector table is left where it is.  The handlers are
+//! installed and the priorities set before any interrupt is enabled.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntConfigApply(const tIntConfig *psConfig) {
+    const tIntConfigVector *psVector;
+    uint32_t ui32Idx, ui32Mask, ui32VTable;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig);
+
+    //
+    // Install the handlers that are not already in the vector table.
+    //
+    for (ui32Idx = 0; ui32Idx < psConfig->ui32NumVectors; ui32Idx++) {
+        psVector = &psConfig->psVectors[ui32Idx];
+        ui32VTable = HWREG(NVIC_VTABLE);
+        if (psVector->pfnHandler && (HWREG(ui32VTable + (psVector->ui32Interrupt * 4)) != (uint32_t)psVector->pfnHandler)) {
+            IntRegister(psVector->ui32Interrupt, psVector->pfnHandler);
+        }
+    }
+
+    //
+    // Write the priority registers.  Registers that are wholly described by
+    // the table are written outright; the others keep the priorities of the
+    // interrupts that the table does not list.
+    //
+    for (ui32Idx = 1; ui32Idx < INT_CONFIG_PRI_WORDS; ui32Idx++) {
+        ui32Mask = psConfig->pui32PriMask[ui32Idx];
+        if (ui32Mask == 0xFFFFFFFF) {
+            HWREG(g_pui32Regs[ui32Idx]) = psConfig->pui32Pri[ui32Idx];
+        } else if (ui32Mask) {
+            HWREG(g_pui32Regs[ui32Idx]) = (HWREG(g_pui32Regs[ui32Idx]) & ~ui32Mask) | psConfig->pui32Pri[ui32Idx];
+        }
+    }
+
+    //
+    // Enable the interrupts.  Writing zero bits to the enable registers has
+    // no effect, so interrupts enabled elsewhere stay enabled.
+    //
+    for (ui32Idx = 0; ui32Idx < INT_CONFIG_EN_WORDS; ui32Idx++) {
+        if (psConfig->pui32Enable[ui32Idx]) {
+            HWREG(g_pui32EnRegs[ui32Idx]) = psConfig->pui32Enable[ui32Idx];
+        }
+    }
+}
+
+#ifdef INTERRUPT_PROFILE
+//*****************************************************************************
+//
+//! Starts measuring the service time of an interrupt handler.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//!
+//! This function wraps the handler of the given interrupt with cycle counter
+//! stamps taken on entry and exit, and accumulates the number of times the
+//! handler ran and its minimum, average and maximum service times in
+//! processor cycles.  The statistics are read with IntProfileGet().  Time
+//! spent in profiled handlers that preempt the handler is excluded from its
+//! service time; time spent in handlers that are not profiled is not.
+//!
+//! The vector table is moved into SRAM if necessary, and the handler that is
+//! currently in the table, or registered later with IntRegister(), is the one
+//! that is measured.  Vectors that are not profiled continue to be dispatched
+//! directly by the hardware.
+//!
+//! \note This function is only available when the library is built with
+//! \b INTERRUPT_PROFILE defined.  The measurement uses DelayCountGet(), which
+//! this function starts with DelayInit(), so the requirements of DelayInit()
+//! apply and the cycle counter must not be stopped by the application or a
+//! debugger while profiling is active.
+//!
+//! \return Returns \b true if profiling was enabled or \b false if the
+//! vector has no handler.
+//
+//*****************************************************************************
+bool IntProfileEnable(uint32_t ui32Interrupt) {
+    void (*pfnHandler)(void);
+    bool bMasked, bRet;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Interrupt >= 4) && (ui32Interrupt < NUM_INTERRUPTS));
+
+    //
+    // Make sure the cycle counter is running.
+    //
+    DelayInit();
+
+    //
+    // Move the vector table into SRAM if that has not been done already.
+    //
+    _IntVTableRelocate();
+
+    //
+    // Swap the instrumented handler into the vector table unless it is
+    // already there, in which case the handler that it calls is kept.  A
+    // vector with no handler cannot be profiled.  This is done with
+    // interrupts disabled so that the vector cannot be taken between the two
+    // updates.
+    //
+    bMasked = CPUcpsid();
+    pfnHandler = g_pfnRAMVectors[ui32Interrupt];
+    bRet = (pfnHandler != 0);
+    if (bRet && (pfnHandler != _IntProfileHandler)) {
+        _IntProfileClear(ui32Interrupt);
+        g_pfnProfileVectors[ui32Interrupt] = pfnHandler;
+        g_pfnRAMVectors[ui32Interrupt] = _IntProfileHandler;
+    }
+    if (!bMasked) {
+        CPUcpsie();
+    }
+
+    return (bRet);
+}
+
+//*****************************************************************************
+//
+//! Stops measuring the service time of an interrupt handler.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//!
+//! This function restores direct dispatch of the given interrupt to its
+//! handler.  The statistics collected so far remain available through
+//! IntProfileGet() until profiling is enabled again.
+//!
+//! \note This function is only available when the library is built with
+//! \b INTERRUPT_PROFILE defined.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntProfileDisable(uint32_t ui32Interrupt) {
+    bool bMasked;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Interrupt >= 4) && (ui32Interrupt < NUM_INTERRUPTS));
+
+    //
+    // Put the application handler back into the vector table.
+    //
+    bMasked = CPUcpsid();
+    if (g_pfnRAMVectors[ui32Interrupt] == _IntProfileHandler) {
+        g_pfnRAMVectors[ui32Interrupt] = g_pfnProfileVectors[ui32Interrupt];
+        g_pfnProfileVectors[ui32Interrupt] = 0;
+    }
+    if (!bMasked) {
+        CPUcpsie();
+    }
+}
+
+//*****************************************************************************
+//
+//! Gets the service time statistics of an interrupt handler.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//! \param psProfile is a pointer to the structure that receives the
+//! statistics.
+//!
+//! This function returns a consistent snapshot of the statistics collected
+//! for the given interrupt since profiling was enabled or the statistics were
+//! last reset with IntProfileReset().  All times are in processor cycles.  If
+//! the handler has not run, the count, minimum, average and maximum are all
+//! zero.
+//!
+//! \b Example: Find the interrupt with the longest service time.
+//!
+//! \verbatim
+//! tIntProfile sProfile;
+//! uint32_t ui32Int, ui32Worst = 0, ui32WorstInt = 0;
+//!
+//! for(ui32Int = 16; ui32Int < NUM_INTERRUPTS; ui32Int++)
+//! {
+//!     IntProfileGet(ui32Int, &sProfile);
+//!     if(sProfile.ui32Max > ui32Worst)
+//!     {
+//!         ui32Worst = sProfile.ui32Max;
+//!         ui32WorstInt = ui32Int;
+//!     }
+//! }
+//! \endverbatim
+//!
+//! \note This function is only available when the library is built with
+//! \b INTERRUPT_PROFILE defined.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntProfileGet(uint32_t ui32Interrupt, tIntProfile *psProfile) {
+    bool bMasked;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Interrupt < NUM_INTERRUPTS);
+    ASSERT(psProfile);
+
+    //
+    // Copy the statistics with interrupts disabled so that the handler cannot
+    // update them part way through.
+    //
+    bMasked = CPUcpsid();
+    *psProfile = g_psIntProfile[ui32Interrupt];
+    if (!bMasked) {
+        CPUcpsie();
+    }
+
+    //
+    // Fill in the derived values.
+    //
+    if (psProfile->ui32Count == 0) {
+        psProfile->ui32Min = 0;
+    } else {
+        psProfile->ui32Average = (uint32_t)(psProfile->ui64Total / psProfile->ui32Count);
+    }
+}
+
+//*****************************************************************************
+//
+//! Resets the service time statistics of an interrupt handler.
+//!
+//! \param ui32Interrupt specifies the interrupt in question.
+//!
+//! This function clears the count, minimum, average, maximum and total
+//! service time of the given interrupt, for example at the start of a
+//! measurement window.  Profiling remains enabled if it was enabled.
+//!
+//! \note This function is only available when the library is built with
+//! \b INTERRUPT_PROFILE defined.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void IntProfileReset(uint32_t ui32Interrupt) {
+    bool bMasked;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Interrupt < NUM_INTERRUPTS);
+
+    //
+    // Clear the statistics.
+    //
+    bMasked = CPUcpsid();
+    _IntProfileClear(ui32Interrupt);
+    if (!bMasked) {
+        CPUcpsie();
+    }
+}
+#endif
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
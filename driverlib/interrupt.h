@@ -59,6 +59,358 @@ extern "C"
 //*****************************************************************************
 #define INT_PRIORITY_MASK       ((0xFF << (8 - NUM_PRIORITY_BITS)) & 0xFF)
 
+//*****************************************************************************
+//
+//! The service time statistics of an interrupt handler, as returned by
+//! IntProfileGet().  All times are in processor cycles.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of times that the handler ran.
+    //
+    uint32_t ui32Count;
+
+    //
+    //! The shortest service time.
+    //
+    uint32_t ui32Min;
+
+    //
+    //! The longest service time.
+    //
+    uint32_t ui32Max;
+
+    //
+    //! The average service time.
+    //
+    uint32_t ui32Average;
+
+    //
+    //! The total service time of all runs.
+    //
+    uint64_t ui64Total;
+}
+tIntProfile;
+
+//*****************************************************************************
+//
+// The number of priority registers and enable registers covered by a
+// tIntConfig image.
+//
+//*****************************************************************************
+#define INT_CONFIG_PRI_WORDS    39
+#define INT_CONFIG_EN_WORDS     5
+
+//*****************************************************************************
+//
+// The value to give as the handler of an interrupt configuration table entry
+// that does not name a handler.  Entries that are enabled must name one.
+//
+//*****************************************************************************
+#define INT_CONFIG_NO_HANDLER   0
+
+//*****************************************************************************
+//
+//! An interrupt handler named by an interrupt configuration table, as used by
+//! IntConfigApply().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The interrupt number.
+    //
+    uint32_t ui32Interrupt;
+
+    //
+    //! The handler, or 0 if the table does not name one.
+    //
+    void (*pfnHandler)(void);
+}
+tIntConfigVector;
+
+//*****************************************************************************
+//
+//! A pre-packed image of the NVIC priority and enable registers, built at
+//! compile time from an interrupt configuration table by INT_CONFIG_DEFINE()
+//! and applied by IntConfigApply().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The priority register values, indexed in the same way as the priority
+    //! registers used by IntPrioritySet().
+    //
+    uint32_t pui32Pri[INT_CONFIG_PRI_WORDS];
+
+    //
+    //! The priority fields that are set by the table in each priority
+    //! register.
+    //
+    uint32_t pui32PriMask[INT_CONFIG_PRI_WORDS];
+
+    //
+    //! The values written to the NVIC_EN0 through NVIC_EN4 registers.
+    //
+    uint32_t pui32Enable[INT_CONFIG_EN_WORDS];
+
+    //
+    //! The handlers named by the table.
+    //
+    const tIntConfigVector *psVectors;
+
+    //
+    //! The number of entries in \e psVectors.
+    //
+    uint32_t ui32NumVectors;
+}
+tIntConfig;
+
+//*****************************************************************************
+//
+// Helper macros used by INT_CONFIG_DEFINE().  Each is applied to every entry
+// of an interrupt configuration table and produces a term of a constant
+// expression.
+//
+//*****************************************************************************
+#define _INT_CONFIG_PRI(ui32Word, ui32Int, ui8Priority, bEnable, pfnH)        \
+        | ((((ui32Int) >> 2) == (ui32Word)) ?                                 \
+           ((uint32_t)(ui8Priority) << (8 * ((ui32Int) & 3))) : 0)
+#define _INT_CONFIG_MSK(ui32Word, ui32Int, ui8Priority, bEnable, pfnH)        \
+        | ((((ui32Int) >> 2) == (ui32Word)) ?                                 \
+           ((uint32_t)0xFF << (8 * ((ui32Int) & 3))) : 0)
+#define _INT_CONFIG_SUM(ui32Word, ui32Int, ui8Priority, bEnable, pfnH)        \
+        + ((((ui32Int) >> 2) == (ui32Word)) ?                                 \
+           ((uint32_t)0xFF << (8 * ((ui32Int) & 3))) : 0)
+#define _INT_CONFIG_EN(ui32Word, ui32Int, ui8Priority, bEnable, pfnH)         \
+        | (((bEnable) && ((ui32Int) >= 16) &&                                 \
+            ((((ui32Int) - 16) / 32) == (ui32Word))) ?                        \
+           ((uint32_t)1 << (((ui32Int) - 16) & 31)) : 0)
+#define _INT_CONFIG_VEC(ui32Word, ui32Int, ui8Priority, bEnable, pfnH)        \
+        { (ui32Int), (pfnH) },
+#define _INT_CONFIG_BADINT(ui32Word, ui32Int, ui8Priority, bEnable,           \
+                           pfnH)                                              \
+        | ((ui32Int) < 4) | ((ui32Int) >= NUM_INTERRUPTS) |                   \
+        ((bEnable) && ((ui32Int) < 16))
+#define _INT_CONFIG_BADPRI(ui32Word, ui32Int, ui8Priority, bEnable,           \
+                           pfnH)                                              \
+        | ((ui8Priority) & ~INT_PRIORITY_MASK)
+#define _INT_CONFIG_NOHANDLER(ui32Word, ui32Int, ui8Priority, bEnable,        \
+                              pfnH)                                           \
+        | ((bEnable) && _INT_CONFIG_IS_NONE(pfnH))
+
+//*****************************************************************************
+//
+// Helper macros that detect an entry without a handler at compile time.  The
+// handler is pasted onto _INT_CONFIG_PROBE_, which only expands to two
+// arguments when the handler is 0 (or INT_CONFIG_NO_HANDLER).
+//
+//*****************************************************************************
+#define _INT_CONFIG_PROBE_0     ~, 1
+#define _INT_CONFIG_SECOND(a, b, ...)                                         \
+        b
+#define _INT_CONFIG_PROBE(...)                                                \
+        _INT_CONFIG_SECOND(__VA_ARGS__)
+#define _INT_CONFIG_IS_NONE(pfnH)                                             \
+        _INT_CONFIG_PROBE(_INT_CONFIG_PROBE_##pfnH, 0, ~)
+
+//*****************************************************************************
+//
+// Helper macros that evaluate one register of the image.
+//
+//*****************************************************************************
+#define _INT_CONFIG_PRI_WORD(pfnTable, ui32Word)                              \
+        (0 pfnTable(_INT_CONFIG_PRI, ui32Word))
+#define _INT_CONFIG_MSK_WORD(pfnTable, ui32Word)                              \
+        (0 pfnTable(_INT_CONFIG_MSK, ui32Word))
+#define _INT_CONFIG_DUP_WORD(pfnTable, ui32Word)                              \
+        ((0 pfnTable(_INT_CONFIG_SUM, ui32Word)) !=                           \
+         _INT_CONFIG_MSK_WORD(pfnTable, ui32Word))
+#define _INT_CONFIG_EN_WORD(pfnTable, ui32Word)                               \
+        (0 pfnTable(_INT_CONFIG_EN, ui32Word))
+
+#define _INT_CONFIG_PRI_IMAGE(pfnTable)                                       \
+        _INT_CONFIG_PRI_WORD(pfnTable, 0),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 1),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 2),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 3),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 4),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 5),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 6),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 7),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 8),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 9),                                    \
+        _INT_CONFIG_PRI_WORD(pfnTable, 10),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 11),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 12),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 13),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 14),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 15),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 16),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 17),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 18),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 19),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 20),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 21),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 22),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 23),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 24),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 25),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 26),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 27),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 28),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 29),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 30),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 31),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 32),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 33),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 34),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 35),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 36),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 37),                                   \
+        _INT_CONFIG_PRI_WORD(pfnTable, 38)
+#define _INT_CONFIG_MSK_IMAGE(pfnTable)                                       \
+        _INT_CONFIG_MSK_WORD(pfnTable, 0),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 1),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 2),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 3),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 4),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 5),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 6),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 7),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 8),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 9),                                    \
+        _INT_CONFIG_MSK_WORD(pfnTable, 10),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 11),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 12),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 13),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 14),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 15),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 16),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 17),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 18),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 19),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 20),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 21),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 22),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 23),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 24),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 25),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 26),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 27),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 28),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 29),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 30),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 31),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 32),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 33),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 34),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 35),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 36),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 37),                                   \
+        _INT_CONFIG_MSK_WORD(pfnTable, 38)
+#define _INT_CONFIG_EN_IMAGE(pfnTable)                                        \
+        _INT_CONFIG_EN_WORD(pfnTable, 0),                                     \
+        _INT_CONFIG_EN_WORD(pfnTable, 1),                                     \
+        _INT_CONFIG_EN_WORD(pfnTable, 2),                                     \
+        _INT_CONFIG_EN_WORD(pfnTable, 3),                                     \
+        _INT_CONFIG_EN_WORD(pfnTable, 4)
+#define _INT_CONFIG_DUPS(pfnTable)                                            \
+        _INT_CONFIG_DUP_WORD(pfnTable, 0) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 1) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 2) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 3) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 4) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 5) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 6) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 7) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 8) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 9) ||                                  \
+        _INT_CONFIG_DUP_WORD(pfnTable, 10) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 11) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 12) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 13) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 14) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 15) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 16) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 17) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 18) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 19) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 20) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 21) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 22) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 23) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 24) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 25) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 26) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 27) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 28) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 29) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 30) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 31) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 32) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 33) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 34) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 35) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 36) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 37) ||                                 \
+        _INT_CONFIG_DUP_WORD(pfnTable, 38)
+
+//*****************************************************************************
+//
+//! Defines a pre-packed interrupt configuration.
+//!
+//! \param sName is the name of the tIntConfig variable to define.
+//! \param pfnTable is the name of the interrupt configuration table macro.
+//!
+//! The table is a function-like macro that takes an entry macro and an
+//! argument, and applies the entry macro to the argument, the interrupt
+//! number, the priority, whether the interrupt is enabled, and its handler,
+//! once per interrupt; a table with several entries lists them one after
+//! another, continuing the macro over several lines.  The priority and
+//! enable registers are packed at compile time, and the build fails if an
+//! interrupt is listed twice, a priority uses bits that the hardware ignores,
+//! an interrupt number is not valid or is a system exception that is enabled,
+//! or an enabled interrupt has no handler.  The handler must be the name of a
+//! function, or \b INT_CONFIG_NO_HANDLER for an interrupt that is not
+//! enabled.
+//!
+//! \b Example: Define and apply an interrupt configuration.
+//!
+//! \verbatim
+//! #define APP_INTS(E, A) E(A, INT_TIMER0A, 0x20, true, Timer0AIntHandler)
+//!
+//! INT_CONFIG_DEFINE(g_sIntConfig, APP_INTS);
+//!
+//! IntConfigApply(&g_sIntConfig);
+//! \endverbatim
+//
+//*****************************************************************************
+#define INT_CONFIG_DEFINE(sName, pfnTable)                                    \
+        typedef char sName##_InvalidInterrupt[                                \
+            (0 pfnTable(_INT_CONFIG_BADINT, 0)) ? -1 : 1];                    \
+        typedef char sName##_InvalidPriority[                                 \
+            (0 pfnTable(_INT_CONFIG_BADPRI, 0)) ? -1 : 1];                    \
+        typedef char sName##_DuplicateInterrupt[                              \
+            (_INT_CONFIG_DUPS(pfnTable)) ? -1 : 1];                           \
+        typedef char sName##_EnabledWithoutHandler[                           \
+            (0 pfnTable(_INT_CONFIG_NOHANDLER, 0)) ? -1 : 1];                 \
+        static const tIntConfigVector sName##_psVectors[] =                   \
+        {                                                                     \
+            pfnTable(_INT_CONFIG_VEC, 0)                                      \
+        };                                                                    \
+        const tIntConfig sName =                                              \
+        {                                                                     \
+            { _INT_CONFIG_PRI_IMAGE(pfnTable) },                              \
+            { _INT_CONFIG_MSK_IMAGE(pfnTable) },                              \
+            { _INT_CONFIG_EN_IMAGE(pfnTable) },                               \
+            sName##_psVectors,                                                \
+            sizeof(sName##_psVectors) / sizeof(sName##_psVectors[0])          \
+        }
+
 //*****************************************************************************
 //
 // Prototypes for the APIs.
@@ -81,6 +433,11 @@ extern void IntPendClear(uint32_t ui32Interrupt);
 extern void IntPriorityMaskSet(uint32_t ui32PriorityMask);
 extern uint32_t IntPriorityMaskGet(void);
 extern void IntTrigger(uint32_t ui32Interrupt);
+extern bool IntProfileEnable(uint32_t ui32Interrupt);
+extern void IntProfileDisable(uint32_t ui32Interrupt);
+extern void IntProfileGet(uint32_t ui32Interrupt, tIntProfile *psProfile);
+extern void IntProfileReset(uint32_t ui32Interrupt);
+extern void IntConfigApply(const tIntConfig *psConfig);
 
 //*****************************************************************************
 //
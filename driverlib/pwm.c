@@ -2154,6 +2154,389 @@ PWMOutputUpdateMode(uint32_t ui32Base, uint32_t ui32PWMOutBits,
     HWREG(ui32Base + PWM_O_ENUPD) = ui32Temp | ui32UpdateValue;
 }
 
+//*****************************************************************************
+//
+//! Prepares a group of PWM generators for frame based updates.
+//!
+//! \param psGroup is a pointer to the group structure to fill in.
+//! \param ui32Base is the base address of the PWM module.
+//! \param ui32GenBits are the PWM generator blocks in the group.  This
+//! parameter must be the logical OR of any of \b PWM_GEN_0_BIT,
+//! \b PWM_GEN_1_BIT, \b PWM_GEN_2_BIT, or \b PWM_GEN_3_BIT.
+//!
+//! This function reads the period and count mode of each generator in the
+//! group and caches them in \e psGroup so that PWMFrameBuild() can compute
+//! register values without touching the hardware.  The generators must
+//! already be configured with PWMGenConfigure() and PWMGenPeriodSet(), and
+//! this function must be called again if either is changed.
+//!
+//! For all outputs of the group to change on the same PWM period, the
+//! generators should be configured with \b PWM_GEN_MODE_GEN_SYNC_GLOBAL and,
+//! if frames carry dead bands, \b PWM_GEN_MODE_DB_SYNC_GLOBAL.  Their time
+//! bases are typically aligned once with PWMSyncTimeBase().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameGroupInit(tPWMFrameGroup *psGroup, uint32_t ui32Base,
+                  uint32_t ui32GenBits)
+{
+    uint32_t ui32Idx, ui32GenBase, ui32Load;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup);
+    ASSERT((ui32Base == PWM0_BASE) || (ui32Base == PWM1_BASE));
+    ASSERT(ui32GenBits && !(ui32GenBits & ~(PWM_GEN_0_BIT | PWM_GEN_1_BIT |
+                                            PWM_GEN_2_BIT | PWM_GEN_3_BIT)));
+
+    psGroup->ui32Base = ui32Base;
+    psGroup->ui32GenBits = ui32GenBits;
+    psGroup->ui32NumGens = 0;
+    psGroup->psTable = 0;
+
+    //
+    // Loop through the selected generators in ascending order.
+    //
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        if(!(ui32GenBits & (1 << ui32Idx)))
+        {
+            continue;
+        }
+
+        //
+        // Compute the generator's base address and read its period.
+        //
+        ui32GenBase = PWM_GEN_BADDR(ui32Base, PWM_GEN_0 + (ui32Idx * 0x40));
+        ui32Load = HWREG(ui32GenBase + PWM_O_X_LOAD);
+
+        psGroup->pui32GenBase[psGroup->ui32NumGens] = ui32GenBase;
+        psGroup->pui16Load[psGroup->ui32NumGens] = ui32Load;
+
+        //
+        // In up/down count mode the pulse width is halved before it is
+        // subtracted from the load value, so a full period of width is the
+        // load value itself.  In down count mode the period is one more than
+        // the load value.
+        //
+        if(HWREG(ui32GenBase + PWM_O_X_CTL) & PWM_X_CTL_MODE)
+        {
+            psGroup->pui32Scale[psGroup->ui32NumGens] = ui32Load;
+            psGroup->pui32Period[psGroup->ui32NumGens] = ui32Load * 2;
+        }
+        else
+        {
+            psGroup->pui32Scale[psGroup->ui32NumGens] = ui32Load + 1;
+            psGroup->pui32Period[psGroup->ui32NumGens] = ui32Load + 1;
+        }
+
+        psGroup->ui32NumGens++;
+    }
+}
+
+//*****************************************************************************
+//
+//! Computes the register values for an update of a group of PWM generators.
+//!
+//! \param psGroup is a pointer to the group, as prepared by
+//! PWMFrameGroupInit().
+//! \param psFrame is a pointer to the frame to fill in.
+//! \param pui16Duty is a pointer to the duty cycles of the outputs, two per
+//! generator (output A then output B) in ascending generator order.
+//! \param pui16DeadBand is a pointer to the dead band of each generator in
+//! ascending generator order, or 0 if the frame should not change the dead
+//! bands.
+//!
+//! This function converts a vector of normalized duty cycles and dead bands
+//! into compare and dead band register values, so that PWMFrameCommit() only
+//! has to store them.  Both duty cycles and dead bands are fractions of the
+//! generator's period in 1.15 fixed point, where \b PWM_FRAME_ONE is the full
+//! period.  Duty cycles that would result in a pulse width at or beyond the
+//! period are limited in the same way as PWMPulseWidthSet() requires, and
+//! dead bands are limited to the 12-bit range of the dead band delay
+//! registers.  A dead band applies to both the rising and falling edge; dead
+//! band mode must already have been enabled with PWMDeadBandEnable().
+//!
+//! This function does not access the hardware and may be called ahead of
+//! time, for example to fill a table for PWMFrameTableStart().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameBuild(const tPWMFrameGroup *psGroup, tPWMFrame *psFrame,
+              const uint16_t *pui16Duty, const uint16_t *pui16DeadBand)
+{
+    uint32_t ui32Idx, ui32Load, ui32Scale, ui32WidthA, ui32WidthB;
+    uint32_t ui32Delay;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup);
+    ASSERT(psFrame);
+    ASSERT(pui16Duty);
+
+    for(ui32Idx = 0; ui32Idx < psGroup->ui32NumGens; ui32Idx++)
+    {
+        ui32Load = psGroup->pui16Load[ui32Idx];
+        ui32Scale = psGroup->pui32Scale[ui32Idx];
+
+        //
+        // Scale the duty cycles to pulse widths in compare counts.
+        //
+        ASSERT(pui16Duty[0] <= PWM_FRAME_ONE);
+        ASSERT(pui16Duty[1] <= PWM_FRAME_ONE);
+        ui32WidthA = (pui16Duty[0] * ui32Scale) >> 15;
+        ui32WidthB = (pui16Duty[1] * ui32Scale) >> 15;
+        pui16Duty += 2;
+
+        //
+        // Make sure the widths are smaller than the load value.
+        //
+        if(ui32WidthA >= ui32Load)
+        {
+            ui32WidthA = ui32Load ? (ui32Load - 1) : 0;
+        }
+        if(ui32WidthB >= ui32Load)
+        {
+            ui32WidthB = ui32Load ? (ui32Load - 1) : 0;
+        }
+
+        //
+        // Compute the compare values.
+        //
+        psFrame->pui16CMPA[ui32Idx] = ui32Load - ui32WidthA;
+        psFrame->pui16CMPB[ui32Idx] = ui32Load - ui32WidthB;
+
+        //
+        // Scale the dead band to PWM clocks, if one was supplied.  The period
+        // may need 17 bits in up/down count mode, so the product is computed
+        // in 64 bits.
+        //
+        if(pui16DeadBand)
+        {
+            ASSERT(pui16DeadBand[ui32Idx] < PWM_FRAME_ONE);
+            ui32Delay = (uint32_t)(((uint64_t)pui16DeadBand[ui32Idx] *
+                                    psGroup->pui32Period[ui32Idx]) >> 15);
+            if(ui32Delay > 4095)
+            {
+                ui32Delay = 4095;
+            }
+            psFrame->pui16DBRise[ui32Idx] = ui32Delay;
+            psFrame->pui16DBFall[ui32Idx] = ui32Delay;
+        }
+    }
+
+    psFrame->bDeadBand = pui16DeadBand ? true : false;
+}
+
+//*****************************************************************************
+//
+//! Applies an update to a group of PWM generators.
+//!
+//! \param psGroup is a pointer to the group, as prepared by
+//! PWMFrameGroupInit().
+//! \param psFrame is a pointer to the frame, as computed by PWMFrameBuild().
+//!
+//! This function stores the precomputed compare (and, if the frame carries
+//! them, dead band) values into every generator of the group and then
+//! requests a single global synchronization of the group.  When the
+//! generators are configured for global synchronization, the new values take
+//! effect together the next time the counters reach zero, so the outputs
+//! never see a mix of old and new values.  No arithmetic is performed, making
+//! this function suitable for high rate control loops.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameCommit(const tPWMFrameGroup *psGroup, const tPWMFrame *psFrame)
+{
+    uint32_t ui32Idx, ui32GenBase;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup);
+    ASSERT(psFrame);
+
+    //
+    // Write the compare values of each generator.
+    //
+    for(ui32Idx = 0; ui32Idx < psGroup->ui32NumGens; ui32Idx++)
+    {
+        ui32GenBase = psGroup->pui32GenBase[ui32Idx];
+        HWREG(ui32GenBase + PWM_O_X_CMPA) = psFrame->pui16CMPA[ui32Idx];
+        HWREG(ui32GenBase + PWM_O_X_CMPB) = psFrame->pui16CMPB[ui32Idx];
+    }
+
+    //
+    // Write the dead band delays, if the frame has them.
+    //
+    if(psFrame->bDeadBand)
+    {
+        for(ui32Idx = 0; ui32Idx < psGroup->ui32NumGens; ui32Idx++)
+        {
+            ui32GenBase = psGroup->pui32GenBase[ui32Idx];
+            HWREG(ui32GenBase + PWM_O_X_DBRISE) =
+                psFrame->pui16DBRise[ui32Idx];
+            HWREG(ui32GenBase + PWM_O_X_DBFALL) =
+                psFrame->pui16DBFall[ui32Idx];
+        }
+    }
+
+    //
+    // Synchronize the updates of all generators in the group.
+    //
+    HWREG(psGroup->ui32Base + PWM_O_CTL) = psGroup->ui32GenBits;
+}
+
+//*****************************************************************************
+//
+//! Starts playing back a table of frames, one per PWM period.
+//!
+//! \param psGroup is a pointer to the group, as prepared by
+//! PWMFrameGroupInit().
+//! \param psTable is a pointer to the table of frames.
+//! \param ui32Size is the number of frames in the table.
+//!
+//! This function commits the first frame of the table and enables the
+//! counter zero interrupt of the first generator of the group.  From then
+//! on, PWMFrameTableIntHandler() must be called from that generator's
+//! interrupt handler, and commits the next frame each period, wrapping back
+//! to the start of the table at its end.  Since a committed frame only takes
+//! effect at the next zero count, each frame is output for exactly one
+//! period provided the interrupt is serviced within the period; a late
+//! interrupt delays the table by one period but never outputs a partially
+//! updated frame.
+//!
+//! The PWM module does not generate uDMA requests, so the table is fed from
+//! the interrupt; because the frames are precomputed with PWMFrameBuild(), the
+//! handler only clears the interrupt and stores the register values.  The
+//! table must remain valid until PWMFrameTableStop() is called.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameTableStart(tPWMFrameGroup *psGroup, const tPWMFrame *psTable,
+                   uint32_t ui32Size)
+{
+    uint32_t ui32GenBase;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup);
+    ASSERT(psGroup->ui32NumGens);
+    ASSERT(psTable);
+    ASSERT(ui32Size);
+
+    //
+    // Commit the first frame.
+    //
+    PWMFrameCommit(psGroup, psTable);
+
+    psGroup->psTable = psTable;
+    psGroup->ui32TableSize = ui32Size;
+    psGroup->ui32TableIndex = (ui32Size > 1) ? 1 : 0;
+
+    //
+    // Clear any stale counter zero interrupt of the first generator and
+    // enable it.
+    //
+    ui32GenBase = psGroup->pui32GenBase[0];
+    HWREG(ui32GenBase + PWM_O_X_ISC) = PWM_X_ISC_INTCNTZERO;
+    HWREG(ui32GenBase + PWM_O_X_INTEN) |= PWM_X_INTEN_INTCNTZERO;
+
+    //
+    // Enable the generator's interrupt in the PWM module.  The generator
+    // interrupt bits match the generator bits, so this is the lowest bit of
+    // the group.
+    //
+    HWREG(psGroup->ui32Base + PWM_O_INTEN) |=
+        psGroup->ui32GenBits & -psGroup->ui32GenBits;
+}
+
+//*****************************************************************************
+//
+//! Stops playing back a table of frames.
+//!
+//! \param psGroup is a pointer to the group.
+//!
+//! This function disables the counter zero interrupt enabled by
+//! PWMFrameTableStart().  The outputs keep the last committed frame.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameTableStop(tPWMFrameGroup *psGroup)
+{
+    uint32_t ui32GenBase;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup);
+
+    //
+    // Disable the counter zero interrupt of the first generator.
+    //
+    ui32GenBase = psGroup->pui32GenBase[0];
+    HWREG(ui32GenBase + PWM_O_X_INTEN) &= ~PWM_X_INTEN_INTCNTZERO;
+    HWREG(ui32GenBase + PWM_O_X_ISC) = PWM_X_ISC_INTCNTZERO;
+
+    psGroup->psTable = 0;
+}
+
+//*****************************************************************************
+//
+//! Handles the PWM interrupt for table playback.
+//!
+//! \param psGroup is a pointer to the group being played back.
+//!
+//! This function must be called from the interrupt handler of the first
+//! generator of the group while table playback is running.  It clears the
+//! counter zero interrupt and commits the next frame of the table.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMFrameTableIntHandler(tPWMFrameGroup *psGroup)
+{
+    uint32_t ui32Index;
+
+    //
+    // Clear the counter zero interrupt.
+    //
+    HWREG(psGroup->pui32GenBase[0] + PWM_O_X_ISC) = PWM_X_ISC_INTCNTZERO;
+
+    //
+    // Ignore the interrupt if playback has been stopped.
+    //
+    if(!psGroup->psTable)
+    {
+        return;
+    }
+
+    //
+    // Commit the next frame and advance through the table.
+    //
+    ui32Index = psGroup->ui32TableIndex;
+    PWMFrameCommit(psGroup, psGroup->psTable + ui32Index);
+    if(++ui32Index == psGroup->ui32TableSize)
+    {
+        ui32Index = 0;
+    }
+    psGroup->ui32TableIndex = ui32Index;
+}
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
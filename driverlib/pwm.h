@@ -242,6 +242,119 @@ extern "C"
 #define PWM_OUTPUT_MODE_SYNC_GLOBAL \
                                 0x00000003 // Updates are globally synchronized
 
+//*****************************************************************************
+//
+// The following values are used for the normalized duty cycles and dead
+// bands passed to PWMFrameBuild().  Values are fractions of the generator's
+// period in 1.15 fixed point, so PWM_FRAME_ONE is the full period.
+//
+//*****************************************************************************
+#define PWM_FRAME_ONE           0x00008000
+#define PWM_FRAME_HALF          0x00004000
+
+//*****************************************************************************
+//
+//! This structure holds the register values for one update of a group of PWM
+//! generators, as computed by PWMFrameBuild().  The arrays are indexed by the
+//! position of the generator within the group.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The compare A register values.
+    //
+    uint16_t pui16CMPA[4];
+
+    //
+    //! The compare B register values.
+    //
+    uint16_t pui16CMPB[4];
+
+    //
+    //! The dead band rising edge delays.
+    //
+    uint16_t pui16DBRise[4];
+
+    //
+    //! The dead band falling edge delays.
+    //
+    uint16_t pui16DBFall[4];
+
+    //
+    //! Indicates that the frame also updates the dead band delays.
+    //
+    bool bDeadBand;
+}
+tPWMFrame;
+
+//*****************************************************************************
+//
+//! This structure describes a set of PWM generators that are updated together
+//! by PWMFrameCommit().  It is filled in by PWMFrameGroupInit() and caches the
+//! generator periods and count modes so that frames can be built without
+//! reading the hardware.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The base address of the PWM module.
+    //
+    uint32_t ui32Base;
+
+    //
+    //! The generators in the group, as a logical OR of \b PWM_GEN_n_BIT
+    //! values.  This is the value written to the global synchronization
+    //! register on each commit.
+    //
+    uint32_t ui32GenBits;
+
+    //
+    //! The number of generators in the group.
+    //
+    uint32_t ui32NumGens;
+
+    //
+    //! The base addresses of the generators in the group, in ascending order.
+    //
+    uint32_t pui32GenBase[4];
+
+    //
+    //! The load register value of each generator.
+    //
+    uint16_t pui16Load[4];
+
+    //
+    //! The number of compare counts corresponding to a full period pulse
+    //! width on each generator, used to scale the duty cycles.
+    //
+    uint32_t pui32Scale[4];
+
+    //
+    //! The number of clocks in one period of each generator, used to scale
+    //! the dead bands.
+    //
+    uint32_t pui32Period[4];
+
+    //
+    //! The table of frames played back by PWMFrameTableIntHandler(), or 0 if
+    //! table playback is not running.
+    //
+    const tPWMFrame *psTable;
+
+    //
+    //! The number of frames in the table.
+    //
+    uint32_t ui32TableSize;
+
+    //
+    //! The index of the next frame to be committed from the table.
+    //
+    uint32_t ui32TableIndex;
+}
+tPWMFrameGroup;
+
 //*****************************************************************************
 //
 // API Function prototypes
@@ -313,6 +426,17 @@ extern uint32_t PWMClockGet(uint32_t ui32Base);
 extern void PWMOutputUpdateMode(uint32_t ui32Base,
                                 uint32_t ui32PWMOutBits,
                                 uint32_t ui32Mode);
+extern void PWMFrameGroupInit(tPWMFrameGroup *psGroup, uint32_t ui32Base,
+                              uint32_t ui32GenBits);
+extern void PWMFrameBuild(const tPWMFrameGroup *psGroup, tPWMFrame *psFrame,
+                          const uint16_t *pui16Duty,
+                          const uint16_t *pui16DeadBand);
+extern void PWMFrameCommit(const tPWMFrameGroup *psGroup,
+                           const tPWMFrame *psFrame);
+extern void PWMFrameTableStart(tPWMFrameGroup *psGroup,
+                               const tPWMFrame *psTable, uint32_t ui32Size);
+extern void PWMFrameTableStop(tPWMFrameGroup *psGroup);
+extern void PWMFrameTableIntHandler(tPWMFrameGroup *psGroup);
 
 //*****************************************************************************
 //
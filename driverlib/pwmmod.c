@@ -0,0 +1,728 @@
+//*****************************************************************************
+//
+// pwmmod.c - Space vector and sine-triangle PWM modulation
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup pwmmod_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_pwm.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/delay.h"
+#include "driverlib/pwm.h"
+#include "driverlib/pwmmod.h"
+
+//*****************************************************************************
+//
+// The value of sin(i * pi / 256) in Q15, evaluated by the compiler with a
+// Taylor series that is accurate to well below one LSB over the first
+// quadrant.
+//
+//*****************************************************************************
+#define _PWMMOD_X(i)            ((i) * 0.012271846303085129)
+#define _PWMMOD_X2(i)           (_PWMMOD_X(i) * _PWMMOD_X(i))
+#define _PWMMOD_SIN(i)                                                        \
+        (int16_t)(_PWMMOD_X(i) *                                              \
+                  (1 - _PWMMOD_X2(i) / 6 *                                    \
+                   (1 - _PWMMOD_X2(i) / 20 *                                  \
+                    (1 - _PWMMOD_X2(i) / 42 *                                 \
+                     (1 - _PWMMOD_X2(i) / 72 *                                \
+                      (1 - _PWMMOD_X2(i) / 110))))) * 32767 + 0.5)
+#define _PWMMOD_SIN4(i)                                                       \
+        _PWMMOD_SIN(i), _PWMMOD_SIN((i) + 1), _PWMMOD_SIN((i) + 2),           \
+        _PWMMOD_SIN((i) + 3)
+#define _PWMMOD_SIN16(i)                                                      \
+        _PWMMOD_SIN4(i), _PWMMOD_SIN4((i) + 4), _PWMMOD_SIN4((i) + 8),        \
+        _PWMMOD_SIN4((i) + 12)
+#define _PWMMOD_SIN64(i)                                                      \
+        _PWMMOD_SIN16(i), _PWMMOD_SIN16((i) + 16), _PWMMOD_SIN16((i) + 32),   \
+        _PWMMOD_SIN16((i) + 48)
+
+//*****************************************************************************
+//
+// The first quadrant of a sine wave in Q15, in 128 steps plus the end point.
+// The table is generated at compile time so that it is always consistent
+// with its resolution and costs no start-up time.
+//
+//*****************************************************************************
+static const int16_t g_pi16PWMModSin[129] =
+{
+    _PWMMOD_SIN64(0), _PWMMOD_SIN64(64), _PWMMOD_SIN(128)
+};
+
+//*****************************************************************************
+//
+// The value of sqrt(3) / 2 in Q15.
+//
+//*****************************************************************************
+#define PWMMOD_SQRT3_2          28378
+
+//*****************************************************************************
+//
+//! \internal
+//! Converts three phase voltages to duty cycles using min-max injection.
+//!
+//! \param i32A is the phase A voltage in Q15 fractions of the DC bus.
+//! \param i32B is the phase B voltage.
+//! \param i32C is the phase C voltage.
+//! \param pui16Duty is a pointer to the three duty cycles.
+//!
+//! Adding the common mode offset -(max + min) / 2 to all three phases
+//! centers the active vectors in the period, which gives the same switching
+//! pattern as conventional space vector modulation without a sector search.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+_PWMModDutyCompute(int32_t i32A, int32_t i32B, int32_t i32C,
+                   uint16_t *pui16Duty)
+{
+    int32_t i32Max, i32Min, i32Offset, i32Duty, i32Idx;
+    int32_t pi32V[3];
+
+    //
+    // Find the common mode offset.
+    //
+    i32Max = (i32A > i32B) ? i32A : i32B;
+    i32Max = (i32C > i32Max) ? i32C : i32Max;
+    i32Min = (i32A < i32B) ? i32A : i32B;
+    i32Min = (i32C < i32Min) ? i32C : i32Min;
+    i32Offset = (PWM_FRAME_ONE / 2) - ((i32Max + i32Min) >> 1);
+
+    //
+    // Offset each phase, limiting it to the period in overmodulation.
+    //
+    pi32V[0] = i32A;
+    pi32V[1] = i32B;
+    pi32V[2] = i32C;
+    for(i32Idx = 0; i32Idx < 3; i32Idx++)
+    {
+        i32Duty = pi32V[i32Idx] + i32Offset;
+        if(i32Duty < 0)
+        {
+            i32Duty = 0;
+        }
+        else if(i32Duty > PWM_FRAME_ONE)
+        {
+            i32Duty = PWM_FRAME_ONE;
+        }
+        pui16Duty[i32Idx] = i32Duty;
+    }
+}
+
+//*****************************************************************************
+//
+//! Computes the sine of a phase angle.
+//!
+//! \param ui32Phase is the phase angle, where 2^32 is one full turn.
+//!
+//! This function looks up the sine of the angle in a quarter wave table and
+//! interpolates linearly between entries.  The result is within three LSBs of
+//! the exact value.
+//!
+//! \return Returns the sine of the angle in Q15.
+//
+//*****************************************************************************
+int16_t
+PWMModSin(uint32_t ui32Phase)
+{
+    uint32_t ui32Pos, ui32Idx, ui32Frac;
+    int32_t i32Value;
+
+    //
+    // Extract the position within the quadrant as a 7-bit table index and a
+    // 10-bit fraction, mirrored in the second and fourth quadrants.
+    //
+    ui32Pos = (ui32Phase >> 13) & 0x1FFFF;
+    if(ui32Phase & 0x40000000)
+    {
+        ui32Pos = 0x1FFFF - ui32Pos;
+    }
+    ui32Idx = ui32Pos >> 10;
+    ui32Frac = ui32Pos & 0x3FF;
+
+    //
+    // Interpolate between the two table entries.
+    //
+    i32Value = g_pi16PWMModSin[ui32Idx];
+    i32Value += (((int32_t)g_pi16PWMModSin[ui32Idx + 1] - i32Value) *
+                 (int32_t)ui32Frac) >> 10;
+
+    //
+    // The second half of the turn is negative.
+    //
+    if(ui32Phase & 0x80000000)
+    {
+        i32Value = -i32Value;
+    }
+
+    return(i32Value);
+}
+
+//*****************************************************************************
+//
+//! Computes space vector modulation duty cycles from a Q15 reference.
+//!
+//! \param i16Alpha is the alpha component of the voltage reference.
+//! \param i16Beta is the beta component of the voltage reference.
+//! \param pui16Duty is a pointer to an array of three values that receives
+//! the duty cycles of phases A, B and C.
+//!
+//! The reference components are Q15 fractions of the DC bus voltage.  The
+//! modulation is linear for reference magnitudes up to 1 / sqrt(3) of the
+//! DC bus (18918); larger references are limited per phase.  The duty cycles
+//! are in the units used by PWMFrameBuild().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModSVM(int16_t i16Alpha, int16_t i16Beta, uint16_t *pui16Duty)
+{
+    int32_t i32Beta, i32Half;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui16Duty);
+
+    //
+    // Inverse Clarke transform into the three phase voltages.
+    //
+    i32Beta = (((int32_t)i16Beta * PWMMOD_SQRT3_2) + 0x4000) >> 15;
+    i32Half = ((int32_t)i16Alpha + 1) >> 1;
+
+    _PWMModDutyCompute(i16Alpha, i32Beta - i32Half, -i32Beta - i32Half,
+                       pui16Duty);
+}
+
+//*****************************************************************************
+//
+//! Computes space vector modulation duty cycles from a floating-point
+//! reference.
+//!
+//! \param fAlpha is the alpha component of the voltage reference.
+//! \param fBeta is the beta component of the voltage reference.
+//! \param pui16Duty is a pointer to an array of three values that receives
+//! the duty cycles of phases A, B and C.
+//!
+//! This function is the single-precision equivalent of PWMModSVM(), with the
+//! reference components given as fractions of the DC bus voltage.  It is
+//! intended for control loops that run in floating point on the FPU, and
+//! avoids a conversion to Q15 before the modulation.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModSVMF(float fAlpha, float fBeta, uint16_t *pui16Duty)
+{
+    float fA, fB, fC, fMax, fMin, fOffset;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(pui16Duty);
+
+    //
+    // Inverse Clarke transform into the three phase voltages.
+    //
+    fA = fAlpha;
+    fB = (fBeta * 0.8660254f) - (fAlpha * 0.5f);
+    fC = -(fBeta * 0.8660254f) - (fAlpha * 0.5f);
+
+    //
+    // Find the common mode offset, scaled to the duty cycle units.
+    //
+    fMax = (fA > fB) ? fA : fB;
+    fMax = (fC > fMax) ? fC : fMax;
+    fMin = (fA < fB) ? fA : fB;
+    fMin = (fC < fMin) ? fC : fMin;
+    fOffset = 0.5f - ((fMax + fMin) * 0.5f);
+
+    //
+    // Convert to duty cycles, limiting them to the period.
+    //
+    fA = (fA + fOffset) * (float)PWM_FRAME_ONE;
+    fB = (fB + fOffset) * (float)PWM_FRAME_ONE;
+    fC = (fC + fOffset) * (float)PWM_FRAME_ONE;
+    pui16Duty[0] = (fA <= 0.0f) ? 0 : ((fA >= (float)PWM_FRAME_ONE) ?
+                                       PWM_FRAME_ONE : (uint16_t)fA);
+    pui16Duty[1] = (fB <= 0.0f) ? 0 : ((fB >= (float)PWM_FRAME_ONE) ?
+                                       PWM_FRAME_ONE : (uint16_t)fB);
+    pui16Duty[2] = (fC <= 0.0f) ? 0 : ((fC >= (float)PWM_FRAME_ONE) ?
+                                       PWM_FRAME_ONE : (uint16_t)fC);
+}
+
+//*****************************************************************************
+//
+//! Computes sine-triangle modulation duty cycles.
+//!
+//! \param ui32Phase is the phase angle of phase A, where 2^32 is one turn.
+//! \param ui16Amplitude is the modulation index in Q15, from 0 to
+//! \b PWM_FRAME_ONE.
+//! \param pui16Duty is a pointer to an array of three values that receives
+//! the duty cycles of phases A, B and C.
+//!
+//! Phases B and C lag phase A by one and two thirds of a turn.  Each duty
+//! cycle is one half plus half the modulation index times the sine of the
+//! phase angle, so a modulation index of \b PWM_FRAME_ONE swings the outputs
+//! over the full period.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModSine(uint32_t ui32Phase, uint16_t ui16Amplitude, uint16_t *pui16Duty)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui16Amplitude <= PWM_FRAME_ONE);
+    ASSERT(pui16Duty);
+
+    pui16Duty[0] = (PWM_FRAME_ONE / 2) +
+                   ((ui16Amplitude * PWMModSin(ui32Phase)) >> 16);
+    pui16Duty[1] = (PWM_FRAME_ONE / 2) +
+                   ((ui16Amplitude * PWMModSin(ui32Phase - 0x55555555)) >>
+                    16);
+    pui16Duty[2] = (PWM_FRAME_ONE / 2) +
+                   ((ui16Amplitude * PWMModSin(ui32Phase - 0xAAAAAAAB)) >>
+                    16);
+}
+
+//*****************************************************************************
+//
+//! Initializes a three phase modulator.
+//!
+//! \param psMod is a pointer to the modulator structure to fill in.
+//! \param psGroup is a pointer to the group of PWM generators to drive, as
+//! prepared by PWMFrameGroupInit().  The group must contain three generators,
+//! which drive phases A, B and C in ascending generator order.
+//! \param ui32Mode is the modulation to perform, which is one of
+//! \b PWMMOD_SVM_Q15, \b PWMMOD_SVM_FLOAT or \b PWMMOD_SINE.
+//!
+//! This function sets a zero reference, so the outputs run at 50% duty cycle
+//! until a reference is set.  Both outputs of each generator are given the
+//! phase's duty cycle; the complementary low-side signal is normally
+//! produced by the generator's dead band unit, enabled with
+//! PWMDeadBandEnable().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModInit(tPWMMod *psMod, const tPWMFrameGroup *psGroup, uint32_t ui32Mode)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psMod);
+    ASSERT(psGroup && (psGroup->ui32NumGens == 3));
+    ASSERT((ui32Mode == PWMMOD_SVM_Q15) || (ui32Mode == PWMMOD_SVM_FLOAT) ||
+           (ui32Mode == PWMMOD_SINE));
+
+    psMod->psGroup = psGroup;
+    psMod->ui32Mode = ui32Mode;
+    psMod->ui32Vector = 0;
+    psMod->fAlpha = 0.0f;
+    psMod->fBeta = 0.0f;
+    psMod->ui16Amplitude = 0;
+    psMod->ui32PhaseStep = 0;
+    psMod->ui32Phase = 0;
+}
+
+//*****************************************************************************
+//
+//! Sets the Q15 space vector reference of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//! \param i16Alpha is the alpha component of the voltage reference.
+//! \param i16Beta is the beta component of the voltage reference.
+//!
+//! This function sets the reference used in \b PWMMOD_SVM_Q15 mode, in the
+//! units described for PWMModSVM().  Both components are stored together, so
+//! the function may be called at any time without the interrupt handler
+//! seeing a mix of old and new components.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModVectorSet(tPWMMod *psMod, int16_t i16Alpha, int16_t i16Beta)
+{
+    psMod->ui32Vector = ((uint32_t)(uint16_t)i16Beta << 16) |
+                        (uint16_t)i16Alpha;
+}
+
+//*****************************************************************************
+//
+//! Sets the floating-point space vector reference of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//! \param fAlpha is the alpha component of the voltage reference.
+//! \param fBeta is the beta component of the voltage reference.
+//!
+//! This function sets the reference used in \b PWMMOD_SVM_FLOAT mode, in the
+//! units described for PWMModSVMF().  The two components are separate stores,
+//! so to avoid the interrupt handler seeing a mix of old and new components
+//! this function should be called from a context that the PWM interrupt
+//! cannot preempt, such as the PWM interrupt handler itself before calling
+//! PWMModIntHandler().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModVectorSetF(tPWMMod *psMod, float fAlpha, float fBeta)
+{
+    psMod->fAlpha = fAlpha;
+    psMod->fBeta = fBeta;
+}
+
+//*****************************************************************************
+//
+//! Sets the sine-triangle reference of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//! \param ui16Amplitude is the modulation index in Q15, from 0 to
+//! \b PWM_FRAME_ONE.
+//! \param ui32PhaseStep is the phase advance per PWM period, where 2^32 is one
+//! output cycle.  PWMMOD_PHASE_STEP() computes it from the output and PWM
+//! frequencies.
+//!
+//! This function sets the reference used in \b PWMMOD_SINE mode.  The phase
+//! of the output is continuous across changes of frequency.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModSineSet(tPWMMod *psMod, uint16_t ui16Amplitude, uint32_t ui32PhaseStep)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui16Amplitude <= PWM_FRAME_ONE);
+
+    psMod->ui16Amplitude = ui16Amplitude;
+    psMod->ui32PhaseStep = ui32PhaseStep;
+}
+
+//*****************************************************************************
+//
+//! Aligns the ADC trigger of a modulator with its PWM period.
+//!
+//! \param psMod is a pointer to the modulator.
+//! \param ui32Trig is the PWM event that triggers the ADC, which is one of
+//! \b PWM_TR_CNT_ZERO, \b PWM_TR_CNT_LOAD, \b PWM_TR_CNT_AU,
+//! \b PWM_TR_CNT_AD, \b PWM_TR_CNT_BU or \b PWM_TR_CNT_BD, or 0 to disable
+//! the trigger.
+//!
+//! This function selects the event of the phase A generator that triggers
+//! the ADC, replacing any trigger previously enabled with
+//! PWMGenIntTrigEnable().  With the generators in up/down count mode,
+//! \b PWM_TR_CNT_ZERO samples in the middle of the zero vector where all
+//! low-side switches conduct, which is where low-side shunt currents are
+//! measured; \b PWM_TR_CNT_LOAD samples in the middle of the other zero
+//! vector.  The ADC sequence must be configured to be triggered by the
+//! generator.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModADCTriggerSet(tPWMMod *psMod, uint32_t ui32Trig)
+{
+    uint32_t ui32Base, ui32Gen;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psMod);
+    ASSERT(!(ui32Trig & ~(PWM_TR_CNT_ZERO | PWM_TR_CNT_LOAD | PWM_TR_CNT_AU |
+                          PWM_TR_CNT_AD | PWM_TR_CNT_BU | PWM_TR_CNT_BD)));
+
+    //
+    // Find the phase A generator.
+    //
+    ui32Base = psMod->psGroup->ui32Base;
+    ui32Gen = psMod->psGroup->pui32GenBase[0] - ui32Base;
+
+    //
+    // Replace the enabled triggers with the requested one.
+    //
+    PWMGenIntTrigDisable(ui32Base, ui32Gen,
+                         PWM_TR_CNT_ZERO | PWM_TR_CNT_LOAD | PWM_TR_CNT_AU |
+                         PWM_TR_CNT_AD | PWM_TR_CNT_BU | PWM_TR_CNT_BD);
+    if(ui32Trig)
+    {
+        PWMGenIntTrigEnable(ui32Base, ui32Gen, ui32Trig);
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts per-period updates of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//!
+//! This function applies the current reference and enables the counter load
+//! interrupt of the phase A generator.  From then on, PWMModIntHandler() must
+//! be called from that generator's interrupt handler.  With the generators in
+//! up/down count mode the load interrupt occurs in the middle of the period,
+//! and the update computed there takes effect at the following zero count,
+//! giving half a period for the computation.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModStart(tPWMMod *psMod)
+{
+    uint32_t ui32GenBase;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psMod);
+
+    //
+    // Apply the current reference.
+    //
+    PWMModIntHandler(psMod);
+
+    //
+    // Enable the counter load interrupt of the phase A generator.  The
+    // generator interrupt bits in the PWM module match the generator bits.
+    //
+    ui32GenBase = psMod->psGroup->pui32GenBase[0];
+    HWREG(ui32GenBase + PWM_O_X_ISC) = PWM_X_ISC_INTCNTLOAD;
+    HWREG(ui32GenBase + PWM_O_X_INTEN) |= PWM_X_INTEN_INTCNTLOAD;
+    HWREG(psMod->psGroup->ui32Base + PWM_O_INTEN) |=
+        psMod->psGroup->ui32GenBits & -psMod->psGroup->ui32GenBits;
+}
+
+//*****************************************************************************
+//
+//! Stops per-period updates of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//!
+//! This function disables the counter load interrupt enabled by
+//! PWMModStart().  The outputs keep the last applied duty cycles.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModStop(tPWMMod *psMod)
+{
+    uint32_t ui32GenBase;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psMod);
+
+    ui32GenBase = psMod->psGroup->pui32GenBase[0];
+    HWREG(ui32GenBase + PWM_O_X_INTEN) &= ~PWM_X_INTEN_INTCNTLOAD;
+    HWREG(ui32GenBase + PWM_O_X_ISC) = PWM_X_ISC_INTCNTLOAD;
+}
+
+//*****************************************************************************
+//
+//! Handles the PWM interrupt of a modulator.
+//!
+//! \param psMod is a pointer to the modulator.
+//!
+//! This function must be called from the interrupt handler of the phase A
+//! generator once per PWM period.  It clears the counter load interrupt,
+//! computes the duty cycles for the current reference and commits them to
+//! all three generators with PWMFrameCommit().  In \b PWMMOD_SINE mode, the
+//! phase is then advanced by one step.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModIntHandler(tPWMMod *psMod)
+{
+    uint16_t pui16Phase[3], pui16Duty[6];
+    uint32_t ui32Vector, ui32Idx;
+    tPWMFrame sFrame;
+
+    //
+    // Clear the counter load interrupt.
+    //
+    HWREG(psMod->psGroup->pui32GenBase[0] + PWM_O_X_ISC) =
+        PWM_X_ISC_INTCNTLOAD;
+
+    //
+    // Compute the duty cycles of the three phases.
+    //
+    if(psMod->ui32Mode == PWMMOD_SVM_Q15)
+    {
+        ui32Vector = psMod->ui32Vector;
+        PWMModSVM((int16_t)(ui32Vector & 0xFFFF), (int16_t)(ui32Vector >> 16),
+                  pui16Phase);
+    }
+    else if(psMod->ui32Mode == PWMMOD_SVM_FLOAT)
+    {
+        PWMModSVMF(psMod->fAlpha, psMod->fBeta, pui16Phase);
+    }
+    else
+    {
+        PWMModSine(psMod->ui32Phase, psMod->ui16Amplitude, pui16Phase);
+        psMod->ui32Phase += psMod->ui32PhaseStep;
+    }
+
+    //
+    // Give both outputs of each generator the phase's duty cycle and commit
+    // them.
+    //
+    for(ui32Idx = 0; ui32Idx < 3; ui32Idx++)
+    {
+        pui16Duty[ui32Idx * 2] = pui16Phase[ui32Idx];
+        pui16Duty[(ui32Idx * 2) + 1] = pui16Phase[ui32Idx];
+    }
+    PWMFrameBuild(psMod->psGroup, &sFrame, pui16Duty, 0);
+    PWMFrameCommit(psMod->psGroup, &sFrame);
+}
+
+//*****************************************************************************
+//
+//! Measures the cost of a PWM update for each modulation.
+//!
+//! \param psGroup is a pointer to a group of three PWM generators, as
+//! prepared by PWMFrameGroupInit(), used to time PWMFrameBuild().
+//! \param psResult is a pointer to the structure that receives the results.
+//!
+//! This function times PWMModSVM(), PWMModSVMF(), PWMModSine() and
+//! PWMFrameBuild() with DelayCountGet() over a sweep of references, and
+//! reports the average number of cycles each takes per update.  The hardware
+//! is not written, so the function may be called while the generators are
+//! running.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PWMModBenchmark(const tPWMFrameGroup *psGroup, tPWMModBenchmark *psResult)
+{
+    uint16_t pui16Phase[3], pui16Duty[6];
+    uint32_t ui32Start, ui32Idx;
+    tPWMFrame sFrame;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psGroup && (psGroup->ui32NumGens == 3));
+    ASSERT(psResult);
+
+    //
+    // Make sure the cycle counter is running.
+    //
+    DelayInit();
+
+    //
+    // Time the Q15 space vector modulation over a sweep of references within
+    // the linear range.
+    //
+    ui32Start = DelayCountGet();
+    for(ui32Idx = 0; ui32Idx < PWMMOD_BENCHMARK_LOOPS; ui32Idx++)
+    {
+        PWMModSVM((int16_t)((ui32Idx * 128) - 16384), 8192, pui16Phase);
+    }
+    psResult->ui32SVMQ15Cycles =
+        (DelayCountGet() - ui32Start) / PWMMOD_BENCHMARK_LOOPS;
+
+    //
+    // Time the floating-point space vector modulation.
+    //
+    ui32Start = DelayCountGet();
+    for(ui32Idx = 0; ui32Idx < PWMMOD_BENCHMARK_LOOPS; ui32Idx++)
+    {
+        PWMModSVMF(((float)ui32Idx * (1.0f / 256.0f)) - 0.5f, 0.25f,
+                   pui16Phase);
+    }
+    psResult->ui32SVMFloatCycles =
+        (DelayCountGet() - ui32Start) / PWMMOD_BENCHMARK_LOOPS;
+
+    //
+    // Time the sine-triangle modulation.
+    //
+    ui32Start = DelayCountGet();
+    for(ui32Idx = 0; ui32Idx < PWMMOD_BENCHMARK_LOOPS; ui32Idx++)
+    {
+        PWMModSine(ui32Idx * 0x01000193, PWM_FRAME_ONE, pui16Phase);
+    }
+    psResult->ui32SineCycles =
+        (DelayCountGet() - ui32Start) / PWMMOD_BENCHMARK_LOOPS;
+
+    //
+    // Time the conversion of the duty cycles to register values.
+    //
+    for(ui32Idx = 0; ui32Idx < 6; ui32Idx++)
+    {
+        pui16Duty[ui32Idx] = pui16Phase[ui32Idx / 2];
+    }
+    ui32Start = DelayCountGet();
+    for(ui32Idx = 0; ui32Idx < PWMMOD_BENCHMARK_LOOPS; ui32Idx++)
+    {
+        pui16Duty[0] = ui32Idx << 7;
+        PWMFrameBuild(psGroup, &sFrame, pui16Duty, 0);
+    }
+    psResult->ui32BuildCycles =
+        (DelayCountGet() - ui32Start) / PWMMOD_BENCHMARK_LOOPS;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
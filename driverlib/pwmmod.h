@@ -0,0 +1,202 @@
+//*****************************************************************************
+//
+// pwmmod.h - Prototypes for the PWM modulation module
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_PWMMOD_H__
+#define __DRIVERLIB_PWMMOD_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The following values are passed to PWMModInit() as the ui32Mode parameter
+// and select the modulation performed on each PWM period.
+//
+//*****************************************************************************
+#define PWMMOD_SVM_Q15          0x00000000  // Space vector, Q15 reference
+#define PWMMOD_SVM_FLOAT        0x00000001  // Space vector, float reference
+#define PWMMOD_SINE             0x00000002  // Sine-triangle
+
+//*****************************************************************************
+//
+// The number of iterations over which PWMModBenchmark() averages each path.
+//
+//*****************************************************************************
+#define PWMMOD_BENCHMARK_LOOPS  256
+
+//*****************************************************************************
+//
+//! Computes the phase step passed to PWMModSineSet() for an output frequency
+//! of \e ui32Freq when PWMModIntHandler() is called at \e ui32PWMFreq.  Both
+//! frequencies are in the same unit.
+//
+//*****************************************************************************
+#define PWMMOD_PHASE_STEP(ui32Freq, ui32PWMFreq)                              \
+        ((uint32_t)(((uint64_t)(ui32Freq) << 32) / (ui32PWMFreq)))
+
+//*****************************************************************************
+//
+//! This structure describes a three phase modulator driving a group of three
+//! PWM generators, one per phase.  It is filled in by PWMModInit() and the
+//! reference is changed with PWMModVectorSet(), PWMModVectorSetF() or
+//! PWMModSineSet().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The group of PWM generators driven by the modulator, as prepared by
+    //! PWMFrameGroupInit().  The group must contain three generators.
+    //
+    const tPWMFrameGroup *psGroup;
+
+    //
+    //! The modulation performed, which is one of \b PWMMOD_SVM_Q15,
+    //! \b PWMMOD_SVM_FLOAT or \b PWMMOD_SINE.
+    //
+    uint32_t ui32Mode;
+
+    //
+    //! The Q15 space vector reference, with alpha in the lower and beta in
+    //! the upper half word so that both are updated by a single store.
+    //
+    volatile uint32_t ui32Vector;
+
+    //
+    //! The floating-point space vector reference, alpha component.
+    //
+    volatile float fAlpha;
+
+    //
+    //! The floating-point space vector reference, beta component.
+    //
+    volatile float fBeta;
+
+    //
+    //! The sine-triangle modulation index in Q15.
+    //
+    volatile uint16_t ui16Amplitude;
+
+    //
+    //! The sine-triangle phase advance per PWM period, where 2^32 is one
+    //! output cycle.
+    //
+    volatile uint32_t ui32PhaseStep;
+
+    //
+    //! The sine-triangle phase of the next period.
+    //
+    uint32_t ui32Phase;
+}
+tPWMMod;
+
+//*****************************************************************************
+//
+//! This structure holds the results of PWMModBenchmark().  All counts are
+//! processor cycles per PWM update, averaged over
+//! \b PWMMOD_BENCHMARK_LOOPS iterations.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The cycles taken by PWMModSVM().
+    //
+    uint32_t ui32SVMQ15Cycles;
+
+    //
+    //! The cycles taken by PWMModSVMF().
+    //
+    uint32_t ui32SVMFloatCycles;
+
+    //
+    //! The cycles taken by PWMModSine().
+    //
+    uint32_t ui32SineCycles;
+
+    //
+    //! The cycles taken by PWMFrameBuild() for the three phases.
+    //
+    uint32_t ui32BuildCycles;
+}
+tPWMModBenchmark;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern int16_t PWMModSin(uint32_t ui32Phase);
+extern void PWMModSVM(int16_t i16Alpha, int16_t i16Beta,
+                      uint16_t *pui16Duty);
+extern void PWMModSVMF(float fAlpha, float fBeta, uint16_t *pui16Duty);
+extern void PWMModSine(uint32_t ui32Phase, uint16_t ui16Amplitude,
+                       uint16_t *pui16Duty);
+extern void PWMModInit(tPWMMod *psMod, const tPWMFrameGroup *psGroup,
+                       uint32_t ui32Mode);
+extern void PWMModVectorSet(tPWMMod *psMod, int16_t i16Alpha,
+                            int16_t i16Beta);
+extern void PWMModVectorSetF(tPWMMod *psMod, float fAlpha, float fBeta);
+extern void PWMModSineSet(tPWMMod *psMod, uint16_t ui16Amplitude,
+                          uint32_t ui32PhaseStep);
+extern void PWMModADCTriggerSet(tPWMMod *psMod, uint32_t ui32Trig);
+extern void PWMModStart(tPWMMod *psMod);
+extern void PWMModStop(tPWMMod *psMod);
+extern void PWMModIntHandler(tPWMMod *psMod);
+extern void PWMModBenchmark(const tPWMFrameGroup *psGroup,
+                            tPWMModBenchmark *psResult);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_PWMMOD_H__
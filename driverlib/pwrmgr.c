@@ -0,0 +1,420 @@
+//*****************************************************************************
+//
+// pwrmgr.c - Reference counted peripheral power manager.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup pwrmgr_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/atomic.h"
+#include "driverlib/debug.h"
+#include "driverlib/pwrmgr.h"
+#include "driverlib/sysctl.h"
+
+//*****************************************************************************
+//
+// The number of distinct peripherals that can be managed.  This may be
+// overridden from the compiler command line.
+//
+//*****************************************************************************
+#ifndef PWRMGR_MAX_PERIPHS
+#define PWRMGR_MAX_PERIPHS      32
+#endif
+
+//*****************************************************************************
+//
+// The state kept for each managed peripheral.  An entry is claimed by the
+// first PwrMgrAcquire() of a peripheral and is kept so that its statistics
+// survive the peripheral being turned off.  bReady is set once the
+// peripheral has been seen to be ready after its run mode clock was turned
+// on.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Peripheral;
+    uint16_t ui16Run;
+    uint16_t ui16Sleep;
+    uint16_t ui16DeepSleep;
+    volatile bool bReady;
+    uint32_t ui32Enables;
+    uint32_t ui32Start;
+    uint64_t ui64OnTime;
+}
+tPwrMgrEntry;
+
+static tPwrMgrEntry g_psPwrMgrEntries[PWRMGR_MAX_PERIPHS];
+static uint32_t g_ui32PwrMgrNumEntries;
+
+//*****************************************************************************
+//
+// The time base used for the on-time statistics.
+//
+//*****************************************************************************
+static uint32_t (*g_pfnPwrMgrTimeGet)(void);
+
+//*****************************************************************************
+//
+// Finds the entry of a peripheral, optionally claiming a free entry if it
+// has none.  Must be called inside a critical section.
+//
+//*****************************************************************************
+static tPwrMgrEntry *
+_PwrMgrEntryGet(uint32_t ui32Peripheral, bool bCreate)
+{
+    tPwrMgrEntry *psEntry;
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < g_ui32PwrMgrNumEntries; ui32Idx++)
+    {
+        if(g_psPwrMgrEntries[ui32Idx].ui32Peripheral == ui32Peripheral)
+        {
+            return(&g_psPwrMgrEntries[ui32Idx]);
+        }
+    }
+
+    if(!bCreate || (g_ui32PwrMgrNumEntries == PWRMGR_MAX_PERIPHS))
+    {
+        return(0);
+    }
+
+    psEntry = &g_psPwrMgrEntries[g_ui32PwrMgrNumEntries++];
+    psEntry->ui32Peripheral = ui32Peripheral;
+    psEntry->ui16Run = 0;
+    psEntry->ui16Sleep = 0;
+    psEntry->ui16DeepSleep = 0;
+    psEntry->bReady = false;
+    psEntry->ui32Enables = 0;
+    psEntry->ui32Start = 0;
+    psEntry->ui64OnTime = 0;
+
+    return(psEntry);
+}
+
+//*****************************************************************************
+//
+// Adds the time since the last checkpoint to the on-time of a peripheral
+// whose run mode clock is on.
+//
+//*****************************************************************************
+static void
+_PwrMgrOnTimeUpdate(tPwrMgrEntry *psEntry)
+{
+    uint32_t ui32Now;
+
+    if(g_pfnPwrMgrTimeGet && psEntry->ui16Run)
+    {
+        ui32Now = g_pfnPwrMgrTimeGet();
+        psEntry->ui64OnTime += ui32Now - psEntry->ui32Start;
+        psEntry->ui32Start = ui32Now;
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes the peripheral power manager.
+//!
+//! \param pfnTimeGet is a function that returns a free-running 32-bit time
+//! stamp, or 0 if on-time statistics are not required.
+//!
+//! This function resets the reference counts and statistics and enables
+//! peripheral clock gating with SysCtlPeripheralClockGating(), so that in
+//! sleep and deep-sleep modes only the peripherals that have been acquired
+//! for those modes are clocked.  Any peripheral that must keep running in
+//! sleep or deep-sleep mode must therefore be acquired for that mode,
+//! including peripherals that are otherwise managed directly with the
+//! SysCtlPeripheral functions.
+//!
+//! The time stamp function may use any unit, for example DelayCountGet() for
+//! system clock cycles or a millisecond tick counter; the on-time statistics
+//! are reported in the same unit.  An on period longer than the wrap period
+//! of the time stamp is only counted correctly if PwrMgrStatsGet() is called
+//! for the peripheral at least once per wrap period.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PwrMgrInit(uint32_t (*pfnTimeGet)(void))
+{
+    g_pfnPwrMgrTimeGet = pfnTimeGet;
+    g_ui32PwrMgrNumEntries = 0;
+
+    SysCtlPeripheralClockGating(true);
+}
+
+//*****************************************************************************
+//
+//! Acquires the clocks of a peripheral.
+//!
+//! \param ui32Peripheral is the peripheral to acquire, as passed to
+//! SysCtlPeripheralEnable().
+//! \param ui32Modes is the logical OR of the modes in which the peripheral
+//! must be clocked; \b PWRMGR_RUN, \b PWRMGR_SLEEP and \b PWRMGR_DEEPSLEEP.
+//!
+//! This function takes a reference on the clock of \e ui32Peripheral in
+//! each of the given modes.  A clock is turned on when its first reference
+//! is taken.  For the run mode clock, the function then waits until
+//! SysCtlPeripheralReady() reports that the peripheral can be accessed; an
+//! acquire that finds the clock already on also waits if the peripheral has
+//! not yet been seen to be ready, for example when it interrupts the first
+//! acquire.  Once the peripheral is ready, acquiring it does not touch the
+//! hardware.
+//!
+//! Each call must be balanced by a call to PwrMgrRelease() with the same
+//! modes.  This function may be called from interrupt context, although an
+//! acquire of the run mode clock may wait for the peripheral to become
+//! ready.  The reference counts are protected with AtomicEnter(), so it must
+//! not be called from a handler above the critical section ceiling.
+//!
+//! \return Returns \b true if the peripheral was acquired, or \b false if
+//! the table of managed peripherals is full or a reference count would
+//! overflow.
+//
+//*****************************************************************************
+bool
+PwrMgrAcquire(uint32_t ui32Peripheral, uint32_t ui32Modes)
+{
+    tPwrMgrEntry *psEntry;
+    uint32_t ui32Key;
+    bool bWait;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Modes != 0);
+    ASSERT((ui32Modes & ~(PWRMGR_RUN | PWRMGR_SLEEP |
+                          PWRMGR_DEEPSLEEP)) == 0);
+
+    bWait = false;
+    ui32Key = AtomicEnter();
+
+    psEntry = _PwrMgrEntryGet(ui32Peripheral, true);
+    if(psEntry == 0)
+    {
+        AtomicExit(ui32Key);
+        return(false);
+    }
+
+    //
+    // Take no references at all if any of the counts is full.
+    //
+    if(((ui32Modes & PWRMGR_RUN) && (psEntry->ui16Run == 0xffff)) ||
+       ((ui32Modes & PWRMGR_SLEEP) && (psEntry->ui16Sleep == 0xffff)) ||
+       ((ui32Modes & PWRMGR_DEEPSLEEP) && (psEntry->ui16DeepSleep == 0xffff)))
+    {
+        AtomicExit(ui32Key);
+        return(false);
+    }
+
+    if(ui32Modes & PWRMGR_RUN)
+    {
+        if(psEntry->ui16Run++ == 0)
+        {
+            SysCtlPeripheralEnable(ui32Peripheral);
+            psEntry->bReady = false;
+            psEntry->ui32Enables++;
+            if(g_pfnPwrMgrTimeGet)
+            {
+                psEntry->ui32Start = g_pfnPwrMgrTimeGet();
+            }
+        }
+        bWait = !psEntry->bReady;
+    }
+
+    if(ui32Modes & PWRMGR_SLEEP)
+    {
+        if(psEntry->ui16Sleep++ == 0)
+        {
+            SysCtlPeripheralSleepEnable(ui32Peripheral);
+        }
+    }
+
+    if(ui32Modes & PWRMGR_DEEPSLEEP)
+    {
+        if(psEntry->ui16DeepSleep++ == 0)
+        {
+            SysCtlPeripheralDeepSleepEnable(ui32Peripheral);
+        }
+    }
+
+    AtomicExit(ui32Key);
+
+    //
+    // Wait for a peripheral that has just been turned on to come out of
+    // reset.  This is done outside the critical section.  The reference
+    // taken above keeps the clock on, so the peripheral stays ready.
+    //
+    if(bWait)
+    {
+        while(!SysCtlPeripheralReady(ui32Peripheral))
+        {
+        }
+        psEntry->bReady = true;
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Releases the clocks of a peripheral.
+//!
+//! \param ui32Peripheral is the peripheral to release.
+//! \param ui32Modes is the logical OR of the modes to release, as passed to
+//! PwrMgrAcquire().
+//!
+//! This function drops a reference on the clock of \e ui32Peripheral in
+//! each of the given modes, and turns a clock off when its last reference is
+//! dropped.  The peripheral keeps its register contents while its run mode
+//! clock is off, but cannot be accessed.
+//!
+//! This function may be called from interrupt context at or below the
+//! critical section ceiling set with AtomicCeilingSet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+PwrMgrRelease(uint32_t ui32Peripheral, uint32_t ui32Modes)
+{
+    tPwrMgrEntry *psEntry;
+    uint32_t ui32Key;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Modes != 0);
+    ASSERT((ui32Modes & ~(PWRMGR_RUN | PWRMGR_SLEEP |
+                          PWRMGR_DEEPSLEEP)) == 0);
+
+    ui32Key = AtomicEnter();
+
+    psEntry = _PwrMgrEntryGet(ui32Peripheral, false);
+    ASSERT(psEntry != 0);
+
+    if(psEntry)
+    {
+        if(ui32Modes & PWRMGR_RUN)
+        {
+            ASSERT(psEntry->ui16Run != 0);
+            if(psEntry->ui16Run == 1)
+            {
+                _PwrMgrOnTimeUpdate(psEntry);
+                SysCtlPeripheralDisable(ui32Peripheral);
+            }
+            psEntry->ui16Run--;
+        }
+
+        if(ui32Modes & PWRMGR_SLEEP)
+        {
+            ASSERT(psEntry->ui16Sleep != 0);
+            if(--psEntry->ui16Sleep == 0)
+            {
+                SysCtlPeripheralSleepDisable(ui32Peripheral);
+            }
+        }
+
+        if(ui32Modes & PWRMGR_DEEPSLEEP)
+        {
+            ASSERT(psEntry->ui16DeepSleep != 0);
+            if(--psEntry->ui16DeepSleep == 0)
+            {
+                SysCtlPeripheralDeepSleepDisable(ui32Peripheral);
+            }
+        }
+    }
+
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Gets the state and usage statistics of a peripheral.
+//!
+//! \param ui32Peripheral is the peripheral to query.
+//! \param psStats is a pointer to the structure that receives the state.
+//!
+//! This function returns the reference counts of \e ui32Peripheral, the
+//! number of times its run mode clock has been turned on, and the total time
+//! the run mode clock has been on, including the current on period.
+//!
+//! \return Returns \b true if the peripheral has been acquired at least once
+//! since PwrMgrInit() or \b false if it is not known to the power manager.
+//
+//*****************************************************************************
+bool
+PwrMgrStatsGet(uint32_t ui32Peripheral, tPwrMgrStats *psStats)
+{
+    tPwrMgrEntry *psEntry;
+    uint32_t ui32Key;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psStats != 0);
+
+    ui32Key = AtomicEnter();
+
+    psEntry = _PwrMgrEntryGet(ui32Peripheral, false);
+    if(psEntry)
+    {
+        _PwrMgrOnTimeUpdate(psEntry);
+        psStats->ui32RunCount = psEntry->ui16Run;
+        psStats->ui32SleepCount = psEntry->ui16Sleep;
+        psStats->ui32DeepSleepCount = psEntry->ui16DeepSleep;
+        psStats->ui32EnableCount = psEntry->ui32Enables;
+        psStats->ui64OnTime = psEntry->ui64OnTime;
+    }
+
+    AtomicExit(ui32Key);
+
+    return(psEntry != 0);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,119 @@
+//*****************************************************************************
+//
+// pwrmgr.h - Prototypes for the peripheral power manager.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_PWRMGR_H__
+#define __DRIVERLIB_PWRMGR_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that can be passed to PwrMgrAcquire() and PwrMgrRelease() as the
+// ui32Modes parameter.
+//
+//*****************************************************************************
+#define PWRMGR_RUN              0x00000001  // Clock in run mode
+#define PWRMGR_SLEEP            0x00000002  // Clock in sleep mode
+#define PWRMGR_DEEPSLEEP        0x00000004  // Clock in deep-sleep mode
+
+//*****************************************************************************
+//
+//! This structure holds the state and usage statistics of one peripheral,
+//! as returned by PwrMgrStatsGet().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of users holding the run mode clock.
+    //
+    uint32_t ui32RunCount;
+
+    //
+    //! The number of users holding the sleep mode clock.
+    //
+    uint32_t ui32SleepCount;
+
+    //
+    //! The number of users holding the deep-sleep mode clock.
+    //
+    uint32_t ui32DeepSleepCount;
+
+    //
+    //! The number of times the run mode clock has been turned on.
+    //
+    uint32_t ui32EnableCount;
+
+    //
+    //! The total time the run mode clock has been on, in the units of the
+    //! time base passed to PwrMgrInit().
+    //
+    uint64_t ui64OnTime;
+}
+tPwrMgrStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void PwrMgrInit(uint32_t (*pfnTimeGet)(void));
+extern bool PwrMgrAcquire(uint32_t ui32Peripheral, uint32_t ui32Modes);
+extern void PwrMgrRelease(uint32_t ui32Peripheral, uint32_t ui32Modes);
+extern bool PwrMgrStatsGet(uint32_t ui32Peripheral, tPwrMgrStats *psStats);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_PWRMGR_H__
@@ -0,0 +1,393 @@
+//*****************************************************************************
+//
+// qeiest.c - QEI velocity and position estimator
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup qeiest_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_qei.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/timercap.h"
+#include "driverlib/qeiest.h"
+
+//*****************************************************************************
+//
+// The number of intervals read from the capture engine at a time.
+//
+//*****************************************************************************
+#define QEIEST_READ_SIZE        16
+
+//*****************************************************************************
+//
+// The observer error, in counts, beyond which the observed position is reset
+// to the measured position rather than tracked.
+//
+//*****************************************************************************
+#define QEIEST_RESYNC           4
+
+//*****************************************************************************
+//
+//! \internal
+//! Multiplies a rate by a time in timer clocks, avoiding overflow of the
+//! intermediate product.
+//
+//*****************************************************************************
+static int64_t
+_QEIEstScale(int64_t i64Rate, uint32_t ui32Elapsed, uint32_t ui32Clock)
+{
+    return(((i64Rate / ui32Clock) * ui32Elapsed) +
+           (((i64Rate % ui32Clock) * ui32Elapsed) / ui32Clock));
+}
+
+//*****************************************************************************
+//
+//! Starts an encoder estimator.
+//!
+//! \param psEst is a pointer to the estimator to start.
+//!
+//! This function samples the QEI position and the capture timer, and sets
+//! the velocity to zero and the observed position to the QEI position.  The
+//! QEI must already be configured and enabled, and the capture engine
+//! started on a timer pin wired to the encoder's channel A, which is
+//! normally the same signal as the QEI's PhA input routed to a second pin.
+//!
+//! QEIEstUpdate() must then be called periodically, typically at the rate of
+//! the control loop.  The interval between calls must be shorter than the
+//! range of the capture timer, and short enough for the capture engine's
+//! ring not to overflow.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+QEIEstStart(tQEIEst *psEst)
+{
+    uint32_t pui32Intervals[QEIEST_READ_SIZE];
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psEst != 0);
+    ASSERT(psEst->psCap != 0);
+    ASSERT(psEst->ui32CountsPerEdge != 0);
+    ASSERT(psEst->ui32Clock != 0);
+
+    //
+    // Drop any edges captured before now.
+    //
+    while(TimerCapRead(psEst->psCap, pui32Intervals, QEIEST_READ_SIZE))
+    {
+    }
+
+    psEst->ui32QEIPos = HWREG(psEst->ui32QEIBase + QEI_O_POS);
+    psEst->ui32QEIRange = HWREG(psEst->ui32QEIBase + QEI_O_MAXPOS) + 1;
+    psEst->ui32Time = TimerCapTimeGet(psEst->psCap);
+    psEst->ui32SinceEdge = TimerCapMaskGet(psEst->psCap);
+    psEst->i64Count = psEst->ui32QEIPos;
+    psEst->i64Position = (psEst->i64Count << 16) + 0x8000;
+    psEst->i32Velocity = 0;
+    psEst->i32Integral = 0;
+}
+
+//*****************************************************************************
+//
+//! Updates the velocity and position estimates of an encoder.
+//!
+//! \param psEst is a pointer to the estimator.
+//!
+//! This function measures the velocity and advances the position observer.
+//!
+//! The velocity is measured over whole edge intervals when possible: the
+//! number of edges captured since the last update is divided by the time
+//! between the last edge seen by the previous update and the last edge seen
+//! by this one.  At low speed this is a period measurement with the
+//! resolution of the capture timer, and at high speed it averages over all
+//! edges in the update, so there is no quantization to whole counts per
+//! sample and no aliasing.  If no edge was captured, the velocity is limited
+//! to one edge over the time since the last edge, so that it decays smoothly
+//! to zero when the encoder stops, and is zero after \e ui32Timeout or when
+//! the QEI counts against the direction of travel.  When the QEI count does
+//! not agree with the captured edges, because the direction reversed or
+//! edges were lost, the velocity is measured from the change of the QEI
+//! count over the update interval instead.
+//!
+//! The observer is a phase-locked loop that tracks the QEI count with the
+//! measured velocity as feed-forward, and interpolates the position between
+//! counts.
+//!
+//! This function must not be called concurrently with itself for the same
+//! estimator.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+QEIEstUpdate(tQEIEst *psEst)
+{
+    uint32_t pui32Intervals[QEIEST_READ_SIZE];
+    uint32_t ui32Mask, ui32Now, ui32Elapsed, ui32Edges, ui32Read, ui32Idx;
+    uint32_t ui32Pos, ui32Last, ui32Timeout, ui32Expected, ui32Counts;
+    uint64_t ui64Sum;
+    int64_t i64Bound, i64Error;
+    int32_t i32Delta, i32Velocity, i32Kp, i32Ki;
+    bool bPrimed;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psEst != 0);
+
+    ui32Mask = TimerCapMaskGet(psEst->psCap);
+
+    //
+    // Consume the edges captured since the last update.
+    //
+    ui32Edges = 0;
+    ui64Sum = 0;
+    do
+    {
+        ui32Read = TimerCapRead(psEst->psCap, pui32Intervals,
+                                QEIEST_READ_SIZE);
+        for(ui32Idx = 0; ui32Idx < ui32Read; ui32Idx++)
+        {
+            ui64Sum += pui32Intervals[ui32Idx];
+        }
+        ui32Edges += ui32Read;
+    }
+    while(ui32Read == QEIEST_READ_SIZE);
+
+    //
+    // Read the QEI count after the edges, so that it includes all of them,
+    // and the timer after that, so that no consumed edge is in the future.
+    //
+    ui32Pos = HWREG(psEst->ui32QEIBase + QEI_O_POS);
+    ui32Now = TimerCapTimeGet(psEst->psCap);
+    ui32Elapsed = (psEst->ui32Time - ui32Now) & ui32Mask;
+    psEst->ui32Time = ui32Now;
+
+    //
+    // Extend the QEI count past its maximum position, taking the shortest
+    // way around the counter.
+    //
+    i32Delta = (int32_t)(ui32Pos - psEst->ui32QEIPos);
+    if(i32Delta > (int32_t)(psEst->ui32QEIRange / 2))
+    {
+        i32Delta -= psEst->ui32QEIRange;
+    }
+    else if(i32Delta < -(int32_t)(psEst->ui32QEIRange / 2))
+    {
+        i32Delta += psEst->ui32QEIRange;
+    }
+    psEst->ui32QEIPos = ui32Pos;
+    psEst->i64Count += i32Delta;
+    ui32Counts = (i32Delta < 0) ? -i32Delta : i32Delta;
+
+    if(ui32Elapsed == 0)
+    {
+        return;
+    }
+
+    //
+    // Measure the velocity.
+    //
+    ui32Expected = ui32Edges * psEst->ui32CountsPerEdge;
+    bPrimed = TimerCapLastGet(psEst->psCap, &ui32Last);
+    i32Velocity = psEst->i32Velocity;
+    if(ui32Edges && bPrimed && ui64Sum &&
+       ((ui32Counts + psEst->ui32CountsPerEdge) > ui32Expected) &&
+       (ui32Counts < (ui32Expected + (2 * psEst->ui32CountsPerEdge))))
+    {
+        //
+        // All counts were in one direction and match the captured edges, so
+        // use the time spanned by the edges.
+        //
+        i32Velocity = (int32_t)((((uint64_t)ui32Expected *
+                                  psEst->ui32Clock) << 8) / ui64Sum);
+        if(i32Delta < 0)
+        {
+            i32Velocity = -i32Velocity;
+        }
+    }
+    else if(ui32Edges)
+    {
+        //
+        // Fall back to the change of count over the update interval.
+        //
+        i32Velocity = (int32_t)((((int64_t)i32Delta * psEst->ui32Clock) *
+                                 256) / ui32Elapsed);
+    }
+    else
+    {
+        //
+        // No edge was seen, so the encoder is at most one edge away from the
+        // last one.  A count against the direction of travel means that it
+        // has reversed at a speed too low to measure yet.
+        //
+        if(psEst->ui32SinceEdge < (ui32Mask - ui32Elapsed))
+        {
+            psEst->ui32SinceEdge += ui32Elapsed;
+        }
+        else
+        {
+            psEst->ui32SinceEdge = ui32Mask;
+        }
+        ui32Timeout = psEst->ui32Timeout ? psEst->ui32Timeout : ui32Mask;
+        if((psEst->ui32SinceEdge >= ui32Timeout) ||
+           ((i32Delta < 0) && (i32Velocity > 0)) ||
+           ((i32Delta > 0) && (i32Velocity < 0)))
+        {
+            i32Velocity = 0;
+        }
+        else
+        {
+            i64Bound = ((((int64_t)psEst->ui32CountsPerEdge *
+                          psEst->ui32Clock) << 8) /
+                        (psEst->ui32SinceEdge ? psEst->ui32SinceEdge : 1));
+            if(i32Velocity > i64Bound)
+            {
+                i32Velocity = (int32_t)i64Bound;
+            }
+            else if(i32Velocity < -i64Bound)
+            {
+                i32Velocity = (int32_t)-i64Bound;
+            }
+        }
+    }
+    psEst->i32Velocity = i32Velocity;
+
+    //
+    // Restart the time since the last edge if edges were seen.
+    //
+    if(ui32Edges)
+    {
+        psEst->ui32SinceEdge = bPrimed ? ((ui32Last - ui32Now) & ui32Mask) : 0;
+    }
+
+    //
+    // Predict the position from the measured velocity and the integral term
+    // of the observer.
+    //
+    psEst->i64Position += _QEIEstScale((int64_t)(i32Velocity +
+                                                 psEst->i32Integral) << 8,
+                                       ui32Elapsed, psEst->ui32Clock);
+
+    //
+    // Compare the prediction with the middle of the current count.  If they
+    // are too far apart, as after lost counts, start again from the count.
+    //
+    i64Error = (psEst->i64Count << 16) + 0x8000 - psEst->i64Position;
+    if((i64Error > ((int64_t)QEIEST_RESYNC << 16)) ||
+       (i64Error < -((int64_t)QEIEST_RESYNC << 16)))
+    {
+        psEst->i64Position += i64Error;
+        psEst->i32Integral = 0;
+        return;
+    }
+
+    //
+    // Correct the integral term and the position.  The gains of a critically
+    // damped loop are wn^2 and 2 * wn.  The error is in 48.16 counts and the
+    // integral term in 24.8 counts per second.
+    //
+    i32Ki = psEst->ui32Bandwidth * psEst->ui32Bandwidth;
+    i32Kp = 2 * psEst->ui32Bandwidth;
+    psEst->i32Integral += (int32_t)(_QEIEstScale(i64Error * i32Ki, ui32Elapsed,
+                                                 psEst->ui32Clock) >> 8);
+    psEst->i64Position += _QEIEstScale(i64Error * i32Kp, ui32Elapsed,
+                                       psEst->ui32Clock);
+}
+
+//*****************************************************************************
+//
+//! Gets the measured velocity of an encoder.
+//!
+//! \param psEst is a pointer to the estimator.
+//!
+//! \return Returns the velocity measured by the last call to QEIEstUpdate(),
+//! in QEI counts per second in 24.8 fixed point.  Positive values are in the
+//! direction in which the QEI counts up.
+//
+//*****************************************************************************
+int32_t
+QEIEstVelocityGet(tQEIEst *psEst)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psEst != 0);
+
+    return(psEst->i32Velocity);
+}
+
+//*****************************************************************************
+//
+//! Gets the observed position of an encoder.
+//!
+//! \param psEst is a pointer to the estimator.
+//!
+//! The position follows the QEI count, extended past the QEI's maximum
+//! position, and is interpolated between counts by the observer.
+//!
+//! \return Returns the position at the last call to QEIEstUpdate(), in QEI
+//! counts in 48.16 fixed point.
+//
+//*****************************************************************************
+int64_t
+QEIEstPositionGet(tQEIEst *psEst)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psEst != 0);
+
+    return(psEst->i64Position);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,163 @@
+//*****************************************************************************
+//
+// qeiest.h - Prototypes for the QEI velocity and position estimator
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_QEIEST_H__
+#define __DRIVERLIB_QEIEST_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! This structure describes an encoder estimator started with
+//! QEIEstStart().  The caller fills in the configuration members; the
+//! remaining members are used internally.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The base address of the QEI module that counts the encoder.
+    //
+    uint32_t ui32QEIBase;
+
+    //
+    //! The input capture engine that timestamps the edges of the encoder's
+    //! channel A.  It must be started with TimerCapStart() before
+    //! QEIEstStart() is called, and its timestamps must not be consumed by
+    //! anything else.
+    //
+    tTimerCap *psCap;
+
+    //
+    //! The number of QEI counts between two captured edges, such as 4 when
+    //! the QEI counts both edges of both channels and only rising edges are
+    //! captured.
+    //
+    uint32_t ui32CountsPerEdge;
+
+    //
+    //! The frequency of the capture timer's clock in Hz.
+    //
+    uint32_t ui32Clock;
+
+    //
+    //! The natural frequency of the position observer in radians per
+    //! second.  The observer is critically damped.
+    //
+    uint32_t ui32Bandwidth;
+
+    //
+    //! The time in timer clocks without an edge after which the encoder is
+    //! considered stopped, or 0 to use the range of the capture timer.
+    //
+    uint32_t ui32Timeout;
+
+    //
+    //! The measured velocity in counts per second, in 24.8 fixed point.
+    //
+    int32_t i32Velocity;
+
+    //
+    //! The observed position in counts, in 48.16 fixed point.
+    //
+    int64_t i64Position;
+
+    //
+    //! Used internally to hold the integral term of the observer, in counts
+    //! per second in 24.8 fixed point.
+    //
+    int32_t i32Integral;
+
+    //
+    //! Used internally to hold the QEI position, extended past the QEI's
+    //! maximum position.
+    //
+    int64_t i64Count;
+
+    //
+    //! Used internally to hold the QEI position register at the last update.
+    //
+    uint32_t ui32QEIPos;
+
+    //
+    //! Used internally to hold the number of positions of the QEI counter.
+    //
+    uint32_t ui32QEIRange;
+
+    //
+    //! Used internally to hold the timer count at the last update.
+    //
+    uint32_t ui32Time;
+
+    //
+    //! Used internally to hold the time since the last captured edge.
+    //
+    uint32_t ui32SinceEdge;
+}
+tQEIEst;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void QEIEstStart(tQEIEst *psEst);
+extern void QEIEstUpdate(tQEIEst *psEst);
+extern int32_t QEIEstVelocityGet(tQEIEst *psEst);
+extern int64_t QEIEstPositionGet(tQEIEst *psEst);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_QEIEST_H__
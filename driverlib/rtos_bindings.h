@@ -56,6 +56,51 @@
 //*****************************************************************************
 #include "tiva_rtos.h"
 
+//*****************************************************************************
+//
+// If tiva_rtos.h does not provide its own delay, wait on the cycle counter
+// delay service and yield to other tasks until the time has passed, rather
+// than spinning in SysCtlDelay.  The parameter is the number of 3 cycle loops
+// to wait (as for SysCtlDelay).  The wait is counted down in 64 bits since it
+// can be longer than the 32-bit cycle counter can measure in one step.
+//
+//*****************************************************************************
+#ifndef OS_DELAY
+#include "driverlib/delay.h"
+#define OS_DELAY(ul3Cycles)                                                   \
+        do                                                                    \
+        {                                                                     \
+            uint64_t ui64OSDelayLeft = (uint64_t)(ul3Cycles) * 3;             \
+            uint32_t ui32OSDelayLast = DelayCountGet();                       \
+            uint32_t ui32OSDelayNow;                                          \
+            while(1)                                                          \
+            {                                                                 \
+                ui32OSDelayNow = DelayCountGet();                             \
+                if((ui32OSDelayNow - ui32OSDelayLast) >= ui64OSDelayLeft)     \
+                {                                                             \
+                    break;                                                    \
+                }                                                             \
+                ui64OSDelayLeft -= ui32OSDelayNow - ui32OSDelayLast;          \
+                ui32OSDelayLast = ui32OSDelayNow;                             \
+                OS_YIELD();                                                   \
+            }                                                                 \
+        }                                                                     \
+        while(0)
+#endif
+
+//*****************************************************************************
+//
+// If tiva_rtos.h does not provide its own critical section, use the BASEPRI
+// based one from the atomic module.  It only ever raises BASEPRI, so it nests
+// safely inside kernels that use BASEPRI for their own critical sections.
+//
+//*****************************************************************************
+#ifndef OS_CRITICAL_ENTER
+#include "driverlib/atomic.h"
+#define OS_CRITICAL_ENTER() AtomicEnter()
+#define OS_CRITICAL_EXIT(ui32Key) AtomicExit(ui32Key)
+#endif
+
 #else
 //*****************************************************************************
 //
@@ -77,13 +122,25 @@
 
 //*****************************************************************************
 //
-// A simple macro around the SysCtlDelay function.  The parameter is the number
-// of 3 cycle loops to wait before returning (as for SysCtlDelay).  In an RTOS
+// A simple macro around the cycle counter delay service.  The parameter is
+// the number of 3 cycle loops to wait before returning (as for SysCtlDelay),
+// but unlike SysCtlDelay the duration does not vary with flash wait states or
+// prefetch.  The count is waited for three times rather than multiplied by
+// three, which would overflow for counts of 2^30 or more.  In an RTOS
 // implementation, this could be replaced with an OS delay call with
 // appropriate parameter scaling.
 //
 //*****************************************************************************
-#define OS_DELAY(ul3Cycles) MAP_SysCtlDelay(ul3Cycles)
+#include "driverlib/delay.h"
+#define OS_DELAY(ul3Cycles)                                                   \
+        do                                                                    \
+        {                                                                     \
+            uint32_t ui32OSDelay = (ul3Cycles);                               \
+            DelayCycles(ui32OSDelay);                                         \
+            DelayCycles(ui32OSDelay);                                         \
+            DelayCycles(ui32OSDelay);                                         \
+        }                                                                     \
+        while(0)
 
 //*****************************************************************************
 //
@@ -103,6 +160,18 @@
 #define OS_INT_DISABLE(ui32IntID) MAP_IntDisable(ui32IntID)
 #define OS_INT_ENABLE(ui32IntID) MAP_IntEnable(ui32IntID)
 
+//*****************************************************************************
+//
+// Wrappers around the priority ceiling critical section.  OS_CRITICAL_ENTER()
+// returns a key that must be passed to the matching OS_CRITICAL_EXIT().
+// Unlike OS_INT_MASTER_DISABLE(), interrupts above the ceiling set with
+// AtomicCeilingSet() continue to be taken inside the critical section.
+//
+//*****************************************************************************
+#include "driverlib/atomic.h"
+#define OS_CRITICAL_ENTER() AtomicEnter()
+#define OS_CRITICAL_EXIT(ui32Key) AtomicExit(ui32Key)
+
 #endif // USE_RTOS
 
 #endif // __DRIVERLIB_RTOS_BINDINGS_H__
@@ -0,0 +1,1058 @@
+//*****************************************************************************
+//
+// sw_aes.c - Software AES functions.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup sw_aes_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/aes.h"
+#include "driverlib/debug.h"
+#include "driverlib/sw_aes.h"
+
+//*****************************************************************************
+//
+// The AES S-box and its inverse.
+//
+//*****************************************************************************
+static const uint8_t g_pui8SWAESSbox[256] =
+{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5,
+    0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc,
+    0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a,
+    0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b,
+    0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85,
+    0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17,
+    0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88,
+    0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9,
+    0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6,
+    0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94,
+    0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68,
+    0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+static const uint8_t g_pui8SWAESInvSbox[256] =
+{
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38,
+    0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87,
+    0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d,
+    0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2,
+    0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16,
+    0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda,
+    0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a,
+    0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02,
+    0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea,
+    0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85,
+    0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89,
+    0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20,
+    0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31,
+    0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d,
+    0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0,
+    0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26,
+    0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
+};
+
+//*****************************************************************************
+//
+// The combined SubBytes/MixColumns table for encryption.  Entry x holds the
+// column {2, 1, 1, 3} * S(x), with row 0 in the least significant byte.  The
+// tables for the other three rows are byte rotations of this one, which the
+// Cortex-M4 applies for free through the barrel shifter, so only 1 KB of
+// table is needed instead of the usual 4 KB.
+//
+//*****************************************************************************
+static const uint32_t g_pui32SWAESTe[256] =
+{
+    0xa56363c6, 0x847c7cf8, 0x997777ee, 0x8d7b7bf6,
+    0x0df2f2ff, 0xbd6b6bd6, 0xb16f6fde, 0x54c5c591,
+    0x50303060, 0x03010102, 0xa96767ce, 0x7d2b2b56,
+    0x19fefee7, 0x62d7d7b5, 0xe6abab4d, 0x9a7676ec,
+    0x45caca8f, 0x9d82821f, 0x40c9c989, 0x877d7dfa,
+    0x15fafaef, 0xeb5959b2, 0xc947478e, 0x0bf0f0fb,
+    0xecadad41, 0x67d4d4b3, 0xfda2a25f, 0xeaafaf45,
+    0xbf9c9c23, 0xf7a4a453, 0x967272e4, 0x5bc0c09b,
+    0xc2b7b775, 0x1cfdfde1, 0xae93933d, 0x6a26264c,
+    0x5a36366c, 0x413f3f7e, 0x02f7f7f5, 0x4fcccc83,
+    0x5c343468, 0xf4a5a551, 0x34e5e5d1, 0x08f1f1f9,
+    0x937171e2, 0x73d8d8ab, 0x53313162, 0x3f15152a,
+    0x0c040408, 0x52c7c795, 0x65232346, 0x5ec3c39d,
+    0x28181830, 0xa1969637, 0x0f05050a, 0xb59a9a2f,
+    0x0907070e, 0x36121224, 0x9b80801b, 0x3de2e2df,
+    0x26ebebcd, 0x6927274e, 0xcdb2b27f, 0x9f7575ea,
+    0x1b090912, 0x9e83831d, 0x742c2c58, 0x2e1a1a34,
+    0x2d1b1b36, 0xb26e6edc, 0xee5a5ab4, 0xfba0a05b,
+    0xf65252a4, 0x4d3b3b76, 0x61d6d6b7, 0xceb3b37d,
+    0x7b292952, 0x3ee3e3dd, 0x712f2f5e, 0x97848413,
+    0xf55353a6, 0x68d1d1b9, 0x00000000, 0x2cededc1,
+    0x60202040, 0x1ffcfce3, 0xc8b1b179, 0xed5b5bb6,
+    0xbe6a6ad4, 0x46cbcb8d, 0xd9bebe67, 0x4b393972,
+    0xde4a4a94, 0xd44c4c98, 0xe85858b0, 0x4acfcf85,
+    0x6bd0d0bb, 0x2aefefc5, 0xe5aaaa4f, 0x16fbfbed,
+    0xc5434386, 0xd74d4d9a, 0x55333366, 0x94858511,
+    0xcf45458a, 0x10f9f9e9, 0x06020204, 0x817f7ffe,
+    0xf05050a0, 0x443c3c78, 0xba9f9f25, 0xe3a8a84b,
+    0xf35151a2, 0xfea3a35d, 0xc0404080, 0x8a8f8f05,
+    0xad92923f, 0xbc9d9d21, 0x48383870, 0x04f5f5f1,
+    0xdfbcbc63, 0xc1b6b677, 0x75dadaaf, 0x63212142,
+    0x30101020, 0x1affffe5, 0x0ef3f3fd, 0x6dd2d2bf,
+    0x4ccdcd81, 0x140c0c18, 0x35131326, 0x2fececc3,
+    0xe15f5fbe, 0xa2979735, 0xcc444488, 0x3917172e,
+    0x57c4c493, 0xf2a7a755, 0x827e7efc, 0x473d3d7a,
+    0xac6464c8, 0xe75d5dba, 0x2b191932, 0x957373e6,
+    0xa06060c0, 0x98818119, 0xd14f4f9e, 0x7fdcdca3,
+    0x66222244, 0x7e2a2a54, 0xab90903b, 0x8388880b,
+    0xca46468c, 0x29eeeec7, 0xd3b8b86b, 0x3c141428,
+    0x79dedea7, 0xe25e5ebc, 0x1d0b0b16, 0x76dbdbad,
+    0x3be0e0db, 0x56323264, 0x4e3a3a74, 0x1e0a0a14,
+    0xdb494992, 0x0a06060c, 0x6c242448, 0xe45c5cb8,
+    0x5dc2c29f, 0x6ed3d3bd, 0xefacac43, 0xa66262c4,
+    0xa8919139, 0xa4959531, 0x37e4e4d3, 0x8b7979f2,
+    0x32e7e7d5, 0x43c8c88b, 0x5937376e, 0xb76d6dda,
+    0x8c8d8d01, 0x64d5d5b1, 0xd24e4e9c, 0xe0a9a949,
+    0xb46c6cd8, 0xfa5656ac, 0x07f4f4f3, 0x25eaeacf,
+    0xaf6565ca, 0x8e7a7af4, 0xe9aeae47, 0x18080810,
+    0xd5baba6f, 0x887878f0, 0x6f25254a, 0x722e2e5c,
+    0x241c1c38, 0xf1a6a657, 0xc7b4b473, 0x51c6c697,
+    0x23e8e8cb, 0x7cdddda1, 0x9c7474e8, 0x211f1f3e,
+    0xdd4b4b96, 0xdcbdbd61, 0x868b8b0d, 0x858a8a0f,
+    0x907070e0, 0x423e3e7c, 0xc4b5b571, 0xaa6666cc,
+    0xd8484890, 0x05030306, 0x01f6f6f7, 0x120e0e1c,
+    0xa36161c2, 0x5f35356a, 0xf95757ae, 0xd0b9b969,
+    0x91868617, 0x58c1c199, 0x271d1d3a, 0xb99e9e27,
+    0x38e1e1d9, 0x13f8f8eb, 0xb398982b, 0x33111122,
+    0xbb6969d2, 0x70d9d9a9, 0x898e8e07, 0xa7949433,
+    0xb69b9b2d, 0x221e1e3c, 0x92878715, 0x20e9e9c9,
+    0x49cece87, 0xff5555aa, 0x78282850, 0x7adfdfa5,
+    0x8f8c8c03, 0xf8a1a159, 0x80898909, 0x170d0d1a,
+    0xdabfbf65, 0x31e6e6d7, 0xc6424284, 0xb86868d0,
+    0xc3414182, 0xb0999929, 0x772d2d5a, 0x110f0f1e,
+    0xcbb0b07b, 0xfc5454a8, 0xd6bbbb6d, 0x3a16162c
+};
+
+//*****************************************************************************
+//
+// The combined InvSubBytes/InvMixColumns table for decryption.  Entry x
+// holds the column {14, 9, 13, 11} * S^-1(x), with row 0 in the least
+// significant byte.
+//
+//*****************************************************************************
+static const uint32_t g_pui32SWAESTd[256] =
+{
+    0x50a7f451, 0x5365417e, 0xc3a4171a, 0x965e273a,
+    0xcb6bab3b, 0xf1459d1f, 0xab58faac, 0x9303e34b,
+    0x55fa3020, 0xf66d76ad, 0x9176cc88, 0x254c02f5,
+    0xfcd7e54f, 0xd7cb2ac5, 0x80443526, 0x8fa362b5,
+    0x495ab1de, 0x671bba25, 0x980eea45, 0xe1c0fe5d,
+    0x02752fc3, 0x12f04c81, 0xa397468d, 0xc6f9d36b,
+    0xe75f8f03, 0x959c9215, 0xeb7a6dbf, 0xda595295,
+    0x2d83bed4, 0xd3217458, 0x2969e049, 0x44c8c98e,
+    0x6a89c275, 0x78798ef4, 0x6b3e5899, 0xdd71b927,
+    0xb64fe1be, 0x17ad88f0, 0x66ac20c9, 0xb43ace7d,
+    0x184adf63, 0x82311ae5, 0x60335197, 0x457f5362,
+    0xe07764b1, 0x84ae6bbb, 0x1ca081fe, 0x942b08f9,
+    0x58684870, 0x19fd458f, 0x876cde94, 0xb7f87b52,
+    0x23d373ab, 0xe2024b72, 0x578f1fe3, 0x2aab5566,
+    0x0728ebb2, 0x03c2b52f, 0x9a7bc586, 0xa50837d3,
+    0xf2872830, 0xb2a5bf23, 0xba6a0302, 0x5c8216ed,
+    0x2b1ccf8a, 0x92b479a7, 0xf0f207f3, 0xa1e2694e,
+    0xcdf4da65, 0xd5be0506, 0x1f6234d1, 0x8afea6c4,
+    0x9d532e34, 0xa055f3a2, 0x32e18a05, 0x75ebf6a4,
+    0x39ec830b, 0xaaef6040, 0x069f715e, 0x51106ebd,
+    0xf98a213e, 0x3d06dd96, 0xae053edd, 0x46bde64d,
+    0xb58d5491, 0x055dc471, 0x6fd40604, 0xff155060,
+    0x24fb9819, 0x97e9bdd6, 0xcc434089, 0x779ed967,
+    0xbd42e8b0, 0x888b8907, 0x385b19e7, 0xdbeec879,
+    0x470a7ca1, 0xe90f427c, 0xc91e84f8, 0x00000000,
+    0x83868009, 0x48ed2b32, 0xac70111e, 0x4e725a6c,
+    0xfbff0efd, 0x5638850f, 0x1ed5ae3d, 0x27392d36,
+    0x64d90f0a, 0x21a65c68, 0xd1545b9b, 0x3a2e3624,
+    0xb1670a0c, 0x0fe75793, 0xd296eeb4, 0x9e919b1b,
+    0x4fc5c080, 0xa220dc61, 0x694b775a, 0x161a121c,
+    0x0aba93e2, 0xe52aa0c0, 0x43e0223c, 0x1d171b12,
+    0x0b0d090e, 0xadc78bf2, 0xb9a8b62d, 0xc8a91e14,
+    0x8519f157, 0x4c0775af, 0xbbdd99ee, 0xfd607fa3,
+    0x9f2601f7, 0xbcf5725c, 0xc53b6644, 0x347efb5b,
+    0x7629438b, 0xdcc623cb, 0x68fcedb6, 0x63f1e4b8,
+    0xcadc31d7, 0x10856342, 0x40229713, 0x2011c684,
+    0x7d244a85, 0xf83dbbd2, 0x1132f9ae, 0x6da129c7,
+    0x4b2f9e1d, 0xf330b2dc, 0xec52860d, 0xd0e3c177,
+    0x6c16b32b, 0x99b970a9, 0xfa489411, 0x2264e947,
+    0xc48cfca8, 0x1a3ff0a0, 0xd82c7d56, 0xef903322,
+    0xc74e4987, 0xc1d138d9, 0xfea2ca8c, 0x360bd498,
+    0xcf81f5a6, 0x28de7aa5, 0x268eb7da, 0xa4bfad3f,
+    0xe49d3a2c, 0x0d927850, 0x9bcc5f6a, 0x62467e54,
+    0xc2138df6, 0xe8b8d890, 0x5ef7392e, 0xf5afc382,
+    0xbe805d9f, 0x7c93d069, 0xa92dd56f, 0xb31225cf,
+    0x3b99acc8, 0xa77d1810, 0x6e639ce8, 0x7bbb3bdb,
+    0x097826cd, 0xf418596e, 0x01b79aec, 0xa89a4f83,
+    0x656e95e6, 0x7ee6ffaa, 0x08cfbc21, 0xe6e815ef,
+    0xd99be7ba, 0xce366f4a, 0xd4099fea, 0xd67cb029,
+    0xafb2a431, 0x31233f2a, 0x3094a5c6, 0xc066a235,
+    0x37bc4e74, 0xa6ca82fc, 0xb0d090e0, 0x15d8a733,
+    0x4a9804f1, 0xf7daec41, 0x0e50cd7f, 0x2ff69117,
+    0x8dd64d76, 0x4db0ef43, 0x544daacc, 0xdf0496e4,
+    0xe3b5d19e, 0x1b886a4c, 0xb81f2cc1, 0x7f516546,
+    0x04ea5e9d, 0x5d358c01, 0x737487fa, 0x2e410bfb,
+    0x5a1d67b3, 0x52d2db92, 0x335610e9, 0x1347d66d,
+    0x8c61d79a, 0x7a0ca137, 0x8e14f859, 0x893c13eb,
+    0xee27a9ce, 0x35c961b7, 0xede51ce1, 0x3cb1477a,
+    0x59dfd29c, 0x3f73f255, 0x79ce1418, 0xbf37c773,
+    0xeacdf753, 0x5baafd5f, 0x146f3ddf, 0x86db4478,
+    0x81f3afca, 0x3ec468b9, 0x2c342438, 0x5f40a3c2,
+    0x72c31d16, 0x0c25e2bc, 0x8b493c28, 0x41950dff,
+    0x7101a839, 0xdeb30c08, 0x9ce4b4d8, 0x90c15664,
+    0x6184cb7b, 0x70b632d5, 0x745c6c48, 0x4257b8d0
+};
+
+//*****************************************************************************
+//
+// The round constants used by the key expansion.
+//
+//*****************************************************************************
+static const uint8_t g_pui8SWAESRcon[10] =
+{
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+};
+
+//*****************************************************************************
+//
+// The reduction table used by the 4-bit GHASH multiplication.
+//
+//*****************************************************************************
+static const uint16_t g_pui16SWAESGHASHRem[16] =
+{
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+//*****************************************************************************
+//
+// Helper macros for the table lookups.  Each one selects a byte of a column
+// word and returns the table entry rotated into the matching row.
+//
+//*****************************************************************************
+#define ROTL(x, n)              (((x) << (n)) | ((x) >> (32 - (n))))
+#define TE0(x)                  (g_pui32SWAESTe[(x) & 0xff])
+#define TE1(x)                  ROTL(g_pui32SWAESTe[((x) >> 8) & 0xff], 8)
+#define TE2(x)                  ROTL(g_pui32SWAESTe[((x) >> 16) & 0xff], 16)
+#define TE3(x)                  ROTL(g_pui32SWAESTe[(x) >> 24], 24)
+#define TD0(x)                  (g_pui32SWAESTd[(x) & 0xff])
+#define TD1(x)                  ROTL(g_pui32SWAESTd[((x) >> 8) & 0xff], 8)
+#define TD2(x)                  ROTL(g_pui32SWAESTd[((x) >> 16) & 0xff], 16)
+#define TD3(x)                  ROTL(g_pui32SWAESTd[(x) >> 24], 24)
+#define SB(x, n)                ((uint32_t)g_pui8SWAESSbox[((x) >> (n)) &    \
+                                                           0xff] << (n))
+#define ISB(x, n)               ((uint32_t)g_pui8SWAESInvSbox[((x) >> (n)) & \
+                                                              0xff] << (n))
+
+//*****************************************************************************
+//
+// The state of the software AES engine.  As with the AES module, there is a
+// single engine, so the state is global.
+//
+//*****************************************************************************
+static uint32_t g_ui32SWAESConfig;
+static uint32_t g_ui32SWAESRounds;
+static uint32_t g_pui32SWAESEncKey[60];
+static uint32_t g_pui32SWAESDecKey[60];
+static uint32_t g_pui32SWAESIV[4];
+
+//*****************************************************************************
+//
+// Encrypts a single 16-byte block with the current key schedule.
+//
+//*****************************************************************************
+static void
+_SWAESEncryptBlock(const uint32_t *pui32In, uint32_t *pui32Out)
+{
+    const uint32_t *pui32RK;
+    uint32_t ui32S0, ui32S1, ui32S2, ui32S3;
+    uint32_t ui32T0, ui32T1, ui32T2, ui32T3;
+    uint32_t ui32Round;
+
+    //
+    // Initial AddRoundKey.
+    //
+    pui32RK = g_pui32SWAESEncKey;
+    ui32S0 = pui32In[0] ^ pui32RK[0];
+    ui32S1 = pui32In[1] ^ pui32RK[1];
+    ui32S2 = pui32In[2] ^ pui32RK[2];
+    ui32S3 = pui32In[3] ^ pui32RK[3];
+
+    //
+    // The full rounds, each combining SubBytes, ShiftRows, MixColumns and
+    // AddRoundKey into sixteen table lookups.
+    //
+    for(ui32Round = 1; ui32Round < g_ui32SWAESRounds; ui32Round++)
+    {
+        pui32RK += 4;
+        ui32T0 = (TE0(ui32S0) ^ TE1(ui32S1) ^ TE2(ui32S2) ^ TE3(ui32S3) ^
+                  pui32RK[0]);
+        ui32T1 = (TE0(ui32S1) ^ TE1(ui32S2) ^ TE2(ui32S3) ^ TE3(ui32S0) ^
+                  pui32RK[1]);
+        ui32T2 = (TE0(ui32S2) ^ TE1(ui32S3) ^ TE2(ui32S0) ^ TE3(ui32S1) ^
+                  pui32RK[2]);
+        ui32T3 = (TE0(ui32S3) ^ TE1(ui32S0) ^ TE2(ui32S1) ^ TE3(ui32S2) ^
+                  pui32RK[3]);
+        ui32S0 = ui32T0;
+        ui32S1 = ui32T1;
+        ui32S2 = ui32T2;
+        ui32S3 = ui32T3;
+    }
+
+    //
+    // The final round has no MixColumns.
+    //
+    pui32RK += 4;
+    pui32Out[0] = (SB(ui32S0, 0) | SB(ui32S1, 8) | SB(ui32S2, 16) |
+                   SB(ui32S3, 24)) ^ pui32RK[0];
+    pui32Out[1] = (SB(ui32S1, 0) | SB(ui32S2, 8) | SB(ui32S3, 16) |
+                   SB(ui32S0, 24)) ^ pui32RK[1];
+    pui32Out[2] = (SB(ui32S2, 0) | SB(ui32S3, 8) | SB(ui32S0, 16) |
+                   SB(ui32S1, 24)) ^ pui32RK[2];
+    pui32Out[3] = (SB(ui32S3, 0) | SB(ui32S0, 8) | SB(ui32S1, 16) |
+                   SB(ui32S2, 24)) ^ pui32RK[3];
+}
+
+//*****************************************************************************
+//
+// Decrypts a single 16-byte block with the current key schedule.
+//
+//*****************************************************************************
+static void
+_SWAESDecryptBlock(const uint32_t *pui32In, uint32_t *pui32Out)
+{
+    const uint32_t *pui32RK;
+    uint32_t ui32S0, ui32S1, ui32S2, ui32S3;
+    uint32_t ui32T0, ui32T1, ui32T2, ui32T3;
+    uint32_t ui32Round;
+
+    //
+    // Initial AddRoundKey.
+    //
+    pui32RK = g_pui32SWAESDecKey;
+    ui32S0 = pui32In[0] ^ pui32RK[0];
+    ui32S1 = pui32In[1] ^ pui32RK[1];
+    ui32S2 = pui32In[2] ^ pui32RK[2];
+    ui32S3 = pui32In[3] ^ pui32RK[3];
+
+    //
+    // The full rounds of the equivalent inverse cipher.
+    //
+    for(ui32Round = 1; ui32Round < g_ui32SWAESRounds; ui32Round++)
+    {
+        pui32RK += 4;
+        ui32T0 = (TD0(ui32S0) ^ TD1(ui32S3) ^ TD2(ui32S2) ^ TD3(ui32S1) ^
+                  pui32RK[0]);
+        ui32T1 = (TD0(ui32S1) ^ TD1(ui32S0) ^ TD2(ui32S3) ^ TD3(ui32S2) ^
+                  pui32RK[1]);
+        ui32T2 = (TD0(ui32S2) ^ TD1(ui32S1) ^ TD2(ui32S0) ^ TD3(ui32S3) ^
+                  pui32RK[2]);
+        ui32T3 = (TD0(ui32S3) ^ TD1(ui32S2) ^ TD2(ui32S1) ^ TD3(ui32S0) ^
+                  pui32RK[3]);
+        ui32S0 = ui32T0;
+        ui32S1 = ui32T1;
+        ui32S2 = ui32T2;
+        ui32S3 = ui32T3;
+    }
+
+    //
+    // The final round has no InvMixColumns.
+    //
+    pui32RK += 4;
+    pui32Out[0] = (ISB(ui32S0, 0) | ISB(ui32S3, 8) | ISB(ui32S2, 16) |
+                   ISB(ui32S1, 24)) ^ pui32RK[0];
+    pui32Out[1] = (ISB(ui32S1, 0) | ISB(ui32S0, 8) | ISB(ui32S3, 16) |
+                   ISB(ui32S2, 24)) ^ pui32RK[1];
+    pui32Out[2] = (ISB(ui32S2, 0) | ISB(ui32S1, 8) | ISB(ui32S0, 16) |
+                   ISB(ui32S3, 24)) ^ pui32RK[2];
+    pui32Out[3] = (ISB(ui32S3, 0) | ISB(ui32S2, 8) | ISB(ui32S1, 16) |
+                   ISB(ui32S0, 24)) ^ pui32RK[3];
+}
+
+//*****************************************************************************
+//
+// Increments the counter in the last bytes of a block, treating it as a
+// big-endian number of the configured width.
+//
+//*****************************************************************************
+static void
+_SWAESCounterIncrement(uint32_t *pui32Block, uint32_t ui32Bytes)
+{
+    uint8_t *pui8Block;
+    uint32_t ui32Idx;
+
+    pui8Block = (uint8_t *)pui32Block;
+    for(ui32Idx = 16; ui32Idx > (16 - ui32Bytes); ui32Idx--)
+    {
+        if(++pui8Block[ui32Idx - 1] != 0)
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Runs counter mode from the given counter block over a buffer of any
+// length.  The counter block is advanced past the last block used.
+//
+//*****************************************************************************
+static void
+_SWAESCTR(uint32_t *pui32Counter, uint32_t ui32Width, const uint32_t *pui32Src,
+          uint32_t *pui32Dest, uint32_t ui32Length)
+{
+    uint32_t pui32Stream[4];
+    const uint8_t *pui8Src;
+    uint8_t *pui8Dest;
+    uint32_t ui32Idx;
+
+    //
+    // Process whole blocks a word at a time.
+    //
+    while(ui32Length >= 16)
+    {
+        _SWAESEncryptBlock(pui32Counter, pui32Stream);
+        _SWAESCounterIncrement(pui32Counter, ui32Width);
+        pui32Dest[0] = pui32Src[0] ^ pui32Stream[0];
+        pui32Dest[1] = pui32Src[1] ^ pui32Stream[1];
+        pui32Dest[2] = pui32Src[2] ^ pui32Stream[2];
+        pui32Dest[3] = pui32Src[3] ^ pui32Stream[3];
+        pui32Src += 4;
+        pui32Dest += 4;
+        ui32Length -= 16;
+    }
+
+    //
+    // Process a trailing partial block a byte at a time.
+    //
+    if(ui32Length)
+    {
+        _SWAESEncryptBlock(pui32Counter, pui32Stream);
+        _SWAESCounterIncrement(pui32Counter, ui32Width);
+        pui8Src = (const uint8_t *)pui32Src;
+        pui8Dest = (uint8_t *)pui32Dest;
+        for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx++)
+        {
+            pui8Dest[ui32Idx] = (pui8Src[ui32Idx] ^
+                                 ((uint8_t *)pui32Stream)[ui32Idx]);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Builds the 4-bit multiplication tables for GHASH from the hash subkey H.
+//
+//*****************************************************************************
+static void
+_SWAESGHASHTableInit(const uint32_t *pui32H, uint64_t *pui64HL,
+                     uint64_t *pui64HH)
+{
+    const uint8_t *pui8H;
+    uint64_t ui64VH, ui64VL;
+    uint32_t ui32Idx, ui32Entry, ui32T;
+
+    //
+    // Load H as a big-endian 128-bit value.
+    //
+    pui8H = (const uint8_t *)pui32H;
+    ui64VH = 0;
+    ui64VL = 0;
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        ui64VH = (ui64VH << 8) | pui8H[ui32Idx];
+        ui64VL = (ui64VL << 8) | pui8H[ui32Idx + 8];
+    }
+
+    //
+    // Entry 8 is H, entries 4, 2 and 1 are H times successive powers of x.
+    //
+    pui64HL[0] = 0;
+    pui64HH[0] = 0;
+    pui64HL[8] = ui64VL;
+    pui64HH[8] = ui64VH;
+    for(ui32Idx = 4; ui32Idx > 0; ui32Idx >>= 1)
+    {
+        ui32T = (uint32_t)(ui64VL & 1) * 0xe1000000;
+        ui64VL = (ui64VH << 63) | (ui64VL >> 1);
+        ui64VH = (ui64VH >> 1) ^ ((uint64_t)ui32T << 32);
+        pui64HL[ui32Idx] = ui64VL;
+        pui64HH[ui32Idx] = ui64VH;
+    }
+
+    //
+    // The remaining entries are sums of those.
+    //
+    for(ui32Idx = 2; ui32Idx <= 8; ui32Idx *= 2)
+    {
+        for(ui32Entry = 1; ui32Entry < ui32Idx; ui32Entry++)
+        {
+            pui64HH[ui32Idx + ui32Entry] = (pui64HH[ui32Idx] ^
+                                            pui64HH[ui32Entry]);
+            pui64HL[ui32Idx + ui32Entry] = (pui64HL[ui32Idx] ^
+                                            pui64HL[ui32Entry]);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Multiplies the 16-byte GHASH accumulator by H in GF(2^128).
+//
+//*****************************************************************************
+static void
+_SWAESGHASHMultiply(uint8_t *pui8X, const uint64_t *pui64HL,
+                    const uint64_t *pui64HH)
+{
+    uint64_t ui64ZH, ui64ZL;
+    uint32_t ui32Lo, ui32Hi, ui32Rem;
+    int32_t i32Idx;
+
+    ui32Lo = pui8X[15] & 0xf;
+    ui64ZH = pui64HH[ui32Lo];
+    ui64ZL = pui64HL[ui32Lo];
+
+    for(i32Idx = 15; i32Idx >= 0; i32Idx--)
+    {
+        ui32Lo = pui8X[i32Idx] & 0xf;
+        ui32Hi = (pui8X[i32Idx] >> 4) & 0xf;
+
+        if(i32Idx != 15)
+        {
+            ui32Rem = (uint32_t)ui64ZL & 0xf;
+            ui64ZL = (ui64ZH << 60) | (ui64ZL >> 4);
+            ui64ZH = (ui64ZH >> 4);
+            ui64ZH ^= (uint64_t)g_pui16SWAESGHASHRem[ui32Rem] << 48;
+            ui64ZH ^= pui64HH[ui32Lo];
+            ui64ZL ^= pui64HL[ui32Lo];
+        }
+
+        ui32Rem = (uint32_t)ui64ZL & 0xf;
+        ui64ZL = (ui64ZH << 60) | (ui64ZL >> 4);
+        ui64ZH = (ui64ZH >> 4);
+        ui64ZH ^= (uint64_t)g_pui16SWAESGHASHRem[ui32Rem] << 48;
+        ui64ZH ^= pui64HH[ui32Hi];
+        ui64ZL ^= pui64HL[ui32Hi];
+    }
+
+    //
+    // Store the product back as a big-endian value.
+    //
+    for(i32Idx = 7; i32Idx >= 0; i32Idx--)
+    {
+        pui8X[i32Idx] = (uint8_t)ui64ZH;
+        pui8X[i32Idx + 8] = (uint8_t)ui64ZL;
+        ui64ZH >>= 8;
+        ui64ZL >>= 8;
+    }
+}
+
+//*****************************************************************************
+//
+// Absorbs a buffer of any length into the GHASH accumulator, padding the
+// last block with zeros.
+//
+//*****************************************************************************
+static void
+_SWAESGHASHUpdate(uint8_t *pui8X, const uint8_t *pui8Data, uint32_t ui32Length,
+                  const uint64_t *pui64HL, const uint64_t *pui64HH)
+{
+    uint32_t ui32Idx, ui32Count;
+
+    while(ui32Length)
+    {
+        ui32Count = (ui32Length < 16) ? ui32Length : 16;
+        for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+        {
+            pui8X[ui32Idx] ^= pui8Data[ui32Idx];
+        }
+        _SWAESGHASHMultiply(pui8X, pui64HL, pui64HH);
+        pui8Data += ui32Count;
+        ui32Length -= ui32Count;
+    }
+}
+
+//*****************************************************************************
+//
+//! Configures the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param ui32Config is the configuration of the AES engine.
+//!
+//! This function is the software equivalent of AESConfigSet() and takes the
+//! same flags.  The software engine supports the \b AES_CFG_MODE_ECB,
+//! \b AES_CFG_MODE_CBC and \b AES_CFG_MODE_CTR modes through
+//! SWAESDataProcess(), and \b AES_CFG_MODE_GCM_HLY0CALC and
+//! \b AES_CFG_MODE_GCM_HY0CALC through SWAESDataProcessAuth(), with 128-,
+//! 192- and 256-bit keys.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESConfigSet(uint32_t ui32Base, uint32_t ui32Config)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+
+    g_ui32SWAESConfig = ui32Config;
+}
+
+//*****************************************************************************
+//
+//! Sets the key used by the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param pui32Key is an array of 32-bit words containing the key.  The
+//! least significant word is in the 0th index.
+//! \param ui32Keysize is the size of the key, which must be one of
+//! \b AES_CFG_KEY_SIZE_128BIT, \b AES_CFG_KEY_SIZE_192BIT or
+//! \b AES_CFG_KEY_SIZE_256BIT.
+//!
+//! This function is the software equivalent of AESKey1Set().  It expands the
+//! key into the encryption and decryption key schedules.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESKey1Set(uint32_t ui32Base, uint32_t *pui32Key, uint32_t ui32Keysize)
+{
+    uint32_t ui32Words, ui32Total, ui32Idx, ui32Temp;
+    uint32_t *pui32Enc, *pui32Dec;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+    ASSERT((ui32Keysize == AES_CFG_KEY_SIZE_128BIT) ||
+           (ui32Keysize == AES_CFG_KEY_SIZE_192BIT) ||
+           (ui32Keysize == AES_CFG_KEY_SIZE_256BIT));
+
+    //
+    // Determine the key length in words and the number of rounds.
+    //
+    if(ui32Keysize == AES_CFG_KEY_SIZE_256BIT)
+    {
+        ui32Words = 8;
+    }
+    else if(ui32Keysize == AES_CFG_KEY_SIZE_192BIT)
+    {
+        ui32Words = 6;
+    }
+    else
+    {
+        ui32Words = 4;
+    }
+    g_ui32SWAESRounds = ui32Words + 6;
+    ui32Total = 4 * (g_ui32SWAESRounds + 1);
+
+    //
+    // Expand the encryption key schedule.
+    //
+    pui32Enc = g_pui32SWAESEncKey;
+    for(ui32Idx = 0; ui32Idx < ui32Words; ui32Idx++)
+    {
+        pui32Enc[ui32Idx] = pui32Key[ui32Idx];
+    }
+    for(; ui32Idx < ui32Total; ui32Idx++)
+    {
+        ui32Temp = pui32Enc[ui32Idx - 1];
+        if((ui32Idx % ui32Words) == 0)
+        {
+            //
+            // RotWord, SubWord and the round constant.
+            //
+            ui32Temp = ROTL(ui32Temp, 24);
+            ui32Temp = (SB(ui32Temp, 0) | SB(ui32Temp, 8) | SB(ui32Temp, 16) |
+                        SB(ui32Temp, 24));
+            ui32Temp ^= g_pui8SWAESRcon[(ui32Idx / ui32Words) - 1];
+        }
+        else if((ui32Words > 6) && ((ui32Idx % ui32Words) == 4))
+        {
+            ui32Temp = (SB(ui32Temp, 0) | SB(ui32Temp, 8) | SB(ui32Temp, 16) |
+                        SB(ui32Temp, 24));
+        }
+        pui32Enc[ui32Idx] = pui32Enc[ui32Idx - ui32Words] ^ ui32Temp;
+    }
+
+    //
+    // Build the decryption key schedule for the equivalent inverse cipher:
+    // the round keys in reverse order, with InvMixColumns applied to all but
+    // the first and last.  InvMixColumns is computed through the decryption
+    // table, since Td[S(x)] is the InvMixColumns column for byte x.
+    //
+    pui32Dec = g_pui32SWAESDecKey;
+    for(ui32Idx = 0; ui32Idx < ui32Total; ui32Idx += 4)
+    {
+        pui32Dec[ui32Idx + 0] = pui32Enc[ui32Total - 4 - ui32Idx + 0];
+        pui32Dec[ui32Idx + 1] = pui32Enc[ui32Total - 4 - ui32Idx + 1];
+        pui32Dec[ui32Idx + 2] = pui32Enc[ui32Total - 4 - ui32Idx + 2];
+        pui32Dec[ui32Idx + 3] = pui32Enc[ui32Total - 4 - ui32Idx + 3];
+    }
+    for(ui32Idx = 4; ui32Idx < (ui32Total - 4); ui32Idx++)
+    {
+        ui32Temp = pui32Dec[ui32Idx];
+        pui32Dec[ui32Idx] = (TD0(SB(ui32Temp, 0)) ^
+                             TD1(SB(ui32Temp, 8)) ^
+                             TD2(SB(ui32Temp, 16)) ^
+                             TD3(SB(ui32Temp, 24)));
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets the initial vector used by the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param pui32IVdata is an array of 4 words (128 bits) containing the IV.
+//!
+//! This function is the software equivalent of AESIVSet().  For counter and
+//! Galois/counter modes the IV is the initial counter block.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESIVSet(uint32_t ui32Base, uint32_t *pui32IVdata)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+
+    g_pui32SWAESIV[0] = pui32IVdata[0];
+    g_pui32SWAESIV[1] = pui32IVdata[1];
+    g_pui32SWAESIV[2] = pui32IVdata[2];
+    g_pui32SWAESIV[3] = pui32IVdata[3];
+}
+
+//*****************************************************************************
+//
+//! Reads the current initial vector of the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param pui32IVData is a pointer to a 4-word array that receives the IV.
+//!
+//! After SWAESDataProcess() the IV holds the chaining value (CBC) or the next
+//! counter block (CTR), so a message can be processed in several calls.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESIVRead(uint32_t ui32Base, uint32_t *pui32IVData)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+
+    pui32IVData[0] = g_pui32SWAESIV[0];
+    pui32IVData[1] = g_pui32SWAESIV[1];
+    pui32IVData[2] = g_pui32SWAESIV[2];
+    pui32IVData[3] = g_pui32SWAESIV[3];
+}
+
+//*****************************************************************************
+//
+//! Encrypts or decrypts data with the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param pui32Src is a pointer to the input data.
+//! \param pui32Dest is a pointer to the output buffer.  It may be the same
+//! as \e pui32Src.
+//! \param ui32Length is the length of the data in bytes.  It must be a
+//! multiple of 16 for ECB and CBC modes; any length is allowed in CTR mode.
+//!
+//! This function is the software equivalent of AESDataProcess().
+//!
+//! \return Returns \b true if the data was processed or \b false if the
+//! configured mode is not supported by the software engine.
+//
+//*****************************************************************************
+bool
+SWAESDataProcess(uint32_t ui32Base, uint32_t *pui32Src, uint32_t *pui32Dest,
+                 uint32_t ui32Length)
+{
+    uint32_t pui32Block[4];
+    uint32_t ui32Mode;
+    bool bEncrypt;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+
+    ui32Mode = g_ui32SWAESConfig & AES_CFG_MODE_M;
+    bEncrypt = (g_ui32SWAESConfig & AES_CFG_DIR_ENCRYPT) ? true : false;
+
+    //
+    // Counter mode is the same in both directions.
+    //
+    if(ui32Mode == AES_CFG_MODE_CTR)
+    {
+        _SWAESCTR(g_pui32SWAESIV,
+                  4 * (((g_ui32SWAESConfig & AES_CFG_CTR_WIDTH_128) >> 7) + 1),
+                  pui32Src, pui32Dest, ui32Length);
+        return(true);
+    }
+
+    //
+    // The block modes need whole blocks.
+    //
+    if(((ui32Mode != AES_CFG_MODE_ECB) && (ui32Mode != AES_CFG_MODE_CBC)) ||
+       (ui32Length % 16))
+    {
+        return(false);
+    }
+
+    for(; ui32Length; ui32Length -= 16, pui32Src += 4, pui32Dest += 4)
+    {
+        if(ui32Mode == AES_CFG_MODE_ECB)
+        {
+            if(bEncrypt)
+            {
+                _SWAESEncryptBlock(pui32Src, pui32Dest);
+            }
+            else
+            {
+                _SWAESDecryptBlock(pui32Src, pui32Dest);
+            }
+        }
+        else if(bEncrypt)
+        {
+            //
+            // CBC encryption chains the previous ciphertext into the input.
+            //
+            pui32Block[0] = pui32Src[0] ^ g_pui32SWAESIV[0];
+            pui32Block[1] = pui32Src[1] ^ g_pui32SWAESIV[1];
+            pui32Block[2] = pui32Src[2] ^ g_pui32SWAESIV[2];
+            pui32Block[3] = pui32Src[3] ^ g_pui32SWAESIV[3];
+            _SWAESEncryptBlock(pui32Block, g_pui32SWAESIV);
+            pui32Dest[0] = g_pui32SWAESIV[0];
+            pui32Dest[1] = g_pui32SWAESIV[1];
+            pui32Dest[2] = g_pui32SWAESIV[2];
+            pui32Dest[3] = g_pui32SWAESIV[3];
+        }
+        else
+        {
+            //
+            // CBC decryption chains the previous ciphertext into the output.
+            // Keep a copy of the input in case the operation is in place.
+            //
+            _SWAESDecryptBlock(pui32Src, pui32Block);
+            pui32Block[0] ^= g_pui32SWAESIV[0];
+            pui32Block[1] ^= g_pui32SWAESIV[1];
+            pui32Block[2] ^= g_pui32SWAESIV[2];
+            pui32Block[3] ^= g_pui32SWAESIV[3];
+            g_pui32SWAESIV[0] = pui32Src[0];
+            g_pui32SWAESIV[1] = pui32Src[1];
+            g_pui32SWAESIV[2] = pui32Src[2];
+            g_pui32SWAESIV[3] = pui32Src[3];
+            pui32Dest[0] = pui32Block[0];
+            pui32Dest[1] = pui32Block[1];
+            pui32Dest[2] = pui32Block[2];
+            pui32Dest[3] = pui32Block[3];
+        }
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Encrypts or decrypts and authenticates data with the software AES engine.
+//!
+//! \param ui32Base is the base address of the AES module.
+//! \param pui32Src is a pointer to the input data.
+//! \param pui32Dest is a pointer to the output buffer.
+//! \param ui32Length is the length of the data in bytes.
+//! \param pui32AuthSrc is a pointer to the additional authentication data.
+//! \param ui32AuthLength is the length of the additional authentication data
+//! in bytes.
+//! \param pui32Tag is a pointer to a 4-word array that receives the tag.
+//!
+//! This function is the software equivalent of AESDataProcessAuth() for the
+//! Galois/counter modes.  The hash subkey and the encrypted initial counter
+//! block are always computed from the key, so both
+//! \b AES_CFG_MODE_GCM_HLY0CALC and \b AES_CFG_MODE_GCM_HY0CALC behave like
+//! the autonomous mode.  The IV set with SWAESIVSet() is the initial counter
+//! block J0; for a 96-bit nonce, that is the nonce followed by a 32-bit
+//! big-endian 1.
+//!
+//! \return Returns \b true if the data was processed or \b false if the
+//! configured mode is not supported by the software engine.
+//
+//*****************************************************************************
+bool
+SWAESDataProcessAuth(uint32_t ui32Base, uint32_t *pui32Src,
+                     uint32_t *pui32Dest, uint32_t ui32Length,
+                     uint32_t *pui32AuthSrc, uint32_t ui32AuthLength,
+                     uint32_t *pui32Tag)
+{
+    uint64_t pui64HL[16], pui64HH[16];
+    uint32_t pui32H[4], pui32X[4], pui32EJ0[4];
+    uint8_t *pui8X;
+    uint64_t ui64Bits;
+    uint32_t ui32Mode, ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == AES_BASE);
+
+    //
+    // Only the Galois/counter modes are supported.
+    //
+    ui32Mode = g_ui32SWAESConfig & AES_CFG_MODE_M;
+    if((ui32Mode != AES_CFG_MODE_GCM_HLY0CALC) &&
+       (ui32Mode != AES_CFG_MODE_GCM_HY0CALC))
+    {
+        return(false);
+    }
+
+    //
+    // Derive the hash subkey H = E(K, 0) and E(K, J0).
+    //
+    pui32H[0] = pui32H[1] = pui32H[2] = pui32H[3] = 0;
+    _SWAESEncryptBlock(pui32H, pui32H);
+    _SWAESGHASHTableInit(pui32H, pui64HL, pui64HH);
+    _SWAESEncryptBlock(g_pui32SWAESIV, pui32EJ0);
+
+    //
+    // Hash the additional authentication data.
+    //
+    pui8X = (uint8_t *)pui32X;
+    pui32X[0] = pui32X[1] = pui32X[2] = pui32X[3] = 0;
+    _SWAESGHASHUpdate(pui8X, (const uint8_t *)pui32AuthSrc, ui32AuthLength,
+                      pui64HL, pui64HH);
+
+    //
+    // The ciphertext is hashed, so hash the input before decrypting and the
+    // output after encrypting.  The data counter starts at J0 + 1.
+    //
+    _SWAESCounterIncrement(g_pui32SWAESIV, 4);
+    if((g_ui32SWAESConfig & AES_CFG_DIR_ENCRYPT) == 0)
+    {
+        _SWAESGHASHUpdate(pui8X, (const uint8_t *)pui32Src, ui32Length,
+                          pui64HL, pui64HH);
+    }
+    _SWAESCTR(g_pui32SWAESIV, 4, pui32Src, pui32Dest, ui32Length);
+    if(g_ui32SWAESConfig & AES_CFG_DIR_ENCRYPT)
+    {
+        _SWAESGHASHUpdate(pui8X, (const uint8_t *)pui32Dest, ui32Length,
+                          pui64HL, pui64HH);
+    }
+
+    //
+    // Hash the bit lengths of both inputs as two big-endian 64-bit values.
+    //
+    ui64Bits = (uint64_t)ui32AuthLength * 8;
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        pui8X[7 - ui32Idx] ^= (uint8_t)(ui64Bits >> (8 * ui32Idx));
+    }
+    ui64Bits = (uint64_t)ui32Length * 8;
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        pui8X[15 - ui32Idx] ^= (uint8_t)(ui64Bits >> (8 * ui32Idx));
+    }
+    _SWAESGHASHMultiply(pui8X, pui64HL, pui64HH);
+
+    //
+    // The tag is the hash encrypted with the initial counter block.
+    //
+    pui32Tag[0] = pui32X[0] ^ pui32EJ0[0];
+    pui32Tag[1] = pui32X[1] ^ pui32EJ0[1];
+    pui32Tag[2] = pui32X[2] ^ pui32EJ0[2];
+    pui32Tag[3] = pui32X[3] ^ pui32EJ0[3];
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,442 @@
+//*****************************************************************************
+//
+// sw_sha256.c - Software SHA-224/SHA-256 functions.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup sw_sha256_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_shamd5.h"
+#include "driverlib/debug.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/sw_sha256.h"
+
+//*****************************************************************************
+//
+// The SHA-256 round constants.
+//
+//*****************************************************************************
+static const uint32_t g_pui32SWSHA256K[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+//*****************************************************************************
+//
+// The initial hash values for SHA-224 and SHA-256.
+//
+//*****************************************************************************
+static const uint32_t g_pui32SWSHA224Init[8] =
+{
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+};
+static const uint32_t g_pui32SWSHA256Init[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+//*****************************************************************************
+//
+// Helper macros for the compression function.  One round is written so that
+// eight consecutive rounds can be unrolled by rotating the names of the
+// working variables instead of moving their values.
+//
+//*****************************************************************************
+#define ROTR(x, n)              (((x) >> (n)) | ((x) << (32 - (n))))
+#define CH(x, y, z)             ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z)            (((x) & (y)) | ((z) & ((x) | (y))))
+#define SIGMA0(x)               (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define SIGMA1(x)               (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define GAMMA0(x)               (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define GAMMA1(x)               (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+#define ROUND(a, b, c, d, e, f, g, h, i)                                      \
+    do                                                                        \
+    {                                                                         \
+        ui32T = ((h) + SIGMA1(e) + CH(e, f, g) + g_pui32SWSHA256K[i] +        \
+                 pui32W[i]);                                                  \
+        (d) += ui32T;                                                         \
+        (h) = ui32T + SIGMA0(a) + MAJ(a, b, c);                               \
+    }                                                                         \
+    while(0)
+
+//*****************************************************************************
+//
+// The state of the software hash engine.
+//
+//*****************************************************************************
+static uint32_t g_ui32SWSHAMD5Mode;
+static uint32_t g_pui32SWSHAMD5HMACKey[16];
+
+//*****************************************************************************
+//
+// Processes one 64-byte block into the hash state.
+//
+//*****************************************************************************
+static void
+_SWSHA256Block(uint32_t *pui32State, const uint8_t *pui8Block)
+{
+    uint32_t pui32W[64];
+    uint32_t ui32A, ui32B, ui32C, ui32D, ui32E, ui32F, ui32G, ui32H;
+    uint32_t ui32T, ui32Idx;
+
+    //
+    // Load the block as big-endian words and expand the message schedule.
+    //
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++, pui8Block += 4)
+    {
+        pui32W[ui32Idx] = (((uint32_t)pui8Block[0] << 24) |
+                           ((uint32_t)pui8Block[1] << 16) |
+                           ((uint32_t)pui8Block[2] << 8) |
+                           (uint32_t)pui8Block[3]);
+    }
+    for(; ui32Idx < 64; ui32Idx++)
+    {
+        pui32W[ui32Idx] = (GAMMA1(pui32W[ui32Idx - 2]) + pui32W[ui32Idx - 7] +
+                           GAMMA0(pui32W[ui32Idx - 15]) +
+                           pui32W[ui32Idx - 16]);
+    }
+
+    ui32A = pui32State[0];
+    ui32B = pui32State[1];
+    ui32C = pui32State[2];
+    ui32D = pui32State[3];
+    ui32E = pui32State[4];
+    ui32F = pui32State[5];
+    ui32G = pui32State[6];
+    ui32H = pui32State[7];
+
+    //
+    // Run the 64 rounds, eight at a time.
+    //
+    for(ui32Idx = 0; ui32Idx < 64; ui32Idx += 8)
+    {
+        ROUND(ui32A, ui32B, ui32C, ui32D, ui32E, ui32F, ui32G, ui32H,
+              ui32Idx + 0);
+        ROUND(ui32H, ui32A, ui32B, ui32C, ui32D, ui32E, ui32F, ui32G,
+              ui32Idx + 1);
+        ROUND(ui32G, ui32H, ui32A, ui32B, ui32C, ui32D, ui32E, ui32F,
+              ui32Idx + 2);
+        ROUND(ui32F, ui32G, ui32H, ui32A, ui32B, ui32C, ui32D, ui32E,
+              ui32Idx + 3);
+        ROUND(ui32E, ui32F, ui32G, ui32H, ui32A, ui32B, ui32C, ui32D,
+              ui32Idx + 4);
+        ROUND(ui32D, ui32E, ui32F, ui32G, ui32H, ui32A, ui32B, ui32C,
+              ui32Idx + 5);
+        ROUND(ui32C, ui32D, ui32E, ui32F, ui32G, ui32H, ui32A, ui32B,
+              ui32Idx + 6);
+        ROUND(ui32B, ui32C, ui32D, ui32E, ui32F, ui32G, ui32H, ui32A,
+              ui32Idx + 7);
+    }
+
+    pui32State[0] += ui32A;
+    pui32State[1] += ui32B;
+    pui32State[2] += ui32C;
+    pui32State[3] += ui32D;
+    pui32State[4] += ui32E;
+    pui32State[5] += ui32F;
+    pui32State[6] += ui32G;
+    pui32State[7] += ui32H;
+}
+
+//*****************************************************************************
+//
+// Starts a hash of the configured algorithm.
+//
+//*****************************************************************************
+static void
+_SWSHA256Start(uint32_t *pui32State)
+{
+    const uint32_t *pui32Init;
+    uint32_t ui32Idx;
+
+    pui32Init = (((g_ui32SWSHAMD5Mode & SHAMD5_MODE_ALGO_M) ==
+                  SHAMD5_MODE_ALGO_SHA224) ? g_pui32SWSHA224Init :
+                 g_pui32SWSHA256Init);
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        pui32State[ui32Idx] = pui32Init[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+// Hashes the rest of a message, pads it and writes the digest in byte order.
+// ui32Prefix is the number of bytes already hashed with _SWSHA256Block(),
+// which must be a multiple of 64.  Returns the digest length in bytes.
+//
+//*****************************************************************************
+static uint32_t
+_SWSHA256Finish(uint32_t *pui32State, const uint8_t *pui8Data,
+                uint32_t ui32Length, uint32_t ui32Prefix, uint8_t *pui8Digest)
+{
+    uint8_t pui8Block[64];
+    uint64_t ui64Bits;
+    uint32_t ui32Idx, ui32Count;
+
+    ui64Bits = ((uint64_t)ui32Prefix + ui32Length) * 8;
+
+    //
+    // Hash the whole blocks straight from the caller's buffer.
+    //
+    for(; ui32Length >= 64; ui32Length -= 64, pui8Data += 64)
+    {
+        _SWSHA256Block(pui32State, pui8Data);
+    }
+
+    //
+    // Copy the tail, append the 1 bit and pad with zeros.  If there is no
+    // room left for the length, that takes one more block.
+    //
+    for(ui32Idx = 0; ui32Idx < ui32Length; ui32Idx++)
+    {
+        pui8Block[ui32Idx] = pui8Data[ui32Idx];
+    }
+    pui8Block[ui32Idx++] = 0x80;
+    if(ui32Idx > 56)
+    {
+        for(; ui32Idx < 64; ui32Idx++)
+        {
+            pui8Block[ui32Idx] = 0;
+        }
+        _SWSHA256Block(pui32State, pui8Block);
+        ui32Idx = 0;
+    }
+    for(; ui32Idx < 56; ui32Idx++)
+    {
+        pui8Block[ui32Idx] = 0;
+    }
+
+    //
+    // Append the message length in bits as a big-endian 64-bit value.
+    //
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        pui8Block[63 - ui32Idx] = (uint8_t)(ui64Bits >> (8 * ui32Idx));
+    }
+    _SWSHA256Block(pui32State, pui8Block);
+
+    //
+    // Write out the digest, which is seven words for SHA-224.
+    //
+    ui32Count = (((g_ui32SWSHAMD5Mode & SHAMD5_MODE_ALGO_M) ==
+                  SHAMD5_MODE_ALGO_SHA224) ? 7 : 8);
+    for(ui32Idx = 0; ui32Idx < ui32Count; ui32Idx++)
+    {
+        *pui8Digest++ = (uint8_t)(pui32State[ui32Idx] >> 24);
+        *pui8Digest++ = (uint8_t)(pui32State[ui32Idx] >> 16);
+        *pui8Digest++ = (uint8_t)(pui32State[ui32Idx] >> 8);
+        *pui8Digest++ = (uint8_t)pui32State[ui32Idx];
+    }
+
+    return(ui32Count * 4);
+}
+
+//*****************************************************************************
+//
+//! Configures the software hash engine.
+//!
+//! \param ui32Base is the base address of the SHA/MD5 module.
+//! \param ui32Mode is the hash algorithm to use.
+//!
+//! This function is the software equivalent of SHAMD5ConfigSet().  The
+//! software engine supports \b SHAMD5_ALGO_SHA224, \b SHAMD5_ALGO_SHA256,
+//! \b SHAMD5_ALGO_HMAC_SHA224 and \b SHAMD5_ALGO_HMAC_SHA256.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5ConfigSet(uint32_t ui32Base, uint32_t ui32Mode)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == SHAMD5_BASE);
+    ASSERT((ui32Mode == SHAMD5_ALGO_SHA224) ||
+           (ui32Mode == SHAMD5_ALGO_SHA256) ||
+           (ui32Mode == SHAMD5_ALGO_HMAC_SHA224) ||
+           (ui32Mode == SHAMD5_ALGO_HMAC_SHA256));
+
+    g_ui32SWSHAMD5Mode = ui32Mode;
+}
+
+//*****************************************************************************
+//
+//! Hashes data with the software hash engine.
+//!
+//! \param ui32Base is the base address of the SHA/MD5 module.
+//! \param pui32DataSrc is a pointer to the data to hash.
+//! \param ui32DataLength is the length of the data in bytes.
+//! \param pui32HashResult is a pointer to the array that receives the
+//! digest.
+//!
+//! This function is the software equivalent of SHAMD5DataProcess().  Unlike
+//! the hardware, any data length is accepted.  The digest is written in the
+//! standard byte order, so it is 7 words for SHA-224 and 8 words for
+//! SHA-256.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5DataProcess(uint32_t ui32Base, uint32_t *pui32DataSrc,
+                    uint32_t ui32DataLength, uint32_t *pui32HashResult)
+{
+    uint32_t pui32State[8];
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == SHAMD5_BASE);
+
+    _SWSHA256Start(pui32State);
+    _SWSHA256Finish(pui32State, (const uint8_t *)pui32DataSrc, ui32DataLength,
+                    0, (uint8_t *)pui32HashResult);
+}
+
+//*****************************************************************************
+//
+//! Sets the key used by the software HMAC.
+//!
+//! \param ui32Base is the base address of the SHA/MD5 module.
+//! \param pui32Src is a pointer to the 16-word array of the HMAC key.
+//!
+//! This function is the software equivalent of SHAMD5HMACKeySet().  As with
+//! the hardware, a key shorter than 64 bytes must be padded with zeros, and a
+//! longer key must first be hashed by the caller.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HMACKeySet(uint32_t ui32Base, uint32_t *pui32Src)
+{
+    uint32_t ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == SHAMD5_BASE);
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        g_pui32SWSHAMD5HMACKey[ui32Idx] = pui32Src[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+//! Computes an HMAC with the software hash engine.
+//!
+//! \param ui32Base is the base address of the SHA/MD5 module.
+//! \param pui32DataSrc is a pointer to the data to authenticate.
+//! \param ui32DataLength is the length of the data in bytes.
+//! \param pui32HashResult is a pointer to the array that receives the HMAC.
+//!
+//! This function is the software equivalent of SHAMD5HMACProcess(), using the
+//! key set with SWSHAMD5HMACKeySet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HMACProcess(uint32_t ui32Base, uint32_t *pui32DataSrc,
+                    uint32_t ui32DataLength, uint32_t *pui32HashResult)
+{
+    uint32_t pui32State[8], pui32Pad[16], pui32Inner[8];
+    uint32_t ui32Idx, ui32Count;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(ui32Base == SHAMD5_BASE);
+
+    //
+    // Compute the inner hash, H((K ^ ipad) || data).
+    //
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui32Pad[ui32Idx] = g_pui32SWSHAMD5HMACKey[ui32Idx] ^ 0x36363636;
+    }
+    _SWSHA256Start(pui32State);
+    _SWSHA256Block(pui32State, (const uint8_t *)pui32Pad);
+    ui32Count = _SWSHA256Finish(pui32State, (const uint8_t *)pui32DataSrc,
+                                ui32DataLength, 64, (uint8_t *)pui32Inner);
+
+    //
+    // Compute the outer hash, H((K ^ opad) || inner).
+    //
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui32Pad[ui32Idx] = g_pui32SWSHAMD5HMACKey[ui32Idx] ^ 0x5c5c5c5c;
+    }
+    _SWSHA256Start(pui32State);
+    _SWSHA256Block(pui32State, (const uint8_t *)pui32Pad);
+    _SWSHA256Finish(pui32State, (const uint8_t *)pui32Inner, ui32Count, 64,
+                    (uint8_t *)pui32HashResult);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -101,6 +101,20 @@ static const uint32_t g_pui32Xtals[] = {1000000,  1843200,  2000000,  2457600,
 #define PLL_N_TO_REG(n)      ((uint32_t)(n - 1) << SYSCTL_PLLFREQ1_N_S)
 #define PLL_Q_TO_REG(q)      ((uint32_t)(q - 1) << SYSCTL_PLLFREQ1_Q_S)
 
+//*****************************************************************************
+//
+// The limits used by SysCtlPLLSolve() when searching for PLL settings.  The
+// VCO range and the lowest reference frequency match the settings in the
+// g_pppui32XTALtoVCO table.
+//
+//*****************************************************************************
+#define PLL_XTAL_MIN   5000000
+#define PLL_XTAL_MAX   25000000
+#define PLL_REF_MIN    2000000
+#define PLL_VCO_MIN    320000000
+#define PLL_VCO_MAX    480000000
+#define PLL_SYSCLK_MAX 120000000
+
 //*****************************************************************************
 //
 // Look up of the values that go into the PLLFREQ0 and PLLFREQ1 registers.
@@ -285,6 +299,15 @@ static const uint32_t g_pui32VCOFrequencies[MAX_VCO_ENTRIES] = {
     240000000, // VCO 480
 };
 
+//*****************************************************************************
+//
+// The system clock frequency last configured by SysCtlClockSet(),
+// SysCtlClockFreqSet() or SysCtlClockFreqSetPLL().  All devices run from the
+// 16-MHz PIOSC out of reset.
+//
+//*****************************************************************************
+static uint32_t g_ui32SysCtlClockFreq = 16000000;
+
 //*****************************************************************************
 //
 // The base addresses of the various peripheral control registers.
@@ -706,6 +729,10 @@ void SysCtlPeripheralReset(uint32_t ui32Peripheral) {
 //! to ensure that the peripheral is not accessed during this brief time
 //! period.
 //!
+//! \note When a peripheral is shared by several drivers, PwrMgrAcquire() and
+//! PwrMgrRelease() keep a reference count so that one driver cannot turn the
+//! peripheral off while another is still using it.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -1522,6 +1549,9 @@ void SysCtlSleep(void) {
 //! SysCtlPeripheralClockGating(), otherwise all peripherals continue to
 //! operate).
 //!
+//! \note IdleEnter() chooses between sleep, deep-sleep and hibernation from
+//! the time to the next deadline and keeps the time base across them.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -1615,6 +1645,10 @@ void SysCtlResetCauseClear(uint32_t ui32Causes) {
 //! for a particular timer value being exceeded or processing the timer
 //! interrupt to determine when a particular time period has elapsed.
 //!
+//! \note DelayUs(), DelayNs() and DelayCycles() measure delays on the cycle
+//! counter, follow system clock changes, and take a time rather than a loop
+//! count.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -2120,6 +2154,11 @@ uint32_t SysCtlClockFreqSet(uint32_t ui32Config, uint32_t ui32SysClock) {
             HWREG(SYSCTL_RSCLKCFG) = ui32RSClkConfig;
         } else {
             ui32SysClock = 0;
+
+            //
+            // The device is left running from PIOSC.
+            //
+            g_ui32SysCtlClockFreq = 16000000;
         }
     } else {
         //
@@ -2202,9 +2241,340 @@ uint32_t SysCtlClockFreqSet(uint32_t ui32Config, uint32_t ui32SysClock) {
     //
     HWREG(SYSCTL_RSCLKCFG) &= ~(SYSCTL_RSCLKCFG_OSCSRC_M);
 
+    //
+    // Remember the new frequency for SysCtlClockFreqGet().
+    //
+    if (ui32SysClock) {
+        g_ui32SysCtlClockFreq = ui32SysClock;
+    }
+
     return (ui32SysClock);
 }
 
+//*****************************************************************************
+//
+//! Computes the PLL and memory timing settings for a system clock frequency.
+//!
+//! \param ui32Xtal is the frequency in Hz of the PLL reference oscillator.
+//! \param ui32SysClock is the requested system clock frequency in Hz.
+//! \param psConfig is a pointer to the structure that receives the settings.
+//!
+//! This function calculates the PLL MINT, MFRAC, N and Q values and the flash
+//! and EEPROM memory timing that give the system clock closest to
+//! \e ui32SysClock for any reference frequency from 5 MHz to 25 MHz, rather
+//! than only the crystal and VCO combinations that are listed in the tables
+//! used by SysCtlClockFreqSet().  The search covers every Q divider that
+//! places the VCO in the 320-MHz to 480-MHz range and every N divider that
+//! keeps the PLL reference at or above 2 MHz, and picks the smallest
+//! frequency error.  When two settings give the same error, an integer
+//! multiplier (MFRAC of zero) is preferred since it gives the lowest jitter,
+//! followed by the smallest N since it gives the highest reference frequency.
+//!
+//! The system divider is fixed at divide-by-2, as in SysCtlClockFreqSet(), so
+//! the resulting system clock is VCO / (Q * 2).  The achieved frequency is
+//! returned in the \e ui32SysClock member of \e psConfig and the difference
+//! from the requested frequency in the \e i32Error member.
+//!
+//! This function does not access the hardware, so it may be called before the
+//! clocks are configured, or run on a host to produce constant
+//! \e tSysCtlPLLConfig initializers so that no calculation is done at start
+//! up.  The result is applied with SysCtlClockFreqSetPLL().
+//!
+//! \b Example: Run from a 12.288-MHz audio crystal at 98.304 MHz.
+//!
+//! \verbatim
+//! tSysCtlPLLConfig sPLL;
+//!
+//! if(SysCtlPLLSolve(12288000, 98304000, &sPLL))
+//! {
+//!     SysCtlClockFreqSetPLL(SYSCTL_OSC_MAIN, &sPLL);
+//! }
+//! \endverbatim
+//!
+//! \return Returns \b true if a setting was found or \b false if the
+//! reference or requested frequency cannot be reached.
+//
+//*****************************************************************************
+bool SysCtlPLLSolve(uint32_t ui32Xtal, uint32_t ui32SysClock, tSysCtlPLLConfig *psConfig) {
+    uint32_t ui32Q, ui32QMax, ui32N, ui32M, ui32BestM, ui32BestN, ui32BestQ;
+    uint32_t ui32MInt, ui32MFrac;
+    uint64_t ui64VCO, ui64Actual, ui64Target, ui64Error, ui64BestError;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig);
+
+    //
+    // The reference must be within the main oscillator range and the system
+    // clock must not exceed the fastest memory timing.
+    //
+    if ((ui32Xtal < PLL_XTAL_MIN) || (ui32Xtal > PLL_XTAL_MAX) || (ui32SysClock == 0) || (ui32SysClock > PLL_SYSCLK_MAX)) {
+        return (false);
+    }
+
+    //
+    // Work in millihertz so that the error of fractional settings can be
+    // compared without floating point.
+    //
+    ui64Target    = (uint64_t)ui32SysClock * 1000;
+    ui64BestError = UINT64_MAX;
+    ui32BestM     = 0;
+    ui32BestN     = 0;
+    ui32BestQ     = 0;
+
+    //
+    // Only the Q dividers that place the VCO for the requested frequency
+    // inside the VCO range need to be considered.
+    //
+    ui32Q    = (PLL_VCO_MIN + (2 * ui32SysClock) - 1) / (2 * ui32SysClock);
+    ui32QMax = PLL_VCO_MAX / (2 * ui32SysClock);
+
+    if (ui32Q == 0) {
+        ui32Q = 1;
+    }
+
+    if (ui32QMax > 32) {
+        ui32QMax = 32;
+    }
+
+    for (; ui32Q <= ui32QMax; ui32Q++) {
+        //
+        // The VCO frequency that gives the requested system clock exactly.
+        //
+        ui64VCO = (uint64_t)ui32SysClock * 2 * ui32Q;
+
+        for (ui32N = 1; (ui32N <= 32) && ((ui32Xtal / ui32N) >= PLL_REF_MIN); ui32N++) {
+            //
+            // Calculate the multiplier, in 1/1024 steps, that is closest to
+            // the requested VCO frequency for this reference.
+            //
+            ui32M = (uint32_t)(((ui64VCO * ui32N * 1024) + (ui32Xtal / 2)) / ui32Xtal);
+
+            //
+            // MINT must fit in 10 bits and may not be zero.
+            //
+            if ((ui32M < 1024) || ((ui32M >> 10) > SYSCTL_PLLFREQ0_MINT_M)) {
+                continue;
+            }
+
+            //
+            // Make sure the rounding did not move the VCO out of range.
+            //
+            ui64Actual = ((uint64_t)ui32Xtal * ui32M) / (ui32N * 1024);
+
+            if ((ui64Actual < PLL_VCO_MIN) || (ui64Actual > PLL_VCO_MAX)) {
+                continue;
+            }
+
+            //
+            // Calculate the resulting system clock and its error.
+            //
+            ui64Actual = (((uint64_t)ui32Xtal * ui32M * 1000) + (ui32N * 1024 * ui32Q)) / (ui32N * 2048 * ui32Q);
+
+            if (ui64Actual > ((uint64_t)PLL_SYSCLK_MAX * 1000)) {
+                continue;
+            }
+
+            ui64Error = (ui64Actual > ui64Target) ? (ui64Actual - ui64Target) : (ui64Target - ui64Actual);
+
+            //
+            // Keep this setting if it is closer, or equally close and uses an
+            // integer multiplier when the best so far does not.  Smaller N
+            // values are tried first so they win any remaining tie.
+            //
+            if ((ui64Error < ui64BestError) || ((ui64Error == ui64BestError) && ((ui32M & 0x3ff) == 0) && ((ui32BestM & 0x3ff) != 0))) {
+                ui64BestError = ui64Error;
+                ui32BestM     = ui32M;
+                ui32BestN     = ui32N;
+                ui32BestQ     = ui32Q;
+            }
+        }
+    }
+
+    //
+    // Fail if no setting could reach the requested frequency.
+    //
+    if (ui32BestM == 0) {
+        return (false);
+    }
+
+    //
+    // Return the register values and the achieved frequencies.
+    //
+    psConfig->ui32Xtal      = ui32Xtal;
+    ui32MInt                = ui32BestM >> 10;
+    ui32MFrac               = ui32BestM & 0x3ff;
+    psConfig->ui32PLLFreq0  = PLL_M_TO_REG(ui32MInt, ui32MFrac);
+    psConfig->ui32PLLFreq1  = PLL_N_TO_REG(ui32BestN) | PLL_Q_TO_REG(ui32BestQ);
+    psConfig->ui32VCO       = (uint32_t)(((uint64_t)ui32Xtal * ui32BestM) / (ui32BestN * 1024));
+    psConfig->ui32SysClock  = (uint32_t)(((uint64_t)ui32Xtal * ui32BestM) / (ui32BestN * 2048 * ui32BestQ));
+    psConfig->i32Error      = (int32_t)psConfig->ui32SysClock - (int32_t)ui32SysClock;
+    psConfig->ui32MemTiming = _SysCtlMemTimingGet(psConfig->ui32SysClock);
+
+    return (true);
+}
+
+//*****************************************************************************
+//
+//! Configures the system clock from a calculated PLL setting.
+//!
+//! \param ui32Config is the oscillator that drives the PLL.
+//! \param psConfig is a pointer to the settings from SysCtlPLLSolve().
+//!
+//! This function runs the system clock from the PLL using the MINT, MFRAC, N,
+//! Q and memory timing values in \e psConfig, which were produced by
+//! SysCtlPLLSolve() either at run time or ahead of time.  The sequence used
+//! to switch to the new frequency is the same as in SysCtlClockFreqSet().
+//!
+//! The \e ui32Config parameter must be one of the following values:
+//!
+//! - \b SYSCTL_OSC_MAIN to use the main oscillator, whose frequency is taken
+//!   from the \e ui32Xtal member of \e psConfig
+//! - \b SYSCTL_OSC_INT to use the 16-MHz precision internal oscillator, in
+//!   which case \e psConfig must have been calculated for 16 MHz
+//!
+//! \note This function cannot be used with TM4C123 devices.
+//!
+//! \return The configured system clock frequency in Hz or zero if the
+//! value could not be changed due to a parameter error, main oscillator
+//! failure or PLL lock failure.
+//
+//*****************************************************************************
+uint32_t SysCtlClockFreqSetPLL(uint32_t ui32Config, const tSysCtlPLLConfig *psConfig) {
+    int32_t i32Timeout;
+    uint32_t ui32MOSCCTL, ui32Delay, ui32OscSelect, ui32RSClkConfig;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psConfig);
+
+    //
+    // TM4C123 devices should not use this function.
+    //
+    if (CLASS_IS_TM4C123) {
+        return (0);
+    }
+
+    if ((ui32Config & 0x38) == SYSCTL_OSC_INT) {
+        //
+        // The settings must have been calculated for the PIOSC.
+        //
+        ASSERT(psConfig->ui32Xtal == 16000000);
+
+        ui32OscSelect = SYSCTL_RSCLKCFG_OSCSRC_PIOSC | SYSCTL_RSCLKCFG_PLLSRC_PIOSC;
+    } else if ((ui32Config & 0x38) == SYSCTL_OSC_MAIN) {
+        ui32OscSelect = SYSCTL_RSCLKCFG_OSCSRC_MOSC | SYSCTL_RSCLKCFG_PLLSRC_MOSC;
+
+        //
+        // Clear MOSC power down, high oscillator range setting, and no crystal
+        // present setting.
+        //
+        ui32MOSCCTL = HWREG(SYSCTL_MOSCCTL) & ~(SYSCTL_MOSCCTL_OSCRNG | SYSCTL_MOSCCTL_PWRDN | SYSCTL_MOSCCTL_NOXTAL);
+
+        //
+        // Increase the drive strength for MOSC of 10 MHz and above.
+        //
+        if (psConfig->ui32Xtal >= 10000000) {
+            ui32MOSCCTL |= SYSCTL_MOSCCTL_OSCRNG;
+        }
+
+        HWREG(SYSCTL_MOSCCTL) = ui32MOSCCTL;
+
+        //
+        // Timeout using the legacy delay value.
+        //
+        for (ui32Delay = 524288; ui32Delay > 0; ui32Delay--) {
+            if (HWREG(SYSCTL_RIS) & SYSCTL_RIS_MOSCPUPRIS) {
+                break;
+            }
+        }
+
+        //
+        // If the main oscillator failed to start up then do not switch to
+        // it and return.
+        //
+        if (ui32Delay == 0) {
+            return (0);
+        }
+    } else {
+        return (0);
+    }
+
+    //
+    // Set the memory timings for the maximum external frequency since this
+    // could be a switch to PIOSC or to MOSC which can be up to 25MHz.
+    //
+    HWREG(SYSCTL_MEMTIM0) = _SysCtlMemTimingGet(25000000);
+
+    //
+    // Clear the old PLL divider and source and switch back to PIOSC.
+    //
+    ui32RSClkConfig = HWREG(SYSCTL_RSCLKCFG) &
+                      ~(SYSCTL_RSCLKCFG_PSYSDIV_M | SYSCTL_RSCLKCFG_OSCSRC_M | SYSCTL_RSCLKCFG_PLLSRC_M | SYSCTL_RSCLKCFG_USEPLL);
+    HWREG(SYSCTL_RSCLKCFG) = ui32RSClkConfig | SYSCTL_RSCLKCFG_MEMTIMU;
+
+    //
+    // Set the oscillator source.
+    //
+    HWREG(SYSCTL_RSCLKCFG) |= ui32OscSelect;
+
+    //
+    // Set the M, N and Q values and preserve the power state of the main PLL.
+    //
+    HWREG(SYSCTL_PLLFREQ1) = psConfig->ui32PLLFreq1;
+    HWREG(SYSCTL_PLLFREQ0) = (psConfig->ui32PLLFreq0 | (HWREG(SYSCTL_PLLFREQ0) & SYSCTL_PLLFREQ0_PLLPWR));
+
+    //
+    // Set the Flash and EEPROM timing values.
+    //
+    HWREG(SYSCTL_MEMTIM0) = psConfig->ui32MemTiming;
+
+    //
+    // Trigger the PLL to lock to the new frequency, or power it up.
+    //
+    if (HWREG(SYSCTL_PLLFREQ0) & SYSCTL_PLLFREQ0_PLLPWR) {
+        HWREG(SYSCTL_RSCLKCFG) |= SYSCTL_RSCLKCFG_NEWFREQ;
+    } else {
+        HWREG(SYSCTL_PLLFREQ0) |= SYSCTL_PLLFREQ0_PLLPWR;
+    }
+
+    //
+    // Wait until the PLL has locked.
+    //
+    for (i32Timeout = 32768; i32Timeout > 0; i32Timeout--) {
+        if ((HWREG(SYSCTL_PLLSTAT) & SYSCTL_PLLSTAT_LOCK)) {
+            break;
+        }
+    }
+
+    //
+    // Fail if the PLL did not lock, leaving the device running from PIOSC.
+    //
+    if (i32Timeout == 0) {
+        HWREG(SYSCTL_RSCLKCFG) &= ~(SYSCTL_RSCLKCFG_OSCSRC_M);
+        g_ui32SysCtlClockFreq = 16000000;
+        return (0);
+    }
+
+    //
+    // Switch over to the PLL with the system divider set to divide-by-2.
+    //
+    ui32RSClkConfig = HWREG(SYSCTL_RSCLKCFG);
+    ui32RSClkConfig |= (1 << SYSCTL_RSCLKCFG_PSYSDIV_S) | ui32OscSelect | SYSCTL_RSCLKCFG_USEPLL | SYSCTL_RSCLKCFG_MEMTIMU;
+    HWREG(SYSCTL_RSCLKCFG) = ui32RSClkConfig;
+
+    //
+    // Finally change the OSCSRC back to PIOSC
+    //
+    HWREG(SYSCTL_RSCLKCFG) &= ~(SYSCTL_RSCLKCFG_OSCSRC_M);
+
+    g_ui32SysCtlClockFreq = psConfig->ui32SysClock;
+
+    return (psConfig->ui32SysClock);
+}
+
 //*****************************************************************************
 //
 //! Sets the clocking of the device.
@@ -2421,6 +2791,29 @@ void SysCtlClockSet(uint32_t ui32Config) {
     // Delay for a little bit so that the system divider takes effect.
     //
     SysCtlDelay(16);
+
+    //
+    // Remember the new frequency for SysCtlClockFreqGet().
+    //
+    g_ui32SysCtlClockFreq = SysCtlClockGet();
+}
+
+//*****************************************************************************
+//
+//! Gets the configured system clock frequency.
+//!
+//! This function returns the system clock frequency that was last configured
+//! by SysCtlClockFreqSet() or SysCtlClockFreqSetPLL() on TM4C129 devices, or
+//! by SysCtlClockSet() on TM4C123 devices, or 16 MHz if the clock has not
+//! been changed since reset.  Unlike SysCtlClockGet(), it does not read the
+//! clock registers, so it is cheap enough for drivers that need to follow
+//! clock changes to call it each time they run.
+//!
+//! \return The system clock frequency in Hz.
+//
+//*****************************************************************************
+uint32_t SysCtlClockFreqGet(void) {
+    return (g_ui32SysCtlClockFreq);
 }
 
 //*****************************************************************************
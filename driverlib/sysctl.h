@@ -574,6 +574,52 @@ extern "C"
 #define SYSCTL_ALTCLK_RTCOSC    0x00000003
 #define SYSCTL_ALTCLK_LFIOSC    0x00000004
 
+//*****************************************************************************
+//
+//! This structure holds the PLL and memory timing settings that are calculated
+//! by SysCtlPLLSolve() and applied by SysCtlClockFreqSetPLL().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The frequency in Hz of the oscillator that drives the PLL.
+    //
+    uint32_t ui32Xtal;
+
+    //
+    //! The value for the PLLFREQ0 register, holding MINT and MFRAC.
+    //
+    uint32_t ui32PLLFreq0;
+
+    //
+    //! The value for the PLLFREQ1 register, holding N and Q.
+    //
+    uint32_t ui32PLLFreq1;
+
+    //
+    //! The value for the MEMTIM0 register, holding the flash and EEPROM
+    //! timing for the system clock.
+    //
+    uint32_t ui32MemTiming;
+
+    //
+    //! The resulting PLL VCO frequency in Hz.
+    //
+    uint32_t ui32VCO;
+
+    //
+    //! The resulting system clock frequency in Hz.
+    //
+    uint32_t ui32SysClock;
+
+    //
+    //! The resulting system clock minus the requested frequency, in Hz.
+    //
+    int32_t i32Error;
+}
+tSysCtlPLLConfig;
+
 //*****************************************************************************
 //
 // Prototypes for the APIs.
@@ -618,6 +664,7 @@ extern void SysCtlMOSCConfigSet(uint32_t ui32Config);
 extern uint32_t SysCtlPIOSCCalibrate(uint32_t ui32Type);
 extern void SysCtlClockSet(uint32_t ui32Config);
 extern uint32_t SysCtlClockGet(void);
+extern uint32_t SysCtlClockFreqGet(void);
 extern void SysCtlDeepSleepClockSet(uint32_t ui32Config);
 extern void SysCtlDeepSleepClockConfigSet(uint32_t ui32Div,
                                           uint32_t ui32Config);
@@ -643,6 +690,10 @@ extern void SysCtlVoltageEventConfig(uint32_t ui32Config);
 extern uint32_t SysCtlVoltageEventStatus(void);
 extern void SysCtlVoltageEventClear(uint32_t ui32Status);
 extern bool SysCtlVCOGet(uint32_t ui32Crystal, uint32_t *pui32VCOFrequency);
+extern bool SysCtlPLLSolve(uint32_t ui32Xtal, uint32_t ui32SysClock,
+                           tSysCtlPLLConfig *psConfig);
+extern uint32_t SysCtlClockFreqSetPLL(uint32_t ui32Config,
+                                      const tSysCtlPLLConfig *psConfig);
 
 //*****************************************************************************
 //
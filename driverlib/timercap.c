@@ -0,0 +1,678 @@
+//*****************************************************************************
+//
+// timercap.c - uDMA-driven timer input capture and measurement.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup timercap_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_timer.h"
+#include "inc/hw_types.h"
+#include "driverlib/debug.h"
+#include "driverlib/gpio.h"
+#include "driverlib/timer.h"
+#include "driverlib/timercap.h"
+#include "driverlib/udma.h"
+
+//*****************************************************************************
+//
+// Maps a half of the ring (0 for the first, 1 for the second) to the uDMA
+// control structure that fills it.
+//
+//*****************************************************************************
+static const uint32_t g_pui32TimerCapSelect[2] =
+{
+    UDMA_PRI_SELECT, UDMA_ALT_SELECT
+};
+
+//*****************************************************************************
+//
+// The running totals kept by TimerCapStatsGet() while it consumes intervals.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Periods;
+    uint32_t ui32Min;
+    uint32_t ui32Max;
+    uint64_t ui64Sum;
+    uint64_t ui64High;
+}
+tTimerCapTotals;
+
+//*****************************************************************************
+//
+// Loads the control structure for one half of the ring.
+//
+//*****************************************************************************
+static void
+_TimerCapHalfLoad(tTimerCap *psCap, uint32_t ui32Half)
+{
+    uint32_t ui32Count;
+
+    ui32Count = psCap->ui32Size / 2;
+    uDMAChannelTransferSet(psCap->ui32Channel |
+                           g_pui32TimerCapSelect[ui32Half],
+                           UDMA_MODE_PINGPONG,
+                           (void *)(psCap->ui32Base + TIMER_O_TAR),
+                           psCap->pui32Buffer + (ui32Half * ui32Count),
+                           ui32Count);
+}
+
+//*****************************************************************************
+//
+// Returns the number of timestamps written to the ring since the engine was
+// started, modulo 2^32.
+//
+//*****************************************************************************
+static uint32_t
+_TimerCapWritten(tTimerCap *psCap)
+{
+    uint32_t ui32Laps, ui32Left;
+
+    //
+    // The half being filled follows from the number of halves completed.
+    // Read its remaining count until the interrupt handler is seen not to
+    // have moved on in the meantime.
+    //
+    do
+    {
+        ui32Laps = psCap->ui32Laps;
+        ui32Left = uDMAChannelSizeGet(psCap->ui32Channel |
+                                      g_pui32TimerCapSelect[ui32Laps & 1]);
+    }
+    while(ui32Laps != psCap->ui32Laps);
+
+    return(((ui32Laps + 1) * (psCap->ui32Size / 2)) - ui32Left);
+}
+
+//*****************************************************************************
+//
+// Returns the parity of the indices of the timestamps of rising edges, or ~0
+// if it can not be told.  The pin is sampled between two readings of the
+// capture count that agree, so that the level is the one left by the last
+// capture.  The next capture moves away from that level.
+//
+//*****************************************************************************
+static uint32_t
+_TimerCapPhaseGet(tTimerCap *psCap)
+{
+    uint32_t ui32Written;
+    int32_t i32Level;
+
+    if((psCap->ui32Edge != TIMER_EVENT_BOTH_EDGES) || !psCap->ui32Port)
+    {
+        return(~0U);
+    }
+
+    do
+    {
+        ui32Written = _TimerCapWritten(psCap);
+        i32Level = GPIOPinRead(psCap->ui32Port, psCap->ui8Pin);
+    }
+    while(ui32Written != _TimerCapWritten(psCap));
+
+    return((ui32Written & 1) ^ (i32Level ? 1 : 0));
+}
+
+//*****************************************************************************
+//
+// Returns the number of timestamps waiting to be consumed, skipping any that
+// have already been overwritten.
+//
+//*****************************************************************************
+static uint32_t
+_TimerCapSync(tTimerCap *psCap)
+{
+    uint32_t ui32Written, ui32Avail;
+
+    ui32Written = _TimerCapWritten(psCap);
+    ui32Avail = ui32Written - psCap->ui32Read;
+
+    //
+    // The count can briefly lag behind a previous reading while the handler
+    // reloads a control structure.
+    //
+    if((int32_t)ui32Avail < 0)
+    {
+        return(0);
+    }
+
+    //
+    // If the ring has lapped the reader, the oldest timestamps are gone and
+    // the next interval can not be measured.
+    //
+    if(ui32Avail > psCap->ui32Size)
+    {
+        psCap->ui32Lost += ui32Avail - psCap->ui32Size;
+        psCap->ui32Read = ui32Written - psCap->ui32Size;
+        psCap->ui32High = ~0;
+        psCap->bPrimed = false;
+        ui32Avail = psCap->ui32Size;
+    }
+
+    return(ui32Avail);
+}
+
+//*****************************************************************************
+//
+// Consumes up to the given number of intervals between captured edges,
+// optionally storing them and optionally adding them to running totals.
+//
+//*****************************************************************************
+static uint32_t
+_TimerCapConsume(tTimerCap *psCap, uint32_t *pui32Intervals,
+                 uint32_t ui32Max, tTimerCapTotals *psTotals)
+{
+    uint32_t ui32Avail, ui32Mask, ui32Time, ui32Interval, ui32Period;
+    uint32_t ui32Count, ui32First;
+
+    ui32Avail = _TimerCapSync(psCap);
+    ui32Mask = TimerCapMaskGet(psCap);
+
+    //
+    // In both-edge mode, a period is made of the interval that starts on a
+    // rising edge followed by the one that starts on a falling edge.  If
+    // the polarity is not known, the pairing is arbitrary.
+    //
+    ui32First = ((psCap->ui32Rising == ~0U) ? 0 : psCap->ui32Rising);
+
+    for(ui32Count = 0; ui32Avail && (ui32Count < ui32Max); ui32Avail--)
+    {
+        //
+        // Capture was restarted after the ring filled, so edges were missed
+        // before the next timestamp.  Start afresh from it, with the phase
+        // found when capture was restarted.
+        //
+        if((psCap->ui32Restarts != psCap->ui32RestartsSeen) &&
+           ((int32_t)(psCap->ui32Read - psCap->ui32Gap) >= 0))
+        {
+            psCap->ui32RestartsSeen = psCap->ui32Restarts;
+            psCap->ui32Lost++;
+            psCap->ui32Rising = psCap->ui32GapRising;
+            psCap->ui32High = ~0;
+            psCap->bPrimed = false;
+            ui32First = ((psCap->ui32Rising == ~0U) ? 0 :
+                         psCap->ui32Rising);
+        }
+
+        ui32Time = (psCap->pui32Buffer[psCap->ui32Read &
+                                       (psCap->ui32Size - 1)] & ui32Mask);
+        psCap->ui32Read++;
+
+        if(!psCap->bPrimed)
+        {
+            psCap->ui32Last = ui32Time;
+            psCap->bPrimed = true;
+            continue;
+        }
+
+        //
+        // The timer counts down, and the modular difference takes care of
+        // the count wrapping between the edges.
+        //
+        ui32Interval = (psCap->ui32Last - ui32Time) & ui32Mask;
+        psCap->ui32Last = ui32Time;
+
+        if(pui32Intervals)
+        {
+            pui32Intervals[ui32Count] = ui32Interval;
+        }
+        ui32Count++;
+
+        if(psTotals == 0)
+        {
+            continue;
+        }
+
+        if(psCap->ui32Edge == TIMER_EVENT_BOTH_EDGES)
+        {
+            //
+            // The interval started on the edge before the one just read.
+            //
+            if(((psCap->ui32Read - 2) & 1) == ui32First)
+            {
+                psCap->ui32High = ui32Interval;
+                continue;
+            }
+            if(psCap->ui32High == ~0U)
+            {
+                continue;
+            }
+            ui32Period = psCap->ui32High + ui32Interval;
+            psTotals->ui64High += psCap->ui32High;
+            psCap->ui32High = ~0;
+        }
+        else
+        {
+            ui32Period = ui32Interval;
+        }
+
+        if((psTotals->ui32Periods == 0) || (ui32Period < psTotals->ui32Min))
+        {
+            psTotals->ui32Min = ui32Period;
+        }
+        if(ui32Period > psTotals->ui32Max)
+        {
+            psTotals->ui32Max = ui32Period;
+        }
+        psTotals->ui64Sum += ui32Period;
+        psTotals->ui32Periods++;
+    }
+
+    return(ui32Count);
+}
+
+//*****************************************************************************
+//
+//! Starts an input capture engine.
+//!
+//! \param psCap is a pointer to the engine to start.
+//!
+//! This function configures timer A of the module as a down-counting edge
+//! time capture timer and programs the uDMA channel to copy each captured
+//! timestamp into the ring buffer, using the two halves of the ring as the
+//! primary and alternate buffers of a ping-pong transfer.  No processor time
+//! is spent per edge; the interrupt handler of the timer must call
+//! TimerCapIntHandler() once for each half of the ring that is filled.  The
+//! uDMA controller must already be enabled and have a control table, and the
+//! capture pin must be configured for the timer.
+//!
+//! With 24-bit timestamps the prescaler of a 16/32-bit timer extends the
+//! count, so edges up to 2^24 clocks apart can be measured.  Timer B of the
+//! module is reconfigured and should not be used for anything else.
+//!
+//! When both edges are captured and \e ui32Port is set, the level of the pin
+//! is sampled once at start-up to tell which captures are rising edges.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerCapStart(tTimerCap *psCap)
+{
+    uint32_t ui32Control;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+    ASSERT((psCap->ui32Bits == 16) || (psCap->ui32Bits == 24) ||
+           (psCap->ui32Bits == 32));
+    ASSERT((psCap->ui32Edge == TIMER_EVENT_POS_EDGE) ||
+           (psCap->ui32Edge == TIMER_EVENT_NEG_EDGE) ||
+           (psCap->ui32Edge == TIMER_EVENT_BOTH_EDGES));
+    ASSERT(psCap->pui32Buffer != 0);
+    ASSERT((psCap->ui32Size >= 2) && (psCap->ui32Size <= 2048) &&
+           ((psCap->ui32Size & (psCap->ui32Size - 1)) == 0));
+
+    psCap->ui32Laps = 0;
+    psCap->ui32Next = 0;
+    psCap->ui32Read = 0;
+    psCap->ui32Lost = 0;
+    psCap->ui32Rising = ~0;
+    psCap->ui32High = ~0;
+    psCap->ui32Restarts = 0;
+    psCap->ui32RestartsSeen = 0;
+    psCap->ui32Gap = 0;
+    psCap->ui32GapRising = ~0;
+    psCap->bPrimed = false;
+
+    //
+    // Configure timer A to capture the selected edges across its full range.
+    //
+    TimerConfigure(psCap->ui32Base,
+                   TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME);
+    TimerControlEvent(psCap->ui32Base, TIMER_A, psCap->ui32Edge);
+    TimerPrescaleSet(psCap->ui32Base, TIMER_A,
+                     (psCap->ui32Bits == 24) ? 0xff : 0);
+    TimerLoadSet(psCap->ui32Base, TIMER_A,
+                 (psCap->ui32Bits == 32) ? 0xffffffff : 0xffff);
+    if(CLASS_IS_TM4C129)
+    {
+        TimerDMAEventSet(psCap->ui32Base, TIMER_DMA_CAPEVENT_A);
+        TimerIntEnable(psCap->ui32Base, TIMER_TIMA_DMA);
+    }
+
+    //
+    // Copy one 32-bit timestamp per capture into alternate halves of the
+    // ring.
+    //
+    uDMAChannelAssign(psCap->ui32Channel);
+    uDMAChannelAttributeDisable(psCap->ui32Channel, UDMA_ATTR_ALL);
+    uDMAChannelAttributeEnable(psCap->ui32Channel, UDMA_ATTR_HIGH_PRIORITY);
+    ui32Control = (UDMA_SIZE_32 | UDMA_SRC_INC_NONE | UDMA_DST_INC_32 |
+                   UDMA_ARB_1);
+    uDMAChannelControlSet(psCap->ui32Channel | UDMA_PRI_SELECT, ui32Control);
+    uDMAChannelControlSet(psCap->ui32Channel | UDMA_ALT_SELECT, ui32Control);
+    _TimerCapHalfLoad(psCap, 0);
+    _TimerCapHalfLoad(psCap, 1);
+    uDMAChannelEnable(psCap->ui32Channel);
+
+    TimerEnable(psCap->ui32Base, TIMER_A);
+
+    psCap->ui32Rising = _TimerCapPhaseGet(psCap);
+}
+
+//*****************************************************************************
+//
+//! Stops an input capture engine.
+//!
+//! \param psCap is a pointer to the engine to stop.
+//!
+//! This function stops the timer and the uDMA channel.  Timestamps already
+//! in the ring can still be consumed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerCapStop(tTimerCap *psCap)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+
+    TimerDisable(psCap->ui32Base, TIMER_A);
+    uDMAChannelDisable(psCap->ui32Channel);
+}
+
+//*****************************************************************************
+//
+//! Returns the number of timestamps waiting to be consumed.
+//!
+//! \param psCap is a pointer to the engine.
+//!
+//! \return Returns the number of captured timestamps that have not yet been
+//! consumed by TimerCapRead() or TimerCapStatsGet().
+//
+//*****************************************************************************
+uint32_t
+TimerCapAvailable(tTimerCap *psCap)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+
+    return(_TimerCapSync(psCap));
+}
+
+//*****************************************************************************
+//
+//! Reads the intervals between captured edges.
+//!
+//! \param psCap is a pointer to the engine.
+//! \param pui32Intervals is a pointer to the array that receives the
+//! intervals, in timer clocks.
+//! \param ui32Count is the maximum number of intervals to read.
+//!
+//! This function consumes timestamps from the ring and stores the time
+//! between each one and the one before it.  The intervals are corrected for
+//! the count wrapping, including the prescaler extension in 24-bit mode.
+//! The ring must be read at least once per half ring of edges; timestamps
+//! that are overwritten before being read are counted as lost and the
+//! interval spanning them is dropped.
+//!
+//! This function and TimerCapStatsGet() consume from the same ring, so an
+//! application should use one or the other.
+//!
+//! \return Returns the number of intervals stored.
+//
+//*****************************************************************************
+uint32_t
+TimerCapRead(tTimerCap *psCap, uint32_t *pui32Intervals, uint32_t ui32Count)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+    ASSERT(pui32Intervals != 0);
+
+    return(_TimerCapConsume(psCap, pui32Intervals, ui32Count, 0));
+}
+
+//*****************************************************************************
+//
+//! Gets the timestamp of the most recent edge consumed.
+//!
+//! \param psCap is a pointer to the engine.
+//! \param pui32Time is a pointer to the location that receives the
+//! timestamp, in the same units as TimerCapTimeGet().
+//!
+//! This function returns the timestamp of the last edge consumed by
+//! TimerCapRead() or TimerCapStatsGet(), which together with
+//! TimerCapTimeGet() gives the time elapsed since that edge.
+//!
+//! \return Returns \b true if an edge has been consumed since the engine was
+//! started or since timestamps were last lost, and \b false otherwise.
+//
+//*****************************************************************************
+bool
+TimerCapLastGet(tTimerCap *psCap, uint32_t *pui32Time)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+    ASSERT(pui32Time != 0);
+
+    *pui32Time = psCap->ui32Last;
+
+    return(psCap->bPrimed);
+}
+
+//*****************************************************************************
+//
+//! Gets the current count of the capture timer.
+//!
+//! \param psCap is a pointer to the engine.
+//!
+//! This function reads the free-running count of the timer, masked to the
+//! width of the timestamps so that it can be compared with them.  The timer
+//! counts down, so the time from a timestamp to now is the timestamp minus
+//! the count, modulo 2^\e ui32Bits.
+//!
+//! \return Returns the current count of the timer.
+//
+//*****************************************************************************
+uint32_t
+TimerCapTimeGet(tTimerCap *psCap)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+
+    return(HWREG(psCap->ui32Base + TIMER_O_TAV) & TimerCapMaskGet(psCap));
+}
+
+//*****************************************************************************
+//
+//! Gets the mask of the bits of the count kept in a timestamp.
+//!
+//! \param psCap is a pointer to the engine.
+//!
+//! Differences between timestamps, and between a timestamp and the count
+//! returned by TimerCapTimeGet(), must be masked with this value to allow
+//! for the count wrapping.
+//!
+//! \return Returns 2^\e ui32Bits minus one.
+//
+//*****************************************************************************
+uint32_t
+TimerCapMaskGet(tTimerCap *psCap)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+
+    return((psCap->ui32Bits == 32) ? 0xffffffff :
+           ((1u << psCap->ui32Bits) - 1));
+}
+
+//*****************************************************************************
+//
+//! Computes signal statistics from the captured edges.
+//!
+//! \param psCap is a pointer to the engine.
+//! \param ui32Clock is the clock rate of the timer in Hz.
+//! \param psStats is a pointer to the structure that receives the
+//! statistics.
+//!
+//! This function consumes every timestamp waiting in the ring and returns
+//! the number of periods seen, their minimum, maximum and average, the
+//! frequency and, when both edges are captured and the pin is known, the
+//! duty cycle.  With a single edge every interval is a period; with both
+//! edges a period is a high time followed by a low time.  The lost count is
+//! reset by each call.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerCapStatsGet(tTimerCap *psCap, uint32_t ui32Clock,
+                 tTimerCapStats *psStats)
+{
+    tTimerCapTotals sTotals;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+    ASSERT(psStats != 0);
+
+    sTotals.ui32Periods = 0;
+    sTotals.ui32Min = 0;
+    sTotals.ui32Max = 0;
+    sTotals.ui64Sum = 0;
+    sTotals.ui64High = 0;
+
+    _TimerCapConsume(psCap, 0, ~0U, &sTotals);
+
+    psStats->ui32Periods = sTotals.ui32Periods;
+    psStats->ui32PeriodMin = sTotals.ui32Min;
+    psStats->ui32PeriodMax = sTotals.ui32Max;
+    psStats->ui32PeriodAvg = 0;
+    psStats->ui32Frequency = 0;
+    psStats->ui32Duty = 0;
+    if(sTotals.ui64Sum)
+    {
+        psStats->ui32PeriodAvg = sTotals.ui64Sum / sTotals.ui32Periods;
+        psStats->ui32Frequency = (((uint64_t)ui32Clock * 1000 *
+                                   sTotals.ui32Periods) / sTotals.ui64Sum);
+        if(psCap->ui32Rising != ~0U)
+        {
+            psStats->ui32Duty = (sTotals.ui64High * 10000) / sTotals.ui64Sum;
+        }
+    }
+
+    psStats->ui32Lost = psCap->ui32Lost;
+    psCap->ui32Lost = 0;
+}
+
+//*****************************************************************************
+//
+//! Handles the uDMA completion interrupt of an input capture engine.
+//!
+//! \param psCap is a pointer to the engine.
+//!
+//! This function must be called from the interrupt handler of the timer.  It
+//! counts each half of the ring that the uDMA controller has filled and
+//! reloads its control structure so that capture continues into it once the
+//! other half is full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerCapIntHandler(tTimerCap *psCap)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psCap != 0);
+
+    if(CLASS_IS_TM4C129)
+    {
+        TimerIntClear(psCap->ui32Base, TIMER_TIMA_DMA);
+    }
+
+    //
+    // Count each half before reloading it, so that _TimerCapWritten() never
+    // sees a reloaded structure with the old count.
+    //
+    while(uDMAChannelModeGet(psCap->ui32Channel |
+                             g_pui32TimerCapSelect[psCap->ui32Next]) ==
+          UDMA_MODE_STOP)
+    {
+        psCap->ui32Laps++;
+        _TimerCapHalfLoad(psCap, psCap->ui32Next);
+        psCap->ui32Next ^= 1;
+    }
+
+    //
+    // If both halves filled before this handler ran, the channel stopped;
+    // restart it.  The edges in between are missed, so record where the gap
+    // is for the reader, which must not measure an interval across it, and
+    // find the phase of the edges again.
+    //
+    if(!uDMAChannelIsEnabled(psCap->ui32Channel))
+    {
+        psCap->ui32Gap = psCap->ui32Laps * (psCap->ui32Size / 2);
+        uDMAChannelEnable(psCap->ui32Channel);
+        psCap->ui32GapRising = _TimerCapPhaseGet(psCap);
+        psCap->ui32Restarts++;
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,242 @@
+//*****************************************************************************
+//
+// timercap.h - uDMA-driven timer input capture and measurement.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_TIMERCAP_H__
+#define __DRIVERLIB_TIMERCAP_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! This structure describes an input capture engine started with
+//! TimerCapStart().  The structure is owned by the driver until the engine is
+//! stopped, and must not be modified or go out of scope in the meantime.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The base address of the timer module.  Timer A of the module captures
+    //! the edges.
+    //
+    uint32_t ui32Base;
+
+    //
+    //! The uDMA channel mapping of timer A of the module, such as
+    //! \b UDMA_CH18_TIMER0A.
+    //
+    uint32_t ui32Channel;
+
+    //
+    //! The edges to capture; one of \b TIMER_EVENT_POS_EDGE,
+    //! \b TIMER_EVENT_NEG_EDGE or \b TIMER_EVENT_BOTH_EDGES.
+    //
+    uint32_t ui32Edge;
+
+    //
+    //! The width of the timestamps in bits.  This is 16 for a 16/32-bit
+    //! timer, 24 for a 16/32-bit timer with the prescaler acting as an
+    //! extension of the count, or 32 for a wide timer.  The interval between
+    //! two captured edges must be less than 2^\e ui32Bits timer clocks.
+    //
+    uint32_t ui32Bits;
+
+    //
+    //! The ring buffer that receives the timestamps.  It must be in SRAM.
+    //
+    uint32_t *pui32Buffer;
+
+    //
+    //! The number of entries in the ring buffer.  It must be a power of two
+    //! between 2 and 2048.
+    //
+    uint32_t ui32Size;
+
+    //
+    //! For \b TIMER_EVENT_BOTH_EDGES, the base address of the GPIO port with
+    //! the capture pin, used to tell high time from low time; or 0 if the
+    //! duty cycle is not needed.
+    //
+    uint32_t ui32Port;
+
+    //
+    //! The bit-packed representation of the capture pin on \e ui32Port.
+    //
+    uint8_t ui8Pin;
+
+    //
+    //! Used internally to count the halves of the ring filled by the uDMA
+    //! controller.
+    //
+    volatile uint32_t ui32Laps;
+
+    //
+    //! Used internally to record which half of the ring is filled next.
+    //
+    uint32_t ui32Next;
+
+    //
+    //! Used internally to count the timestamps consumed.
+    //
+    uint32_t ui32Read;
+
+    //
+    //! Used internally to hold the last timestamp consumed.
+    //
+    uint32_t ui32Last;
+
+    //
+    //! Used internally to count the timestamps overwritten before they were
+    //! consumed, and the gaps left when capture stopped with the ring full.
+    //
+    uint32_t ui32Lost;
+
+    //
+    //! Used internally to record the parity of the indices of rising edges,
+    //! or ~0 if it is not known.
+    //
+    uint32_t ui32Rising;
+
+    //
+    //! Used internally to hold the high time of a period in progress.
+    //
+    uint32_t ui32High;
+
+    //
+    //! Used internally to count the times that capture was restarted after
+    //! the ring filled, and the restarts that have been consumed.
+    //
+    volatile uint32_t ui32Restarts;
+    uint32_t ui32RestartsSeen;
+    //
+    //! Used internally to record the number of timestamps written before the
+    //! last restart, and the parity of the indices of rising edges after it.
+    //
+    volatile uint32_t ui32Gap;
+    volatile uint32_t ui32GapRising;
+    //
+    //! Used internally to mark that \e ui32Last holds a valid timestamp.
+    //
+    bool bPrimed;
+}
+tTimerCap;
+
+//*****************************************************************************
+//
+//! The statistics returned by TimerCapStatsGet().  All times are in timer
+//! clocks.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of complete periods measured.
+    //
+    uint32_t ui32Periods;
+
+    //
+    //! The shortest period.
+    //
+    uint32_t ui32PeriodMin;
+
+    //
+    //! The longest period.
+    //
+    uint32_t ui32PeriodMax;
+
+    //
+    //! The average period.
+    //
+    uint32_t ui32PeriodAvg;
+
+    //
+    //! The frequency in millihertz, based on the average period.
+    //
+    uint32_t ui32Frequency;
+
+    //
+    //! The duty cycle in hundredths of a percent, or 0 if it was not
+    //! measured.
+    //
+    uint32_t ui32Duty;
+
+    //
+    //! The number of timestamps that were overwritten before they were read,
+    //! plus one for each time capture stopped because the ring was full.
+    //
+    uint32_t ui32Lost;
+}
+tTimerCapStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void TimerCapStart(tTimerCap *psCap);
+extern void TimerCapStop(tTimerCap *psCap);
+extern uint32_t TimerCapAvailable(tTimerCap *psCap);
+extern uint32_t TimerCapRead(tTimerCap *psCap, uint32_t *pui32Intervals,
+                             uint32_t ui32Count);
+extern bool TimerCapLastGet(tTimerCap *psCap, uint32_t *pui32Time);
+extern uint32_t TimerCapTimeGet(tTimerCap *psCap);
+extern uint32_t TimerCapMaskGet(tTimerCap *psCap);
+extern void TimerCapStatsGet(tTimerCap *psCap, uint32_t ui32Clock,
+                             tTimerCapStats *psStats);
+extern void TimerCapIntHandler(tTimerCap *psCap);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_TIMERCAP_H__
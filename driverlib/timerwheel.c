@@ -0,0 +1,685 @@
+//*****************************************************************************
+//
+// timerwheel.c - Software timers multiplexed onto one wide timer.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup timerwheel_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_timer.h"
+#include "inc/hw_types.h"
+#include "driverlib/atomic.h"
+#include "driverlib/cpu.h"
+#include "driverlib/debug.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/timer.h"
+#include "driverlib/timerwheel.h"
+
+//*****************************************************************************
+//
+// The number of levels in the wheel.  Each level has 64 slots, so the wheel
+// spans 2^(6 * TIMERWHEEL_LEVELS) ticks; timers further out than that are
+// parked in the top level and re-filed when it comes round.  This may be
+// overridden from the compiler command line, up to a maximum of 10.
+//
+//*****************************************************************************
+#ifndef TIMERWHEEL_LEVELS
+#define TIMERWHEEL_LEVELS       6
+#endif
+
+//*****************************************************************************
+//
+// The number of bits of the tick count resolved by each level, and the
+// resulting number of slots in a level.
+//
+//*****************************************************************************
+#define TIMERWHEEL_SLOT_BITS    6
+#define TIMERWHEEL_SLOTS        (1 << TIMERWHEEL_SLOT_BITS)
+
+//*****************************************************************************
+//
+// The wide timer that provides the time base, its interrupt number, and the
+// number of timer clocks per wheel tick, expressed as a power of two.
+//
+//*****************************************************************************
+static uint32_t g_ui32TimerWheelBase;
+static uint32_t g_ui32TimerWheelInt;
+static uint32_t g_ui32TimerWheelShift;
+
+//*****************************************************************************
+//
+// The current time of the wheel in ticks.  All timers that expire before
+// this tick have been processed.
+//
+//*****************************************************************************
+static uint64_t g_ui64TimerWheelNow;
+
+//*****************************************************************************
+//
+// True while the interrupt handler is expiring timers.  The current time of
+// the wheel must not move under the slot being expired, so timers added from
+// callbacks are filed relative to it rather than to the hardware time.
+//
+//*****************************************************************************
+static bool g_bTimerWheelAdvancing;
+
+//*****************************************************************************
+//
+// The tick programmed into the match register, or ~0 if there is none.
+//
+//*****************************************************************************
+static uint64_t g_ui64TimerWheelMatch;
+
+//*****************************************************************************
+//
+// The slots of the wheel, level by level, and a bitmap for each level of the
+// slots that hold timers.
+//
+//*****************************************************************************
+static tTimerWheelTimer *g_ppsTimerWheelSlots[TIMERWHEEL_LEVELS *
+                                              TIMERWHEEL_SLOTS];
+static uint64_t g_pui64TimerWheelUsed[TIMERWHEEL_LEVELS];
+
+//*****************************************************************************
+//
+// Returns the index of the lowest set bit of a non-zero value.
+//
+//*****************************************************************************
+static uint32_t
+_TimerWheelFirstSet(uint64_t ui64Bits)
+{
+    uint32_t ui32Bits;
+
+    ui32Bits = (uint32_t)ui64Bits;
+    if(ui32Bits)
+    {
+        return(31 - CPUclz(ui32Bits & -ui32Bits));
+    }
+
+    ui32Bits = (uint32_t)(ui64Bits >> 32);
+    return(63 - CPUclz(ui32Bits & -ui32Bits));
+}
+
+//*****************************************************************************
+//
+// Returns the current time of the hardware timer in ticks.
+//
+//*****************************************************************************
+static uint64_t
+_TimerWheelTickGet(void)
+{
+    return(TimerValueGet64(g_ui32TimerWheelBase) >> g_ui32TimerWheelShift);
+}
+
+//*****************************************************************************
+//
+// Returns the tick at which a slot of a level comes due.  A slot of level 0
+// holds timers that expire within the next 64 ticks, starting with the
+// current one.  A slot of a higher level comes due between 1 and 64 of its
+// periods after the period that holds the current tick.
+//
+//*****************************************************************************
+static uint64_t
+_TimerWheelSlotTime(uint32_t ui32Level, uint32_t ui32Slot)
+{
+    uint32_t ui32Shift, ui32Current;
+
+    ui32Shift = ui32Level * TIMERWHEEL_SLOT_BITS;
+    ui32Current = ((g_ui64TimerWheelNow >> ui32Shift) &
+                   (TIMERWHEEL_SLOTS - 1));
+
+    if(ui32Level == 0)
+    {
+        return(g_ui64TimerWheelNow +
+               ((ui32Slot - ui32Current) & (TIMERWHEEL_SLOTS - 1)));
+    }
+
+    return(((g_ui64TimerWheelNow >> ui32Shift) +
+            ((ui32Slot - ui32Current - 1) & (TIMERWHEEL_SLOTS - 1)) + 1) <<
+           ui32Shift);
+}
+
+//*****************************************************************************
+//
+// Returns the tick at which the wheel next needs attention, either to expire
+// timers or to move them down to a lower level, or ~0 if the wheel is empty.
+//
+//*****************************************************************************
+static uint64_t
+_TimerWheelNextGet(void)
+{
+    uint64_t ui64Next, ui64Time, ui64Used;
+    uint32_t ui32Level, ui32First;
+
+    ui64Next = ~(uint64_t)0;
+
+    for(ui32Level = 0; ui32Level < TIMERWHEEL_LEVELS; ui32Level++)
+    {
+        ui64Used = g_pui64TimerWheelUsed[ui32Level];
+        if(ui64Used == 0)
+        {
+            continue;
+        }
+
+        //
+        // Rotate the bitmap so that the first slot to come due is bit 0, and
+        // find the first occupied slot from there.
+        //
+        ui32First = ((g_ui64TimerWheelNow >>
+                      (ui32Level * TIMERWHEEL_SLOT_BITS)) +
+                     ((ui32Level == 0) ? 0 : 1)) & (TIMERWHEEL_SLOTS - 1);
+        if(ui32First)
+        {
+            ui64Used = ((ui64Used >> ui32First) |
+                        (ui64Used << (TIMERWHEEL_SLOTS - ui32First)));
+        }
+        ui64Time = _TimerWheelSlotTime(ui32Level,
+                                       ((_TimerWheelFirstSet(ui64Used) +
+                                         ui32First) &
+                                        (TIMERWHEEL_SLOTS - 1)));
+
+        if(ui64Time < ui64Next)
+        {
+            ui64Next = ui64Time;
+        }
+    }
+
+    return(ui64Next);
+}
+
+//*****************************************************************************
+//
+// Files a timer into the slot for its expiry time and returns the tick at
+// which that slot comes due.
+//
+//*****************************************************************************
+static uint64_t
+_TimerWheelInsert(tTimerWheelTimer *psTimer)
+{
+    uint64_t ui64Tick, ui64Delta;
+    uint32_t ui32Level, ui32Slot;
+
+    //
+    // Round the expiry up to a whole tick so that the timer never expires
+    // early, and expire timers that are already due on the current tick.
+    //
+    ui64Tick = ((psTimer->ui64Expiry >> g_ui32TimerWheelShift) +
+                ((psTimer->ui64Expiry &
+                  (((uint64_t)1 << g_ui32TimerWheelShift) - 1)) ? 1 : 0));
+    if(ui64Tick < g_ui64TimerWheelNow)
+    {
+        ui64Tick = g_ui64TimerWheelNow;
+    }
+
+    //
+    // Park timers beyond the span of the wheel in the last slot of the top
+    // level to come due.
+    //
+    ui64Delta = ui64Tick - g_ui64TimerWheelNow;
+    if(ui64Delta >= ((uint64_t)1 <<
+                     (TIMERWHEEL_LEVELS * TIMERWHEEL_SLOT_BITS)))
+    {
+        ui64Delta = (((uint64_t)1 <<
+                      (TIMERWHEEL_LEVELS * TIMERWHEEL_SLOT_BITS)) - 1);
+        ui64Tick = g_ui64TimerWheelNow + ui64Delta;
+    }
+
+    //
+    // The level is the one whose period is the largest not exceeding the
+    // time left.
+    //
+    for(ui32Level = 0;
+        ui64Delta >= ((uint64_t)1 << ((ui32Level + 1) *
+                                      TIMERWHEEL_SLOT_BITS));
+        ui32Level++)
+    {
+    }
+    ui32Slot = ((ui64Tick >> (ui32Level * TIMERWHEEL_SLOT_BITS)) &
+                (TIMERWHEEL_SLOTS - 1));
+
+    //
+    // Link the timer at the head of the slot.
+    //
+    psTimer->ui16Slot = (ui32Level * TIMERWHEEL_SLOTS) + ui32Slot;
+    psTimer->psNext = g_ppsTimerWheelSlots[psTimer->ui16Slot];
+    if(psTimer->psNext)
+    {
+        psTimer->psNext->ppsPrev = &psTimer->psNext;
+    }
+    psTimer->ppsPrev = &g_ppsTimerWheelSlots[psTimer->ui16Slot];
+    g_ppsTimerWheelSlots[psTimer->ui16Slot] = psTimer;
+    g_pui64TimerWheelUsed[ui32Level] |= (uint64_t)1 << ui32Slot;
+
+    return(_TimerWheelSlotTime(ui32Level, ui32Slot));
+}
+
+//*****************************************************************************
+//
+// Unlinks a pending timer from its slot.
+//
+//*****************************************************************************
+static void
+_TimerWheelRemove(tTimerWheelTimer *psTimer)
+{
+    *psTimer->ppsPrev = psTimer->psNext;
+    if(psTimer->psNext)
+    {
+        psTimer->psNext->ppsPrev = psTimer->ppsPrev;
+    }
+    psTimer->ppsPrev = 0;
+
+    if(g_ppsTimerWheelSlots[psTimer->ui16Slot] == 0)
+    {
+        g_pui64TimerWheelUsed[psTimer->ui16Slot / TIMERWHEEL_SLOTS] &=
+            ~((uint64_t)1 << (psTimer->ui16Slot & (TIMERWHEEL_SLOTS - 1)));
+    }
+}
+
+//*****************************************************************************
+//
+// Programs the hardware match for a tick, or disables it for ~0.
+//
+//*****************************************************************************
+static void
+_TimerWheelMatchSet(uint64_t ui64Tick)
+{
+    g_ui64TimerWheelMatch = ui64Tick;
+
+    if(ui64Tick > (~(uint64_t)0 >> g_ui32TimerWheelShift))
+    {
+        TimerMatchSet64(g_ui32TimerWheelBase, ~(uint64_t)0);
+    }
+    else
+    {
+        TimerMatchSet64(g_ui32TimerWheelBase,
+                        ui64Tick << g_ui32TimerWheelShift);
+    }
+}
+
+//*****************************************************************************
+//
+// Brings the wheel up to the given tick, moving timers down the levels as
+// their slots come due and expiring the timers of level 0.  The wheel is
+// only changed inside a critical section, since interrupts above this one
+// may add or cancel timers; the critical section is left only while a
+// callback runs.
+//
+//*****************************************************************************
+static void
+_TimerWheelAdvance(uint64_t ui64Tick)
+{
+    tTimerWheelTimer *psTimer;
+    uint64_t ui64Next;
+    uint32_t ui32Level, ui32Shift, ui32Slot, ui32Key;
+
+    ui32Key = AtomicEnter();
+
+    g_bTimerWheelAdvancing = true;
+
+    for(;;)
+    {
+        //
+        // Jump straight to the next tick that has work to do.
+        //
+        ui64Next = _TimerWheelNextGet();
+        if(ui64Next > ui64Tick)
+        {
+            break;
+        }
+        g_ui64TimerWheelNow = ui64Next;
+
+        //
+        // Re-file the timers of any higher level slot that starts on this
+        // tick, working down so that each lands in its final slot.
+        //
+        for(ui32Level = TIMERWHEEL_LEVELS - 1; ui32Level > 0; ui32Level--)
+        {
+            ui32Shift = ui32Level * TIMERWHEEL_SLOT_BITS;
+            if(ui64Next & (((uint64_t)1 << ui32Shift) - 1))
+            {
+                continue;
+            }
+
+            ui32Slot = ((ui32Level * TIMERWHEEL_SLOTS) +
+                        ((ui64Next >> ui32Shift) & (TIMERWHEEL_SLOTS - 1)));
+            while((psTimer = g_ppsTimerWheelSlots[ui32Slot]) != 0)
+            {
+                _TimerWheelRemove(psTimer);
+                _TimerWheelInsert(psTimer);
+            }
+        }
+
+        //
+        // Expire the timers of this tick.  The slot is re-read each time
+        // since callbacks may add or cancel timers.
+        //
+        ui32Slot = ui64Next & (TIMERWHEEL_SLOTS - 1);
+        while((psTimer = g_ppsTimerWheelSlots[ui32Slot]) != 0)
+        {
+            _TimerWheelRemove(psTimer);
+            if(psTimer->ui32Period)
+            {
+                psTimer->ui64Expiry += psTimer->ui32Period;
+                _TimerWheelInsert(psTimer);
+            }
+            AtomicExit(ui32Key);
+            psTimer->pfnCallback(psTimer);
+            ui32Key = AtomicEnter();
+        }
+    }
+
+    g_bTimerWheelAdvancing = false;
+
+    //
+    // Nothing is due before the given tick, so the wheel can move up to it.
+    //
+    if(ui64Tick > g_ui64TimerWheelNow)
+    {
+        g_ui64TimerWheelNow = ui64Tick;
+    }
+
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Initializes the timer wheel.
+//!
+//! \param ui32Base is the base address of the wide timer module that provides
+//! the time base.
+//! \param ui32Interrupt is the interrupt number of timer A of that module,
+//! such as \b INT_WTIMER0A.
+//! \param ui32Shift is the number of timer clocks per tick of the wheel,
+//! expressed as a power of two.
+//!
+//! This function configures the timer as a 64-bit one-shot timer that counts
+//! up from zero, and starts it.  The timer never reaches its limit in
+//! practice, so it serves as a monotonic clock for all of the software
+//! timers, and its match register is reprogrammed for the next expiry only.
+//!
+//! Timers expire on whole ticks; a larger \e ui32Shift gives coarser timing
+//! but fewer trips through the levels of the wheel for long timeouts.  With
+//! the default of six levels the wheel spans 2^36 ticks.
+//!
+//! TimerWheelIntHandler() must be installed as the handler of \e
+//! ui32Interrupt, for example with TimerIntRegister(), and the interrupt must
+//! have a priority at or below the ceiling set with AtomicCeilingSet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerWheelInit(uint32_t ui32Base, uint32_t ui32Interrupt, uint32_t ui32Shift)
+{
+    uint32_t ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Base == WTIMER0_BASE) || (ui32Base == WTIMER1_BASE) ||
+           (ui32Base == WTIMER2_BASE) || (ui32Base == WTIMER3_BASE) ||
+           (ui32Base == WTIMER4_BASE) || (ui32Base == WTIMER5_BASE));
+    ASSERT(ui32Shift < 32);
+
+    g_ui32TimerWheelBase = ui32Base;
+    g_ui32TimerWheelInt = ui32Interrupt;
+    g_ui32TimerWheelShift = ui32Shift;
+    g_ui64TimerWheelNow = 0;
+    g_ui64TimerWheelMatch = ~(uint64_t)0;
+    g_bTimerWheelAdvancing = false;
+
+    for(ui32Idx = 0; ui32Idx < TIMERWHEEL_LEVELS * TIMERWHEEL_SLOTS;
+        ui32Idx++)
+    {
+        g_ppsTimerWheelSlots[ui32Idx] = 0;
+    }
+    for(ui32Idx = 0; ui32Idx < TIMERWHEEL_LEVELS; ui32Idx++)
+    {
+        g_pui64TimerWheelUsed[ui32Idx] = 0;
+    }
+
+    //
+    // Run the timer across the full 64-bit range, with the match interrupt
+    // enabled but parked at the end of time.
+    //
+    TimerConfigure(ui32Base, TIMER_CFG_ONE_SHOT_UP);
+    HWREG(ui32Base + TIMER_O_TAMR) |= TIMER_TAMR_TAMIE;
+    TimerLoadSet64(ui32Base, ~(uint64_t)0);
+    TimerMatchSet64(ui32Base, ~(uint64_t)0);
+    TimerIntClear(ui32Base, TIMER_TIMA_MATCH);
+    TimerIntEnable(ui32Base, TIMER_TIMA_MATCH);
+    TimerEnable(ui32Base, TIMER_A);
+}
+
+//*****************************************************************************
+//
+//! Returns the current time of the timer wheel.
+//!
+//! This function returns the count of the wide timer, in timer clocks since
+//! TimerWheelInit() was called.  Expiry times passed to TimerWheelAdd() are
+//! on the same scale.
+//!
+//! \return Returns the current time in timer clocks.
+//
+//*****************************************************************************
+uint64_t
+TimerWheelNow(void)
+{
+    return(TimerValueGet64(g_ui32TimerWheelBase));
+}
+
+//*****************************************************************************
+//
+//! Starts a software timer.
+//!
+//! \param psTimer is a pointer to the timer.
+//! \param ui64Expiry is the time at which the timer expires, in timer clocks
+//! on the scale returned by TimerWheelNow().
+//!
+//! This function files the timer in the wheel so that its callback is called
+//! from TimerWheelIntHandler() on the first tick at or after \e ui64Expiry.
+//! A time in the past expires the timer on the next interrupt.  If the timer
+//! is already pending it is moved to the new time.  The callback, data and
+//! period must be set in \e psTimer before calling this function.
+//!
+//! Filing takes constant time, independent of the number of timers pending.
+//! The hardware match is reprogrammed only when the timer comes due before
+//! everything already in the wheel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerWheelAdd(tTimerWheelTimer *psTimer, uint64_t ui64Expiry)
+{
+    uint64_t ui64Tick, ui64Due;
+    uint32_t ui32Key;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psTimer != 0);
+    ASSERT(psTimer->pfnCallback != 0);
+    ASSERT((psTimer->ui32Period == 0) ||
+           (psTimer->ui32Period >= ((uint32_t)1 << g_ui32TimerWheelShift)));
+
+    ui32Key = AtomicEnter();
+
+    if(psTimer->ppsPrev)
+    {
+        _TimerWheelRemove(psTimer);
+    }
+    psTimer->ui64Expiry = ui64Expiry;
+
+    //
+    // If nothing is due yet, bring the wheel up to the present so that the
+    // timer is filed relative to the current time.  This is not done from a
+    // callback, since the slot being expired would then cover later ticks.
+    //
+    ui64Tick = _TimerWheelTickGet();
+    if(!g_bTimerWheelAdvancing && (ui64Tick > g_ui64TimerWheelNow) &&
+       (_TimerWheelNextGet() > ui64Tick))
+    {
+        g_ui64TimerWheelNow = ui64Tick;
+    }
+
+    //
+    // Bring the match forward if this slot comes due first.  If that time
+    // has already passed, the match will not fire, so pend the interrupt.
+    //
+    ui64Due = _TimerWheelInsert(psTimer);
+    if(ui64Due < g_ui64TimerWheelMatch)
+    {
+        _TimerWheelMatchSet(ui64Due);
+        if(_TimerWheelTickGet() >= ui64Due)
+        {
+            IntPendSet(g_ui32TimerWheelInt);
+        }
+    }
+
+    AtomicExit(ui32Key);
+}
+
+//*****************************************************************************
+//
+//! Cancels a software timer.
+//!
+//! \param psTimer is a pointer to the timer.
+//!
+//! This function removes a pending timer from the wheel in constant time.
+//! The hardware match is left alone; if it was set for this timer, the
+//! interrupt handler finds nothing due and moves the match on.
+//!
+//! \return Returns \b true if the timer was pending, or \b false if it had
+//! already expired or was never started.
+//
+//*****************************************************************************
+bool
+TimerWheelCancel(tTimerWheelTimer *psTimer)
+{
+    uint32_t ui32Key;
+    bool bPending;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psTimer != 0);
+
+    ui32Key = AtomicEnter();
+
+    bPending = (psTimer->ppsPrev != 0);
+    if(bPending)
+    {
+        _TimerWheelRemove(psTimer);
+    }
+
+    AtomicExit(ui32Key);
+
+    return(bPending);
+}
+
+//*****************************************************************************
+//
+//! Determines whether a software timer is pending.
+//!
+//! \param psTimer is a pointer to the timer.
+//!
+//! \return Returns \b true if the timer is in the wheel, and \b false
+//! otherwise.
+//
+//*****************************************************************************
+bool
+TimerWheelPending(tTimerWheelTimer *psTimer)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psTimer != 0);
+
+    return(psTimer->ppsPrev != 0);
+}
+
+//*****************************************************************************
+//
+//! Handles the match interrupt of the timer wheel.
+//!
+//! This function is the interrupt handler for timer A of the wide timer
+//! passed to TimerWheelInit().  It calls the callbacks of all timers that
+//! have expired, in order of expiry, and then programs the match for the
+//! next tick at which the wheel has work to do.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+TimerWheelIntHandler(void)
+{
+    uint64_t ui64Next;
+    uint32_t ui32Key;
+
+    TimerIntClear(g_ui32TimerWheelBase, TIMER_TIMA_MATCH);
+
+    //
+    // Keep going until the match is set for a time that has not yet passed,
+    // since a match in the past would never fire.  The next expiry is found
+    // and programmed in one critical section so that a timer added by a
+    // preempting interrupt in between cannot be lost behind a later match.
+    //
+    do
+    {
+        _TimerWheelAdvance(_TimerWheelTickGet());
+        ui32Key = AtomicEnter();
+        ui64Next = _TimerWheelNextGet();
+        _TimerWheelMatchSet(ui64Next);
+        AtomicExit(ui32Key);
+    }
+    while(ui64Next <= _TimerWheelTickGet());
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
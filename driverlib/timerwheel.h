@@ -0,0 +1,127 @@
+//*****************************************************************************
+//
+// timerwheel.h - Software timers multiplexed onto one wide timer.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_TIMERWHEEL_H__
+#define __DRIVERLIB_TIMERWHEEL_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! This structure describes one software timer.  The structure is owned by
+//! the driver from the time it is passed to TimerWheelAdd() until it expires
+//! or is cancelled, and must not be modified or go out of scope in the
+//! meantime.  Periodic timers remain owned by the driver until cancelled.
+//
+//*****************************************************************************
+typedef struct tTimerWheelTimer
+{
+    //
+    //! The function called from TimerWheelIntHandler() when the timer
+    //! expires.
+    //
+    void (*pfnCallback)(struct tTimerWheelTimer *psTimer);
+
+    //
+    //! Application data for use by the callback.
+    //
+    void *pvCBData;
+
+    //
+    //! The reload interval in timer clocks, or 0 for a one-shot timer.  A
+    //! periodic timer is re-armed before its callback is called, and the
+    //! interval must be at least one tick of the wheel.
+    //
+    uint32_t ui32Period;
+
+    //
+    //! The time of the next expiry, in timer clocks.  This is set by
+    //! TimerWheelAdd() and advanced by the period of a periodic timer.
+    //
+    uint64_t ui64Expiry;
+
+    //
+    //! Used internally to link the timers held in a slot of the wheel.
+    //
+    struct tTimerWheelTimer *psNext;
+
+    //
+    //! Used internally to unlink the timer; 0 when the timer is not pending.
+    //
+    struct tTimerWheelTimer **ppsPrev;
+
+    //
+    //! Used internally to record the level and slot holding the timer.
+    //
+    uint16_t ui16Slot;
+}
+tTimerWheelTimer;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void TimerWheelInit(uint32_t ui32Base, uint32_t ui32Interrupt,
+                           uint32_t ui32Shift);
+extern uint64_t TimerWheelNow(void);
+extern void TimerWheelAdd(tTimerWheelTimer *psTimer, uint64_t ui64Expiry);
+extern bool TimerWheelCancel(tTimerWheelTimer *psTimer);
+extern bool TimerWheelPending(tTimerWheelTimer *psTimer);
+extern void TimerWheelIntHandler(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_TIMERWHEEL_H__
@@ -0,0 +1,71 @@
+//*****************************************************************************
+//
+// hw_dwt.h - Macros used when accessing the Data Watchpoint and Trace unit.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Firmware Development Package.
+//
+//*****************************************************************************
+
+#ifndef __HW_DWT_H__
+#define __HW_DWT_H__
+
+//*****************************************************************************
+//
+// The following are defines for the DWT register addresses.
+//
+//*****************************************************************************
+#define DWT_CTRL                0xE0001000  // DWT Control
+#define DWT_CYCCNT              0xE0001004  // DWT Cycle Count
+#define DWT_CPICNT              0xE0001008  // DWT CPI Count
+#define DWT_EXCCNT              0xE000100C  // DWT Exception Overhead Count
+#define DWT_SLEEPCNT            0xE0001010  // DWT Sleep Count
+#define DWT_LSUCNT              0xE0001014  // DWT LSU Count
+#define DWT_FOLDCNT             0xE0001018  // DWT Folded-Instruction Count
+
+//*****************************************************************************
+//
+// The following are defines for the bit fields in the DWT_CTRL register.
+//
+//*****************************************************************************
+#define DWT_CTRL_NUMCOMP_M      0xF0000000  // Number of Comparators
+#define DWT_CTRL_NOCYCCNT       0x02000000  // No Cycle Counter Support
+#define DWT_CTRL_FOLDEVTENA     0x00200000  // Folded Instruction Count Enable
+#define DWT_CTRL_LSUEVTENA      0x00100000  // LSU Count Enable
+#define DWT_CTRL_SLEEPEVTENA    0x00080000  // Sleep Count Enable
+#define DWT_CTRL_EXCEVTENA      0x00040000  // Exception Overhead Count Enable
+#define DWT_CTRL_CPIEVTENA      0x00020000  // CPI Count Enable
+#define DWT_CTRL_CYCCNTENA      0x00000001  // Cycle Count Enable
+#define DWT_CTRL_NUMCOMP_S      28
+
+#endif // __HW_DWT_H__
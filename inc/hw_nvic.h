@@ -1351,6 +1351,7 @@
 // The following are defines for the bit fields in the NVIC_DBG_INT register.
 //
 //*****************************************************************************
+#define NVIC_DBG_INT_TRCENA     0x01000000  // Trace and DWT Enable
 #define NVIC_DBG_INT_HARDERR    0x00000400  // Debug trap on hard fault
 #define NVIC_DBG_INT_INTERR     0x00000200  // Debug trap on interrupt errors
 #define NVIC_DBG_INT_BUSERR     0x00000100  // Debug trap on bus error
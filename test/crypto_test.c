@@ -0,0 +1,398 @@
+//*****************************************************************************
+//
+// crypto_test.c - Host test of the software AES and SHA-256 engines.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+
+//*****************************************************************************
+//
+// This test checks the software AES and SHA-256 engines on the host against
+// the published test vectors: FIPS-197 appendix C for the AES block cipher
+// with each key size, SP 800-38A appendix F for CBC and CTR modes, test case
+// 4 of the GCM specification for GCM, FIPS 180-2 for SHA-224 and SHA-256,
+// and RFC 4231 for HMAC.  Every AES vector is run in both directions, and
+// the CBC and CTR vectors are also run in two calls to check that the IV
+// carries the chaining state from one call to the next.
+//
+// Build and run with "make -C test".
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/aes.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/sw_aes.h"
+#include "driverlib/sw_sha256.h"
+
+//*****************************************************************************
+//
+// The largest vector, in 32-bit words.
+//
+//*****************************************************************************
+#define MAX_WORDS               16
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Called by ASSERT() when the driver library is built with DEBUG defined.
+//
+//*****************************************************************************
+void
+__tiva_driverlib_error__(const char *pcFilename, uint32_t ui32Line)
+{
+    printf("ASSERT at %s:%u\n", pcFilename, (unsigned)ui32Line);
+    g_ui32Failures++;
+}
+
+//*****************************************************************************
+//
+// Converts a hex string into bytes in memory order, clearing the rest of the
+// buffer, and returns the number of bytes.
+//
+//*****************************************************************************
+static uint32_t
+Hex(const char *pcHex, uint32_t *pui32Buffer)
+{
+    uint8_t *pui8Buffer;
+    uint32_t ui32Count;
+    unsigned int uiByte;
+
+    pui8Buffer = (uint8_t *)pui32Buffer;
+    memset(pui8Buffer, 0, MAX_WORDS * 4);
+    for(ui32Count = 0; pcHex[ui32Count * 2]; ui32Count++)
+    {
+        sscanf(&pcHex[ui32Count * 2], "%2x", &uiByte);
+        pui8Buffer[ui32Count] = (uint8_t)uiByte;
+    }
+
+    return(ui32Count);
+}
+
+//*****************************************************************************
+//
+// Compares a result with the expected hex string.
+//
+//*****************************************************************************
+static void
+Check(const char *pcName, const char *pcWhat, const uint32_t *pui32Result,
+      const char *pcExpected)
+{
+    uint32_t pui32Expected[MAX_WORDS], ui32Count;
+
+    ui32Count = Hex(pcExpected, pui32Expected);
+    if(memcmp(pui32Result, pui32Expected, ui32Count) != 0)
+    {
+        printf("%s: %s does not match\n", pcName, pcWhat);
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Runs an ECB, CBC or CTR vector in both directions, in one call and then in
+// two calls split at the given length.
+//
+//*****************************************************************************
+static void
+CheckCipher(const char *pcName, uint32_t ui32Config, const char *pcKey,
+            const char *pcIV, const char *pcPlain, const char *pcCipher,
+            uint32_t ui32Split)
+{
+    uint32_t pui32Key[MAX_WORDS], pui32IV[MAX_WORDS], pui32In[MAX_WORDS];
+    uint32_t pui32Out[MAX_WORDS], ui32KeySize, ui32Length, ui32Pass;
+    const char *pcIn, *pcOut;
+
+    switch(Hex(pcKey, pui32Key))
+    {
+        case 16:
+        {
+            ui32KeySize = AES_CFG_KEY_SIZE_128BIT;
+            break;
+        }
+        case 24:
+        {
+            ui32KeySize = AES_CFG_KEY_SIZE_192BIT;
+            break;
+        }
+        default:
+        {
+            ui32KeySize = AES_CFG_KEY_SIZE_256BIT;
+            break;
+        }
+    }
+
+    for(ui32Pass = 0; ui32Pass < 4; ui32Pass++)
+    {
+        pcIn = (ui32Pass & 1) ? pcCipher : pcPlain;
+        pcOut = (ui32Pass & 1) ? pcPlain : pcCipher;
+
+        SWAESConfigSet(AES_BASE, ui32Config | ui32KeySize |
+                       ((ui32Pass & 1) ? AES_CFG_DIR_DECRYPT :
+                        AES_CFG_DIR_ENCRYPT));
+        SWAESKey1Set(AES_BASE, pui32Key, ui32KeySize);
+        if(pcIV)
+        {
+            Hex(pcIV, pui32IV);
+            SWAESIVSet(AES_BASE, pui32IV);
+        }
+
+        ui32Length = Hex(pcIn, pui32In);
+        memset(pui32Out, 0, sizeof(pui32Out));
+        if(ui32Pass < 2)
+        {
+            SWAESDataProcess(AES_BASE, pui32In, pui32Out, ui32Length);
+        }
+        else
+        {
+            SWAESDataProcess(AES_BASE, pui32In, pui32Out, ui32Split);
+            SWAESDataProcess(AES_BASE, pui32In + (ui32Split / 4),
+                             pui32Out + (ui32Split / 4),
+                             ui32Length - ui32Split);
+        }
+
+        Check(pcName, (ui32Pass == 0) ? "encryption" :
+              (ui32Pass == 1) ? "decryption" :
+              (ui32Pass == 2) ? "encryption in two calls" :
+              "decryption in two calls", pui32Out, pcOut);
+    }
+}
+
+//*****************************************************************************
+//
+// Runs a GCM vector in both directions with a 96-bit nonce.
+//
+//*****************************************************************************
+static void
+CheckGCM(const char *pcName, const char *pcKey, const char *pcNonce,
+         const char *pcAuth, const char *pcPlain, const char *pcCipher,
+         const char *pcTag)
+{
+    uint32_t pui32Key[MAX_WORDS], pui32IV[MAX_WORDS], pui32Auth[MAX_WORDS];
+    uint32_t pui32In[MAX_WORDS], pui32Out[MAX_WORDS], pui32Tag[4];
+    uint32_t ui32Length, ui32AuthLength, ui32Pass;
+
+    Hex(pcKey, pui32Key);
+    ui32AuthLength = Hex(pcAuth, pui32Auth);
+
+    for(ui32Pass = 0; ui32Pass < 2; ui32Pass++)
+    {
+        //
+        // The initial counter block is the nonce followed by a 32-bit
+        // big-endian 1.
+        //
+        Hex(pcNonce, pui32IV);
+        ((uint8_t *)pui32IV)[15] = 1;
+
+        SWAESConfigSet(AES_BASE, AES_CFG_MODE_GCM_HY0CALC |
+                       AES_CFG_KEY_SIZE_128BIT | AES_CFG_CTR_WIDTH_32 |
+                       (ui32Pass ? AES_CFG_DIR_DECRYPT :
+                        AES_CFG_DIR_ENCRYPT));
+        SWAESKey1Set(AES_BASE, pui32Key, AES_CFG_KEY_SIZE_128BIT);
+        SWAESIVSet(AES_BASE, pui32IV);
+
+        ui32Length = Hex(ui32Pass ? pcCipher : pcPlain, pui32In);
+        memset(pui32Out, 0, sizeof(pui32Out));
+        SWAESDataProcessAuth(AES_BASE, pui32In, pui32Out, ui32Length,
+                             pui32Auth, ui32AuthLength, pui32Tag);
+
+        Check(pcName, ui32Pass ? "decryption" : "encryption", pui32Out,
+              ui32Pass ? pcPlain : pcCipher);
+        Check(pcName, ui32Pass ? "decryption tag" : "encryption tag",
+              pui32Tag, pcTag);
+    }
+}
+
+//*****************************************************************************
+//
+// Hashes a string with SHA-224 or SHA-256.
+//
+//*****************************************************************************
+static void
+CheckHash(const char *pcName, uint32_t ui32Mode, const char *pcData,
+          const char *pcDigest)
+{
+    uint32_t pui32Data[MAX_WORDS * 4], pui32Digest[8];
+
+    strcpy((char *)pui32Data, pcData);
+    SWSHAMD5ConfigSet(SHAMD5_BASE, ui32Mode);
+    SWSHAMD5DataProcess(SHAMD5_BASE, pui32Data, strlen(pcData), pui32Digest);
+
+    Check(pcName, "digest", pui32Digest, pcDigest);
+}
+
+//*****************************************************************************
+//
+// Computes an HMAC of a string with a key given in hex.
+//
+//*****************************************************************************
+static void
+CheckHMAC(const char *pcName, uint32_t ui32Mode, const char *pcKey,
+          const char *pcData, const char *pcMAC)
+{
+    uint32_t pui32Key[MAX_WORDS], pui32Data[MAX_WORDS * 4], pui32MAC[8];
+
+    //
+    // The key is padded with zeros to the 64-byte block.
+    //
+    Hex(pcKey, pui32Key);
+    strcpy((char *)pui32Data, pcData);
+    SWSHAMD5ConfigSet(SHAMD5_BASE, ui32Mode);
+    SWSHAMD5HMACKeySet(SHAMD5_BASE, pui32Key);
+    SWSHAMD5HMACProcess(SHAMD5_BASE, pui32Data, strlen(pcData), pui32MAC);
+
+    Check(pcName, "MAC", pui32MAC, pcMAC);
+}
+
+//*****************************************************************************
+//
+// Runs the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    //
+    // FIPS-197 appendix C.
+    //
+    CheckCipher("FIPS-197 C.1 AES-128", AES_CFG_MODE_ECB,
+                "000102030405060708090a0b0c0d0e0f", 0,
+                "00112233445566778899aabbccddeeff",
+                "69c4e0d86a7b0430d8cdb78070b4c55a", 16);
+    CheckCipher("FIPS-197 C.2 AES-192", AES_CFG_MODE_ECB,
+                "000102030405060708090a0b0c0d0e0f1011121314151617", 0,
+                "00112233445566778899aabbccddeeff",
+                "dda97ca4864cdfe06eaf70a0ec0d7191", 16);
+    CheckCipher("FIPS-197 C.3 AES-256", AES_CFG_MODE_ECB,
+                "000102030405060708090a0b0c0d0e0f"
+                "101112131415161718191a1b1c1d1e1f", 0,
+                "00112233445566778899aabbccddeeff",
+                "8ea2b7ca516745bfeafc49904b496089", 16);
+
+    //
+    // SP 800-38A appendix F.2.1 and F.5.1.
+    //
+    CheckCipher("SP 800-38A F.2.1 CBC-AES128", AES_CFG_MODE_CBC,
+                "2b7e151628aed2a6abf7158809cf4f3c",
+                "000102030405060708090a0b0c0d0e0f",
+                "6bc1bee22e409f96e93d7e117393172a"
+                "ae2d8a571e03ac9c9eb76fac45af8e51"
+                "30c81c46a35ce411e5fbc1191a0a52ef"
+                "f69f2445df4f9b17ad2b417be66c3710",
+                "7649abac8119b246cee98e9b12e9197d"
+                "5086cb9b507219ee95db113a917678b2"
+                "73bed6b8e3c1743b7116e69e22229516"
+                "3ff1caa1681fac09120eca307586e1a7", 32);
+    CheckCipher("SP 800-38A F.5.1 CTR-AES128",
+                AES_CFG_MODE_CTR | AES_CFG_CTR_WIDTH_128,
+                "2b7e151628aed2a6abf7158809cf4f3c",
+                "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+                "6bc1bee22e409f96e93d7e117393172a"
+                "ae2d8a571e03ac9c9eb76fac45af8e51"
+                "30c81c46a35ce411e5fbc1191a0a52ef"
+                "f69f2445df4f9b17ad2b417be66c3710",
+                "874d6191b620e3261bef6864990db6ce"
+                "9806f66b7970fdff8617187bb9fffdff"
+                "5ae4df3edbd5d35e5b4f09020db03eab"
+                "1e031dda2fbe03d1792170a0f3009cee", 48);
+
+    //
+    // Test case 4 of the GCM specification.
+    //
+    CheckGCM("GCM test case 4", "feffe9928665731c6d6a8f9467308308",
+             "cafebabefacedbaddecaf888",
+             "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+             "d9313225f88406e5a55909c5aff5269a"
+             "86a7a9531534f7da2e4c303d8a318a72"
+             "1c3c0c95956809532fcf0e2449a6b525"
+             "b16aedf5aa0de657ba637b39",
+             "42831ec2217774244b7221b784d0d49c"
+             "e3aa212f2c02a4e035c17e2329aca12e"
+             "21d514b25466931c7d8f6a5aac84aa05"
+             "1ba30b396a0aac973d58e091",
+             "5bc94fbc3221a5db94fae95ae7121a47");
+
+    //
+    // FIPS 180-2 appendices B.1, B.2 and the SHA-224 example.
+    //
+    CheckHash("FIPS 180-2 SHA-256 one block", SHAMD5_ALGO_SHA256, "abc",
+              "ba7816bf8f01cfea414140de5dae2223"
+              "b00361a396177a9cb410ff61f20015ad");
+    CheckHash("FIPS 180-2 SHA-256 two blocks", SHAMD5_ALGO_SHA256,
+              "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+              "248d6a61d20638b8e5c026930c3e6039"
+              "a33ce45964ff2167f6ecedd419db06c1");
+    CheckHash("FIPS 180-2 SHA-224 one block", SHAMD5_ALGO_SHA224, "abc",
+              "23097d223405d8228642a477bda255b3"
+              "2aadbce4bda0b3f7e36c9da7");
+
+    //
+    // RFC 4231 test cases 1 and 2.
+    //
+    CheckHMAC("RFC 4231 1 HMAC-SHA-256", SHAMD5_ALGO_HMAC_SHA256,
+              "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "Hi There",
+              "b0344c61d8db38535ca8afceaf0bf12b"
+              "881dc200c9833da726e9376c2e32cff7");
+    CheckHMAC("RFC 4231 1 HMAC-SHA-224", SHAMD5_ALGO_HMAC_SHA224,
+              "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "Hi There",
+              "896fb1128abbdf196832107cd49df33f"
+              "47b4b1169912ba4f53684b22");
+    CheckHMAC("RFC 4231 2 HMAC-SHA-256", SHAMD5_ALGO_HMAC_SHA256,
+              "4a656665", "what do ya want for nothing?",
+              "5bdcc146bf60754e6a042426089575c7"
+              "5a003f089d2739839dec58b964ec3843");
+    CheckHMAC("RFC 4231 2 HMAC-SHA-224", SHAMD5_ALGO_HMAC_SHA224,
+              "4a656665", "what do ya want for nothing?",
+              "a30e01098bc6dbbf45690f3a7e9e6d0f"
+              "8bbea2a39e6148008fd05e44");
+
+    if(g_ui32Failures)
+    {
+        printf("crypto: FAILED (%u)\n", (unsigned)g_ui32Failures);
+        return(1);
+    }
+
+    printf("crypto: passed\n");
+    return(0);
+}
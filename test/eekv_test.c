@@ -0,0 +1,544 @@
+//*****************************************************************************
+//
+// eekv_test.c - Host test of the EEPROM key-value store across power cuts.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// This test runs the key-value store against a simulated EEPROM on the
+// host.  Power is cut after a chosen number of programmed words, including
+// in the middle of page compaction, and the store is then mounted again.
+// After every cut, the key being written must hold either its old or its new
+// value, every other key must be unchanged, and the store must keep working.
+// The simulated EEPROM counts the programs of each word, and after the random
+// test the pages must have worn evenly.
+//
+// Build and run with "make -C test".
+//
+//*****************************************************************************
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driverlib/eekv.h"
+
+//*****************************************************************************
+//
+// The geometry of the simulated store.
+//
+//*****************************************************************************
+#define PAGE_SIZE               128
+#define PAGES                   6
+#define KEYS                    8
+#define MAX_WORDS               6
+
+//*****************************************************************************
+//
+// The simulated EEPROM, the number of words that may still be programmed
+// before power is lost (or -1 for no limit), and the place to resume when
+// it is.
+//
+//*****************************************************************************
+static uint32_t g_pui32EEPROM[(PAGE_SIZE * PAGES) / 4];
+static int32_t g_i32Budget = -1;
+static jmp_buf g_sPowerCut;
+
+//*****************************************************************************
+//
+// The number of times each word of the simulated EEPROM has been programmed,
+// and the largest difference, in percent, allowed between the pages in the
+// number of programs and in the programs of their busiest word.
+//
+// The store fills the pages in a ring, so over many trips around it every
+// page takes the same share of the programs.  Only the last, partly filled
+// trip and the records abandoned by power cuts make the pages differ, which
+// over the thousands of trips of the random test comes to a fraction of a
+// percent.  A store that rewrote one page in place would fail by orders of
+// magnitude.
+//
+//*****************************************************************************
+static uint32_t g_pui32Wear[(PAGE_SIZE * PAGES) / 4];
+#define WEAR_LIMIT              1
+
+//*****************************************************************************
+//
+// The store, its index, and a model of the value of each key.
+//
+//*****************************************************************************
+static tEEKVStore g_sStore;
+static uint32_t g_pui32Index[KEYS];
+static uint32_t g_ppui32Model[KEYS][MAX_WORDS];
+static int32_t g_pi32ModelLength[KEYS];
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Called by ASSERT() when the driver library is built with DEBUG defined.
+//
+//*****************************************************************************
+void
+__tiva_driverlib_error__(const char *pcFilename, uint32_t ui32Line)
+{
+    printf("ASSERT at %s:%u\n", pcFilename, (unsigned)ui32Line);
+    g_ui32Failures++;
+}
+
+//*****************************************************************************
+//
+// The simulated EEPROM access functions.  Programming stops part way
+// through when the power budget runs out.
+//
+//*****************************************************************************
+void
+EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    memcpy(pui32Data, &g_pui32EEPROM[ui32Address / 4], ui32Count);
+}
+
+uint32_t
+EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < (ui32Count / 4); ui32Idx++)
+    {
+        if(g_i32Budget == 0)
+        {
+            longjmp(g_sPowerCut, 1);
+        }
+        if(g_i32Budget > 0)
+        {
+            g_i32Budget--;
+        }
+        g_pui32EEPROM[(ui32Address / 4) + ui32Idx] = pui32Data[ui32Idx];
+        g_pui32Wear[(ui32Address / 4) + ui32Idx]++;
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Mounts the store, as is done after a reset.
+//
+//*****************************************************************************
+static void
+Mount(void)
+{
+    memset(&g_sStore, 0, sizeof(g_sStore));
+    g_sStore.ui32Base = 0;
+    g_sStore.ui32PageSize = PAGE_SIZE;
+    g_sStore.ui32Pages = PAGES;
+    g_sStore.pui32Index = g_pui32Index;
+    g_sStore.ui32Keys = KEYS;
+    if(EEKVInit(&g_sStore) != EEKV_OK)
+    {
+        printf("EEKVInit failed\n");
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Returns true if a key holds the given value, or has no value if
+// i32Length is negative.
+//
+//*****************************************************************************
+static bool
+KeyMatches(uint32_t ui32Key, uint32_t *pui32Value, int32_t i32Length)
+{
+    uint32_t pui32Data[MAX_WORDS];
+    int32_t i32Result;
+
+    i32Result = EEKVRead(&g_sStore, ui32Key, pui32Data, sizeof(pui32Data));
+    if(i32Length < 0)
+    {
+        return(i32Result == EEKV_ERR_NOTFOUND);
+    }
+
+    return((i32Result == i32Length) &&
+           (memcmp(pui32Data, pui32Value, i32Length) == 0));
+}
+
+//*****************************************************************************
+//
+// Checks every key except one against the model.
+//
+//*****************************************************************************
+static bool
+CheckAll(int32_t i32Skip, const char *pcWhere)
+{
+    uint32_t ui32Key;
+
+    for(ui32Key = 0; ui32Key < KEYS; ui32Key++)
+    {
+        if(((int32_t)ui32Key != i32Skip) &&
+           !KeyMatches(ui32Key, g_ppui32Model[ui32Key],
+                       g_pi32ModelLength[ui32Key]))
+        {
+            printf("%s: key %u does not match\n", pcWhere, (unsigned)ui32Key);
+            g_ui32Failures++;
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Writes or deletes a key, optionally compacting afterwards.  Power is cut
+// if the budget in g_i32Budget runs out.  The model is updated with
+// whichever value the key holds afterwards.  Returns true if power was cut.
+//
+//*****************************************************************************
+static bool
+Operate(uint32_t ui32Key, uint32_t *pui32Value, int32_t i32Length,
+        bool bCompact)
+{
+    int32_t i32Result;
+
+    if(setjmp(g_sPowerCut) == 0)
+    {
+        if(i32Length < 0)
+        {
+            i32Result = EEKVDelete(&g_sStore, ui32Key);
+            if((i32Result != EEKV_OK) && (i32Result != EEKV_ERR_NOTFOUND))
+            {
+                printf("EEKVDelete returned %d\n", (int)i32Result);
+                g_ui32Failures++;
+            }
+        }
+        else
+        {
+            i32Result = EEKVWrite(&g_sStore, ui32Key, pui32Value, i32Length);
+            if(i32Result != EEKV_OK)
+            {
+                printf("EEKVWrite returned %d\n", (int)i32Result);
+                g_ui32Failures++;
+                return(false);
+            }
+        }
+        if(bCompact)
+        {
+            EEKVCompact(&g_sStore);
+        }
+        g_pi32ModelLength[ui32Key] = i32Length;
+        if(i32Length > 0)
+        {
+            memcpy(g_ppui32Model[ui32Key], pui32Value, i32Length);
+        }
+        return(false);
+    }
+
+    //
+    // Power was lost.  After mounting, the key holds its old value or its
+    // new one and every other key is unchanged.
+    //
+    g_i32Budget = -1;
+    Mount();
+    if(KeyMatches(ui32Key, pui32Value, i32Length))
+    {
+        g_pi32ModelLength[ui32Key] = i32Length;
+        if(i32Length > 0)
+        {
+            memcpy(g_ppui32Model[ui32Key], pui32Value, i32Length);
+        }
+    }
+    else if(!KeyMatches(ui32Key, g_ppui32Model[ui32Key],
+                        g_pi32ModelLength[ui32Key]))
+    {
+        printf("key %u is corrupt after a power cut\n", (unsigned)ui32Key);
+        g_ui32Failures++;
+    }
+    CheckAll(ui32Key, "after power cut");
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Returns a random operation.
+//
+//*****************************************************************************
+static void
+RandomOperation(uint32_t *pui32Key, uint32_t *pui32Value, int32_t *pi32Length)
+{
+    uint32_t ui32Idx;
+
+    *pui32Key = rand() % KEYS;
+    *pi32Length = 4 * (1 + (rand() % MAX_WORDS));
+    if((rand() % 8) == 0)
+    {
+        *pi32Length = -1;
+    }
+    for(ui32Idx = 0; ui32Idx < MAX_WORDS; ui32Idx++)
+    {
+        pui32Value[ui32Idx] = rand();
+    }
+}
+
+//*****************************************************************************
+//
+// Starts from blank EEPROM.
+//
+//*****************************************************************************
+static void
+Format(void)
+{
+    uint32_t ui32Key;
+
+    memset(g_pui32EEPROM, 0xff, sizeof(g_pui32EEPROM));
+    for(ui32Key = 0; ui32Key < KEYS; ui32Key++)
+    {
+        g_pi32ModelLength[ui32Key] = -1;
+    }
+    Mount();
+}
+
+//*****************************************************************************
+//
+// Pages reclaimed by compaction must still be free after a reset.
+//
+//*****************************************************************************
+static void
+TestRemountKeepsFreePages(void)
+{
+    uint32_t pui32Value[MAX_WORDS], ui32Key, ui32Idx, ui32Free;
+    int32_t i32Length;
+
+    Format();
+    srand(1);
+    for(ui32Idx = 0; ui32Idx < 2000; ui32Idx++)
+    {
+        RandomOperation(&ui32Key, pui32Value, &i32Length);
+        Operate(ui32Key, pui32Value, i32Length, true);
+        ui32Free = EEKVFreePagesGet(&g_sStore);
+        Mount();
+        if(EEKVFreePagesGet(&g_sStore) != ui32Free)
+        {
+            printf("free pages went from %u to %u on remount\n",
+                   (unsigned)ui32Free,
+                   (unsigned)EEKVFreePagesGet(&g_sStore));
+            g_ui32Failures++;
+            return;
+        }
+        if(!CheckAll(-1, "after remount"))
+        {
+            return;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Cuts power at every programmed word of a sequence of writes that spans
+// several compactions, and then keeps writing to make sure that the store is
+// intact.
+//
+//*****************************************************************************
+static void
+TestCutEveryWord(void)
+{
+    uint32_t pui32Value[MAX_WORDS], ui32Key, ui32Idx;
+    int32_t i32Length, i32Cut;
+    uint32_t ui32Cuts;
+
+    ui32Cuts = 0;
+    for(i32Cut = 0; i32Cut < 2000; i32Cut++)
+    {
+        Format();
+        srand(2);
+        for(ui32Idx = 0; ui32Idx < 100; ui32Idx++)
+        {
+            RandomOperation(&ui32Key, pui32Value, &i32Length);
+            Operate(ui32Key, pui32Value, i32Length, false);
+        }
+
+        //
+        // Cut the power part way through the following operations.
+        //
+        g_i32Budget = i32Cut;
+        for(ui32Idx = 0; ui32Idx < 100; ui32Idx++)
+        {
+            RandomOperation(&ui32Key, pui32Value, &i32Length);
+            if(Operate(ui32Key, pui32Value, i32Length, (ui32Idx & 3) == 0))
+            {
+                ui32Cuts++;
+                break;
+            }
+        }
+        g_i32Budget = -1;
+
+        //
+        // Power was lost once; carry on without further cuts and make sure
+        // compaction still never damages a live record.
+        //
+        for(ui32Idx = 0; ui32Idx < 200; ui32Idx++)
+        {
+            RandomOperation(&ui32Key, pui32Value, &i32Length);
+            Operate(ui32Key, pui32Value, i32Length, (ui32Idx & 1) != 0);
+        }
+        Mount();
+        if(!CheckAll(-1, "after recovery"))
+        {
+            return;
+        }
+    }
+
+    printf("eekv: %u power cuts at successive words\n", (unsigned)ui32Cuts);
+}
+
+//*****************************************************************************
+//
+// Checks that the programs have been spread evenly over the pages.
+//
+//*****************************************************************************
+static void
+CheckWear(void)
+{
+    uint32_t ui32Page, ui32Word, ui32Total, ui32Busiest;
+    uint32_t ui32MinTotal, ui32MaxTotal, ui32MinBusiest, ui32MaxBusiest;
+
+    ui32MinTotal = ui32MinBusiest = 0xffffffff;
+    ui32MaxTotal = ui32MaxBusiest = 0;
+    for(ui32Page = 0; ui32Page < PAGES; ui32Page++)
+    {
+        ui32Total = ui32Busiest = 0;
+        for(ui32Word = 0; ui32Word < (PAGE_SIZE / 4); ui32Word++)
+        {
+            ui32Total += g_pui32Wear[(ui32Page * (PAGE_SIZE / 4)) + ui32Word];
+            if(g_pui32Wear[(ui32Page * (PAGE_SIZE / 4)) + ui32Word] >
+               ui32Busiest)
+            {
+                ui32Busiest =
+                    g_pui32Wear[(ui32Page * (PAGE_SIZE / 4)) + ui32Word];
+            }
+        }
+
+        ui32MinTotal = (ui32Total < ui32MinTotal) ? ui32Total : ui32MinTotal;
+        ui32MaxTotal = (ui32Total > ui32MaxTotal) ? ui32Total : ui32MaxTotal;
+        ui32MinBusiest = ((ui32Busiest < ui32MinBusiest) ? ui32Busiest :
+                          ui32MinBusiest);
+        ui32MaxBusiest = ((ui32Busiest > ui32MaxBusiest) ? ui32Busiest :
+                          ui32MaxBusiest);
+    }
+
+    printf("eekv: %u to %u programs per page, busiest word %u to %u\n",
+           (unsigned)ui32MinTotal, (unsigned)ui32MaxTotal,
+           (unsigned)ui32MinBusiest, (unsigned)ui32MaxBusiest);
+    if(((uint64_t)ui32MaxTotal * 100) >
+       ((uint64_t)ui32MinTotal * (100 + WEAR_LIMIT)))
+    {
+        printf("programs per page differ by more than %u%%\n", WEAR_LIMIT);
+        g_ui32Failures++;
+    }
+    if(((uint64_t)ui32MaxBusiest * 100) >
+       ((uint64_t)ui32MinBusiest * (100 + WEAR_LIMIT)))
+    {
+        printf("busiest words differ by more than %u%%\n", WEAR_LIMIT);
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Cuts power at random points, many times over, without formatting between
+// cuts, so that cuts land on top of the recovery from earlier cuts.  The
+// wear of the pages is then compared.
+//
+//*****************************************************************************
+static void
+TestRandomCuts(void)
+{
+    uint32_t pui32Value[MAX_WORDS], ui32Key, ui32Idx, ui32Cuts;
+    int32_t i32Length;
+
+    memset(g_pui32Wear, 0, sizeof(g_pui32Wear));
+    Format();
+    srand(3);
+    ui32Cuts = 0;
+    for(ui32Idx = 0; (ui32Idx < 100000) && (g_ui32Failures == 0); ui32Idx++)
+    {
+        RandomOperation(&ui32Key, pui32Value, &i32Length);
+        g_i32Budget = ((rand() % 16) == 0) ? (rand() % 64) : -1;
+        if(Operate(ui32Key, pui32Value, i32Length, (rand() % 4) == 0))
+        {
+            ui32Cuts++;
+        }
+        g_i32Budget = -1;
+        if((ui32Idx % 1000) == 0)
+        {
+            Mount();
+            CheckAll(-1, "after periodic remount");
+        }
+    }
+
+    printf("eekv: %u random power cuts\n", (unsigned)ui32Cuts);
+    CheckWear();
+}
+
+//*****************************************************************************
+//
+// Runs the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    TestRemountKeepsFreePages();
+    TestCutEveryWord();
+    TestRandomCuts();
+
+    if(g_ui32Failures)
+    {
+        printf("eekv: FAILED (%u)\n", (unsigned)g_ui32Failures);
+        return(1);
+    }
+
+    printf("eekv: passed\n");
+    return(0);
+}
@@ -0,0 +1,422 @@
+//*****************************************************************************
+//
+// pwmmod_test.c - Host accuracy check and benchmark of the PWM modulators.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// This test checks the modulation functions against double precision
+// references on the host, and reports the time taken by each per update.
+//
+// - PWMModSin() must be within 3 LSBs of the exact sine.
+// - PWMModSVM() must be within 3 LSBs of PWMModSVMF() for the same
+//   reference, across the linear range and into overmodulation.
+// - PWMModSine() must be within 3 LSBs of the exact duty cycles.
+//
+// The host timings are in cycles of the x86 time stamp counter, which runs
+// at the nominal clock of the host rather than the core clock, so they are
+// for comparing the paths with each other and across changes.
+// PWMModBenchmark() gives the cycle counts on the target.  Other hosts
+// report nanoseconds instead.
+//
+// Build and run with "make -C test".
+//
+//*****************************************************************************
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "driverlib/delay.h"
+#include "driverlib/pwm.h"
+#include "driverlib/pwmmod.h"
+
+//*****************************************************************************
+//
+// The accuracy limits, in LSBs, derived from the resolution of each step
+// rather than from the errors observed.
+//
+// PWMModSin() rounds the quarter wave table entries (0.5), interpolates
+// linearly over steps of pi / 256, which is below the sine by at most
+// (pi / 256)^2 / 8 of full scale (0.62), truncates the interpolation (1)
+// and drops the bottom 13 bits of the phase, a step of 2 pi / 2^19 (0.39).
+// That is within 2.51 of the exact value, and the rounded reference adds 0.5
+// more, so the integer difference is at most 3.
+//
+// PWMModSVM() is fed the Q15 rounding of the reference (0.5 per component).
+// The rounded sqrt(3) / 2 product (0.5 plus 0.06 for the constant) and the
+// rounded half of alpha (0.5) carry this to the B and C phase voltages, and
+// the min-max offset passes at most 2.1 of it to the middle phase, plus 0.5
+// for the integer halving.  PWMModSVMF() truncates its result, for less
+// than 1 more, so the outputs are at most 3 apart.
+//
+// PWMModSine() scales the sine error by at most one half (1.26), scales the
+// Q15 sine by 32767 rather than 32768 (0.5) and truncates the product (1).
+// With the rounded reference (0.5) that is below 3.26, so at most 3.
+//
+//*****************************************************************************
+#define SIN_LIMIT               3
+#define SVM_LIMIT               3
+#define SINE_LIMIT              3
+
+//*****************************************************************************
+//
+// The number of updates timed for each path.
+//
+//*****************************************************************************
+#define BENCH_LOOPS             4000000
+
+//*****************************************************************************
+//
+// The value of pi, which C99 does not provide.
+//
+//*****************************************************************************
+#define PI                      3.14159265358979323846
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Receives the results of the timed loops so that they are not optimized
+// away.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32Sink;
+
+//*****************************************************************************
+//
+// Called by ASSERT() when the driver library is built with DEBUG defined.
+//
+//*****************************************************************************
+void
+__tiva_driverlib_error__(const char *pcFilename, uint32_t ui32Line)
+{
+    printf("ASSERT at %s:%u\n", pcFilename, (unsigned)ui32Line);
+    g_ui32Failures++;
+}
+
+//*****************************************************************************
+//
+// The modulation engine builds and commits frames through the PWM driver.
+// Only the pure functions are tested here, so these are never called.
+//
+//*****************************************************************************
+void
+PWMFrameGroupInit(tPWMFrameGroup *psGroup, uint32_t ui32Base,
+                  uint32_t ui32GenBits)
+{
+}
+
+void
+PWMFrameBuild(const tPWMFrameGroup *psGroup, tPWMFrame *psFrame,
+              const uint16_t *pui16Duty, const uint16_t *pui16DeadBand)
+{
+}
+
+void
+PWMFrameCommit(const tPWMFrameGroup *psGroup, const tPWMFrame *psFrame)
+{
+}
+
+void
+PWMDeadBandEnable(uint32_t ui32Base, uint32_t ui32Gen, uint16_t ui16Rise,
+                  uint16_t ui16Fall)
+{
+}
+
+void
+PWMGenIntTrigEnable(uint32_t ui32Base, uint32_t ui32Gen,
+                    uint32_t ui32IntTrig)
+{
+}
+
+void
+PWMGenIntTrigDisable(uint32_t ui32Base, uint32_t ui32Gen,
+                     uint32_t ui32IntTrig)
+{
+}
+
+//*****************************************************************************
+//
+// PWMModBenchmark() reads the cycle counter through the delay service, and it
+// is not called here either.
+//
+//*****************************************************************************
+void
+DelayInit(void)
+{
+}
+
+uint32_t
+DelayCountGet(void)
+{
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Reports the largest error of a check against its limit.
+//
+//*****************************************************************************
+static void
+Report(const char *pcName, int32_t i32Error, int32_t i32Limit)
+{
+    printf("pwmmod: %s max error %d LSB (limit %d)\n", pcName, (int)i32Error,
+           (int)i32Limit);
+    if(i32Error > i32Limit)
+    {
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Checks PWMModSin() over the whole turn.
+//
+//*****************************************************************************
+static void
+CheckSin(void)
+{
+    uint64_t ui64Phase;
+    int32_t i32Error, i32Max;
+
+    i32Max = 0;
+    for(ui64Phase = 0; ui64Phase < ((uint64_t)1 << 32); ui64Phase += 977)
+    {
+        i32Error = abs(PWMModSin((uint32_t)ui64Phase) -
+                       (int32_t)lround(sin((double)ui64Phase * 2 * PI /
+                                           4294967296.0) * 32767));
+        if(i32Error > i32Max)
+        {
+            i32Max = i32Error;
+        }
+    }
+
+    Report("PWMModSin", i32Max, SIN_LIMIT);
+}
+
+//*****************************************************************************
+//
+// Checks PWMModSVM() against PWMModSVMF() for references of up to 120% of
+// the linear range, in steps of one degree.
+//
+//*****************************************************************************
+static void
+CheckSVM(void)
+{
+    uint16_t pui16Duty[3], pui16DutyF[3];
+    int32_t i32Error, i32Max, i32Angle, i32Idx;
+    double dMagnitude, dAlpha, dBeta;
+
+    i32Max = 0;
+    for(dMagnitude = 0.0; dMagnitude <= (1.2 / sqrt(3.0));
+        dMagnitude += 0.01)
+    {
+        for(i32Angle = 0; i32Angle < 360; i32Angle++)
+        {
+            dAlpha = dMagnitude * cos(i32Angle * PI / 180);
+            dBeta = dMagnitude * sin(i32Angle * PI / 180);
+            PWMModSVM((int16_t)lround(dAlpha * 32768),
+                      (int16_t)lround(dBeta * 32768), pui16Duty);
+            PWMModSVMF((float)dAlpha, (float)dBeta, pui16DutyF);
+            for(i32Idx = 0; i32Idx < 3; i32Idx++)
+            {
+                i32Error = abs(pui16Duty[i32Idx] - pui16DutyF[i32Idx]);
+                if(i32Error > i32Max)
+                {
+                    i32Max = i32Error;
+                }
+            }
+        }
+    }
+
+    Report("PWMModSVM vs PWMModSVMF", i32Max, SVM_LIMIT);
+}
+
+//*****************************************************************************
+//
+// Checks PWMModSine() over the whole turn and a range of amplitudes.
+//
+//*****************************************************************************
+static void
+CheckSine(void)
+{
+    uint16_t pui16Duty[3];
+    uint32_t ui32Amplitude, ui32Idx;
+    uint64_t ui64Phase;
+    int32_t i32Error, i32Max;
+    double dExact;
+
+    i32Max = 0;
+    for(ui32Amplitude = 0; ui32Amplitude <= PWM_FRAME_ONE;
+        ui32Amplitude += 4096)
+    {
+        for(ui64Phase = 0; ui64Phase < ((uint64_t)1 << 32);
+            ui64Phase += 99991)
+        {
+            PWMModSine((uint32_t)ui64Phase, ui32Amplitude, pui16Duty);
+            for(ui32Idx = 0; ui32Idx < 3; ui32Idx++)
+            {
+                dExact = ((PWM_FRAME_ONE / 2) +
+                          ((ui32Amplitude / 2.0) *
+                           sin(((double)ui64Phase * 2 * PI /
+                                4294967296.0) -
+                               (ui32Idx * 2 * PI / 3))));
+                i32Error = abs(pui16Duty[ui32Idx] -
+                               (int32_t)lround(dExact));
+                if(i32Error > i32Max)
+                {
+                    i32Max = i32Error;
+                }
+            }
+        }
+    }
+
+    Report("PWMModSine", i32Max, SINE_LIMIT);
+}
+
+//*****************************************************************************
+//
+// Returns the current time stamp in the units of BENCH_UNITS.
+//
+//*****************************************************************************
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_UNITS             "cycles"
+
+static uint64_t
+TimeGet(void)
+{
+    return(__rdtsc());
+}
+#else
+#define BENCH_UNITS             "ns"
+
+static uint64_t
+TimeGet(void)
+{
+    return((uint64_t)(((double)clock() * 1e9) / CLOCKS_PER_SEC));
+}
+#endif
+
+//*****************************************************************************
+//
+// Prints the time per update since a start time.
+//
+//*****************************************************************************
+static void
+TimeReport(const char *pcName, uint64_t ui64Start)
+{
+    printf("pwmmod: %s %.1f %s per update\n", pcName,
+           (double)(TimeGet() - ui64Start) / BENCH_LOOPS, BENCH_UNITS);
+}
+
+//*****************************************************************************
+//
+// Times each of the modulation paths.
+//
+//*****************************************************************************
+static void
+Benchmark(void)
+{
+    uint16_t pui16Duty[3];
+    uint64_t ui64Start;
+    uint32_t ui32Idx;
+
+    ui64Start = TimeGet();
+    for(ui32Idx = 0; ui32Idx < BENCH_LOOPS; ui32Idx++)
+    {
+        g_ui32Sink += PWMModSin(ui32Idx * 0x9e3779b9);
+    }
+    TimeReport("PWMModSin", ui64Start);
+
+    ui64Start = TimeGet();
+    for(ui32Idx = 0; ui32Idx < BENCH_LOOPS; ui32Idx++)
+    {
+        PWMModSVM(ui32Idx & 0x3fff, (ui32Idx >> 3) & 0x3fff, pui16Duty);
+        g_ui32Sink += pui16Duty[0];
+    }
+    TimeReport("PWMModSVM", ui64Start);
+
+    ui64Start = TimeGet();
+    for(ui32Idx = 0; ui32Idx < BENCH_LOOPS; ui32Idx++)
+    {
+        PWMModSVMF((ui32Idx & 0xff) * 0.001f, 0.2f, pui16Duty);
+        g_ui32Sink += pui16Duty[0];
+    }
+    TimeReport("PWMModSVMF", ui64Start);
+
+    ui64Start = TimeGet();
+    for(ui32Idx = 0; ui32Idx < BENCH_LOOPS; ui32Idx++)
+    {
+        PWMModSine(ui32Idx * 12345, 30000, pui16Duty);
+        g_ui32Sink += pui16Duty[0];
+    }
+    TimeReport("PWMModSine", ui64Start);
+}
+
+//*****************************************************************************
+//
+// Runs the checks and the benchmark.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    CheckSin();
+    CheckSVM();
+    CheckSine();
+    Benchmark();
+
+    if(g_ui32Failures)
+    {
+        printf("pwmmod: FAILED (%u)\n", (unsigned)g_ui32Failures);
+        return(1);
+    }
+
+    printf("pwmmod: passed\n");
+    return(0);
+}
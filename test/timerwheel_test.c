@@ -0,0 +1,621 @@
+//*****************************************************************************
+//
+// timerwheel_test.c - Host test of the hierarchical timer wheel.
+//
+// Copyright (c) 2010-2017 Texas Instruments Incorporated.  All rights reserved.
+// Software License Agreement
+// 
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions
+//   are met:
+// 
+//   Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// 
+//   Redistributions in binary form must reproduce the above copyright
+//   notice, this list of conditions and the following disclaimer in the
+//   documentation and/or other materials provided with the  
+//   distribution.
+// 
+//   Neither the name of Texas Instruments Incorporated nor the names of
+//   its contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// This is part of revision 2.1.4.178 of the Tiva Peripheral Driver Library.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// This test runs the timer wheel on the host, with the wide timer replaced
+// by a simulated clock that the test moves forward.  The match interrupt is
+// taken whenever the clock reaches the programmed match or the interrupt has
+// been pended, and may be taken late, as happens when a higher priority
+// interrupt holds it off.
+//
+// Every callback checks that its timer has not expired early, and after each
+// interrupt no timer that is due may be left pending.  Callbacks re-arm
+// timers, including their own, from inside the handler.  In the preemption
+// test, a higher priority interrupt also arms and cancels timers whenever
+// the handler calls into the simulated timer outside a critical section.
+//
+// Build and run with "make -C test".
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_types.h"
+
+//*****************************************************************************
+//
+// The only register the driver touches directly is the timer mode register,
+// which is of no interest here.
+//
+//*****************************************************************************
+static uint32_t g_ui32Register;
+#undef HWREG
+#define HWREG(x)                (*((void)(x), &g_ui32Register))
+
+#include "driverlib/timerwheel.c"
+
+//*****************************************************************************
+//
+// The simulated wide timer: its count, its match, and whether its interrupt
+// is pending.
+//
+//*****************************************************************************
+static uint64_t g_ui64Time;
+static uint64_t g_ui64Match;
+static bool g_bPending;
+
+//*****************************************************************************
+//
+// The nesting depth of the critical section, whether the match interrupt
+// handler is running, and whether it may be preempted.
+//
+//*****************************************************************************
+static uint32_t g_ui32AtomicDepth;
+static bool g_bInHandler;
+static bool g_bPreempt;
+
+static void Preempt(void);
+
+//*****************************************************************************
+//
+// The number of failed checks.
+//
+//*****************************************************************************
+static uint32_t g_ui32Failures;
+
+//*****************************************************************************
+//
+// Called by ASSERT() when the driver library is built with DEBUG defined.
+//
+//*****************************************************************************
+void
+__tiva_driverlib_error__(const char *pcFilename, uint32_t ui32Line)
+{
+    printf("ASSERT at %s:%u\n", pcFilename, (unsigned)ui32Line);
+    g_ui32Failures++;
+}
+
+//*****************************************************************************
+//
+// The simulated versions of the driver functions used by the timer wheel.
+//
+//*****************************************************************************
+uint64_t
+TimerValueGet64(uint32_t ui32Base)
+{
+    Preempt();
+    return(g_ui64Time);
+}
+
+void
+TimerMatchSet64(uint32_t ui32Base, uint64_t ui64Value)
+{
+    Preempt();
+    g_ui64Match = ui64Value;
+}
+
+void
+IntPendSet(uint32_t ui32Interrupt)
+{
+    g_bPending = true;
+}
+
+uint32_t
+CPUclz(uint32_t ui32Value)
+{
+    Preempt();
+    return(ui32Value ? (uint32_t)__builtin_clz(ui32Value) : 32);
+}
+
+uint32_t
+AtomicEnter(void)
+{
+    g_ui32AtomicDepth++;
+    return(0);
+}
+
+void
+AtomicExit(uint32_t ui32Key)
+{
+    if(g_ui32AtomicDepth == 0)
+    {
+        printf("critical section exited more often than entered\n");
+        g_ui32Failures++;
+        return;
+    }
+    g_ui32AtomicDepth--;
+}
+
+void
+TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+}
+
+void
+TimerLoadSet64(uint32_t ui32Base, uint64_t ui64Value)
+{
+}
+
+void
+TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+}
+
+void
+TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+}
+
+void
+TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+}
+
+//*****************************************************************************
+//
+// Moves the clock to the given time, and then takes the match interrupt if
+// it is due.
+//
+//*****************************************************************************
+static void
+RunTo(uint64_t ui64Time)
+{
+    g_ui64Time = ui64Time;
+    if(g_bPending || (g_ui64Match <= g_ui64Time))
+    {
+        g_bPending = false;
+        g_bInHandler = true;
+        TimerWheelIntHandler();
+        g_bInHandler = false;
+        if(g_ui32AtomicDepth)
+        {
+            printf("handler returned inside a critical section\n");
+            g_ui32Failures++;
+            g_ui32AtomicDepth = 0;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// The timers of the tests, the time at which each should expire, and
+// whether each is expected to be pending.
+//
+//*****************************************************************************
+#define NUM_TIMERS              256
+static tTimerWheelTimer g_psTimers[NUM_TIMERS];
+static uint64_t g_pui64Expected[NUM_TIMERS];
+static bool g_pbArmed[NUM_TIMERS];
+static uint32_t g_ui32Shift;
+static uint32_t g_ui32Fired;
+
+//*****************************************************************************
+//
+// Returns the tick on which a time falls due.
+//
+//*****************************************************************************
+static uint64_t
+DueTick(uint64_t ui64Time)
+{
+    return((ui64Time + ((uint64_t)1 << g_ui32Shift) - 1) >> g_ui32Shift);
+}
+
+//*****************************************************************************
+//
+// Starts the wheel with the clock at zero and none of the timers pending.
+//
+//*****************************************************************************
+static void
+Start(uint32_t ui32Shift, void (*pfnCallback)(tTimerWheelTimer *psTimer))
+{
+    uint32_t ui32Idx;
+
+    g_ui32Shift = ui32Shift;
+    g_ui64Time = 0;
+    g_bPending = false;
+    TimerWheelInit(WTIMER0_BASE, INT_WTIMER0A_TM4C123, g_ui32Shift);
+    for(ui32Idx = 0; ui32Idx < NUM_TIMERS; ui32Idx++)
+    {
+        g_psTimers[ui32Idx].pfnCallback = pfnCallback;
+        g_psTimers[ui32Idx].ppsPrev = 0;
+        g_pbArmed[ui32Idx] = false;
+    }
+}
+
+//*****************************************************************************
+//
+// Starts a timer of the tests.
+//
+//*****************************************************************************
+static void
+Arm(uint32_t ui32Timer, uint64_t ui64Expiry, uint32_t ui32Period)
+{
+    g_psTimers[ui32Timer].ui32Period = ui32Period;
+    g_pui64Expected[ui32Timer] = ui64Expiry;
+    g_pbArmed[ui32Timer] = true;
+    TimerWheelAdd(&g_psTimers[ui32Timer], ui64Expiry);
+}
+
+//*****************************************************************************
+//
+// Checks that a timer has not expired early and records the expiry.
+//
+//*****************************************************************************
+static void
+Expired(tTimerWheelTimer *psTimer)
+{
+    uint32_t ui32Timer;
+
+    ui32Timer = psTimer - g_psTimers;
+    g_ui32Fired++;
+
+    if(!g_pbArmed[ui32Timer])
+    {
+        printf("timer %u expired while not armed\n", (unsigned)ui32Timer);
+        g_ui32Failures++;
+    }
+    if((g_ui64Time >> g_ui32Shift) < DueTick(g_pui64Expected[ui32Timer]))
+    {
+        printf("timer %u due at %llu expired at %llu\n", (unsigned)ui32Timer,
+               (unsigned long long)g_pui64Expected[ui32Timer],
+               (unsigned long long)g_ui64Time);
+        g_ui32Failures++;
+    }
+
+    if(psTimer->ui32Period)
+    {
+        g_pui64Expected[ui32Timer] += psTimer->ui32Period;
+    }
+    else
+    {
+        g_pbArmed[ui32Timer] = false;
+    }
+}
+
+//*****************************************************************************
+//
+// The callback of the first test, which re-arms a second timer 64 ticks
+// after the first was due.
+//
+//*****************************************************************************
+static void
+RearmCallback(tTimerWheelTimer *psTimer)
+{
+    Expired(psTimer);
+    Arm(1, 164, 0);
+}
+
+//*****************************************************************************
+//
+// A timer due at 100 whose handler runs late, at 130, arms another for 164.
+// The second timer must not expire in the same pass of the handler.
+//
+//*****************************************************************************
+static void
+TestRearmFromLateHandler(void)
+{
+    Start(0, Expired);
+    g_psTimers[0].pfnCallback = RearmCallback;
+    Arm(0, 100, 0);
+
+    //
+    // The interrupt is held off until 130.
+    //
+    g_ui64Time = 130;
+    g_bPending = false;
+    TimerWheelIntHandler();
+    if(g_pbArmed[0] || !g_pbArmed[1] || !TimerWheelPending(&g_psTimers[1]))
+    {
+        printf("re-armed timer expired from the handler that armed it\n");
+        g_ui32Failures++;
+    }
+
+    RunTo(163);
+    if(!g_pbArmed[1])
+    {
+        printf("re-armed timer expired early\n");
+        g_ui32Failures++;
+    }
+    RunTo(164);
+    if(g_pbArmed[1])
+    {
+        printf("re-armed timer did not expire\n");
+        g_ui32Failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// The callback of the random test, which re-arms itself or another timer
+// some of the time.
+//
+//*****************************************************************************
+static void
+RandomCallback(tTimerWheelTimer *psTimer)
+{
+    uint32_t ui32Timer;
+
+    Expired(psTimer);
+
+    if((rand() % 2) == 0)
+    {
+        ui32Timer = ((rand() % 2) == 0) ? (uint32_t)(psTimer - g_psTimers) :
+                    (uint32_t)(rand() % NUM_TIMERS);
+        if(!g_pbArmed[ui32Timer] || (g_psTimers[ui32Timer].ui32Period == 0))
+        {
+            Arm(ui32Timer, g_ui64Time + (rand() % 5000), 0);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Simulates a higher priority interrupt that arms or cancels a timer.  It is
+// taken at random while the match interrupt handler runs outside a critical
+// section, which is when the hardware would let it in.
+//
+//*****************************************************************************
+static void
+Preempt(void)
+{
+    static bool bPreempting = false;
+    uint32_t ui32Timer;
+
+    if(!g_bPreempt || !g_bInHandler || bPreempting || g_ui32AtomicDepth ||
+       ((rand() % 4) != 0))
+    {
+        return;
+    }
+    bPreempting = true;
+
+    ui32Timer = rand() % NUM_TIMERS;
+    if((rand() % 2) == 0)
+    {
+        if(!g_pbArmed[ui32Timer] || (g_psTimers[ui32Timer].ui32Period == 0))
+        {
+            Arm(ui32Timer, g_ui64Time + (rand() % 200), 0);
+        }
+    }
+    else
+    {
+        if(TimerWheelCancel(&g_psTimers[ui32Timer]) != g_pbArmed[ui32Timer])
+        {
+            printf("cancel of timer %u from a preemption disagrees\n",
+                   (unsigned)ui32Timer);
+            g_ui32Failures++;
+        }
+        g_pbArmed[ui32Timer] = false;
+    }
+
+    bPreempting = false;
+}
+
+//*****************************************************************************
+//
+// Returns a random time span that is sometimes short and sometimes long.
+//
+//*****************************************************************************
+static uint64_t
+RandomSpan(void)
+{
+    switch(rand() % 4)
+    {
+        case 0:
+        {
+            return(rand() % 64);
+        }
+        case 1:
+        {
+            return(rand() % 5000);
+        }
+        case 2:
+        {
+            return(rand() % 1000000);
+        }
+        default:
+        {
+            return((((uint64_t)rand() << 16) ^ rand()) % ((uint64_t)1 << 36));
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Checks that the slot lists are linked consistently, that the occupancy
+// bitmaps match them, and that exactly the armed timers are pending.
+//
+//*****************************************************************************
+static void
+CheckWheel(void)
+{
+    tTimerWheelTimer **ppsPrev, *psTimer;
+    uint32_t ui32Slot, ui32Count, ui32Idx;
+    bool bUsed;
+
+    ui32Count = 0;
+    for(ui32Slot = 0; ui32Slot < TIMERWHEEL_LEVELS * TIMERWHEEL_SLOTS;
+        ui32Slot++)
+    {
+        ppsPrev = &g_ppsTimerWheelSlots[ui32Slot];
+        for(psTimer = *ppsPrev; psTimer; psTimer = psTimer->psNext)
+        {
+            if((psTimer->ppsPrev != ppsPrev) ||
+               (psTimer->ui16Slot != ui32Slot) || (++ui32Count > NUM_TIMERS))
+            {
+                printf("slot %u is corrupt\n", (unsigned)ui32Slot);
+                g_ui32Failures++;
+                return;
+            }
+            ppsPrev = &psTimer->psNext;
+        }
+
+        bUsed = ((g_pui64TimerWheelUsed[ui32Slot / TIMERWHEEL_SLOTS] >>
+                  (ui32Slot % TIMERWHEEL_SLOTS)) & 1) != 0;
+        if(bUsed != (g_ppsTimerWheelSlots[ui32Slot] != 0))
+        {
+            printf("bitmap of slot %u is wrong\n", (unsigned)ui32Slot);
+            g_ui32Failures++;
+            return;
+        }
+    }
+
+    for(ui32Idx = 0; ui32Idx < NUM_TIMERS; ui32Idx++)
+    {
+        if(TimerWheelPending(&g_psTimers[ui32Idx]) != g_pbArmed[ui32Idx])
+        {
+            printf("timer %u pending state is wrong\n", (unsigned)ui32Idx);
+            g_ui32Failures++;
+            return;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Arms, cancels and expires timers at random, with the interrupt often
+// taken late, and optionally preempted by another that also arms and
+// cancels timers.
+//
+//*****************************************************************************
+static void
+TestRandom(uint32_t ui32Seed, bool bPreempt)
+{
+    uint32_t ui32Idx, ui32Step, ui32Timer;
+
+    srand(ui32Seed);
+    Start(rand() % 8, RandomCallback);
+    g_bPreempt = bPreempt;
+
+    for(ui32Step = 0; (ui32Step < 50000) && !g_ui32Failures; ui32Step++)
+    {
+        ui32Timer = rand() % NUM_TIMERS;
+        switch(rand() % 4)
+        {
+            case 0:
+            {
+                Arm(ui32Timer, g_ui64Time + RandomSpan(),
+                    ((rand() % 8) == 0) ?
+                    (((uint32_t)1 << g_ui32Shift) + (rand() % 100000)) :
+                    0);
+                break;
+            }
+
+            case 1:
+            {
+                if(TimerWheelCancel(&g_psTimers[ui32Timer]) !=
+                   g_pbArmed[ui32Timer])
+                {
+                    printf("cancel of timer %u disagrees\n",
+                           (unsigned)ui32Timer);
+                    g_ui32Failures++;
+                }
+                g_pbArmed[ui32Timer] = false;
+                break;
+            }
+
+            default:
+            {
+                RunTo(g_ui64Time + (uint64_t)(((rand() % 4) == 0) ?
+                                              (rand() % 1000000) :
+                                              (rand() % 100)));
+                break;
+            }
+        }
+
+        CheckWheel();
+
+        //
+        // Nothing that is due may be left waiting for an interrupt that will
+        // not come.
+        //
+        if(g_bPending || (g_ui64Match <= g_ui64Time))
+        {
+            continue;
+        }
+        for(ui32Idx = 0; ui32Idx < NUM_TIMERS; ui32Idx++)
+        {
+            if(g_pbArmed[ui32Idx] &&
+               (DueTick(g_pui64Expected[ui32Idx]) <=
+                (g_ui64Time >> g_ui32Shift)))
+            {
+                printf("timer %u due at %llu missed at %llu\n",
+                       (unsigned)ui32Idx,
+                       (unsigned long long)g_pui64Expected[ui32Idx],
+                       (unsigned long long)g_ui64Time);
+                g_ui32Failures++;
+                break;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Runs the tests.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    uint32_t ui32Seed;
+
+    TestRearmFromLateHandler();
+    for(ui32Seed = 1; ui32Seed <= 8; ui32Seed++)
+    {
+        TestRandom(ui32Seed, false);
+    }
+    for(ui32Seed = 1; ui32Seed <= 4; ui32Seed++)
+    {
+        TestRandom(ui32Seed, true);
+    }
+    g_bPreempt = false;
+
+    if(g_ui32Failures)
+    {
+        printf("timerwheel: FAILED (%u)\n", (unsigned)g_ui32Failures);
+        return(1);
+    }
+
+    printf("timerwheel: %u expiries, passed\n", (unsigned)g_ui32Fired);
+    return(0);
+}